@@ -0,0 +1,66 @@
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "Frustum.h"
+#include "Scene.h"
+#include "ThreadPool.h"
+
+void populateScene(Scene& scene, const size_t objectCount)
+{
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_real_distribution<float> positionDistribution{ -500.0f, 500.0f };
+	std::uniform_real_distribution<float> radiusDistribution{ 0.5f, 4.0f };
+	scene.reserve(objectCount);
+	for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+	{
+		const glm::vec3 position{ positionDistribution(randomGenerator), positionDistribution(randomGenerator), positionDistribution(randomGenerator) };
+		scene.addObject(SceneObjectCreateInfo{
+			.meshIndex = 0,
+			.boundsCenter = glm::vec3(0.0f),
+			.boundsRadius = radiusDistribution(randomGenerator),
+			.transform = glm::translate(glm::mat4(1.0f), position)
+		});
+	}
+}
+
+void runCullingBenchmark(Scene& scene, const Frustum& frustum, const unsigned int threadCount, const int iterationCount)
+{
+	ThreadPool threadPool{ threadCount - 1 };
+	scene.cull(frustum, threadPool);
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	for (int iteration = 0; iteration < iterationCount; ++iteration)
+	{
+		scene.cull(frustum, threadPool);
+	}
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	const double elapsedMilliseconds{ std::chrono::duration<double, std::milli>(end - start).count() / iterationCount };
+	std::cout << "Threads: " << threadCount
+		<< " | Visible: " << scene.getVisibleObjects().size() << "/" << scene.getObjectCount()
+		<< " | Time: " << elapsedMilliseconds << " ms"
+		<< " | Objects culled per ms: " << static_cast<double>(scene.getObjectCount()) / elapsedMilliseconds << std::endl;
+}
+
+int main(const int argc, const char* argv[])
+{
+	const size_t objectCount{ argc > 1 ? static_cast<size_t>(std::atoll(argv[1])) : 100000 };
+	const int iterationCount{ argc > 2 ? std::atoi(argv[2]) : 200 };
+	Scene scene;
+	populateScene(scene, objectCount);
+	const glm::mat4 projection{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) };
+	const glm::mat4 view{ glm::lookAt(glm::vec3(0.0f, 0.0f, -600.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)) };
+	const Frustum frustum{ projection * view };
+	const unsigned int hardwareThreadCount{ std::max(1u, std::thread::hardware_concurrency()) };
+	for (unsigned int threadCount = 1; threadCount < hardwareThreadCount; threadCount *= 2)
+	{
+		runCullingBenchmark(scene, frustum, threadCount, iterationCount);
+	}
+	runCullingBenchmark(scene, frustum, hardwareThreadCount, iterationCount);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "LodSelector.h"
+#include "MeshLodGenerator.h"
+#include "SceneGenerator.h"
+#include "ThreadPool.h"
+
+void printLods(const size_t meshIndex, const Mesh& mesh)
+{
+	std::cout << "Mesh " << meshIndex << ":";
+	for (const auto& lod : mesh.lods)
+	{
+		std::cout << " [" << lod.indexCount / 3 << " triangles, error " << lod.error << "]";
+	}
+	std::cout << std::endl;
+}
+
+void measureTriangleSavings(const GeneratedScene& generatedScene, const LodSelector& lodSelector, const glm::vec3& cameraPosition)
+{
+	uint64_t fullDetailTriangleCount{ 0 };
+	uint64_t selectedTriangleCount{ 0 };
+	for (uint32_t objectIndex = 0; objectIndex < generatedScene.scene.getObjectCount(); ++objectIndex)
+	{
+		const Mesh& mesh{ generatedScene.meshes[generatedScene.scene.getMeshIndex(objectIndex)] };
+		const float scale{ generatedScene.scene.getWorldBoundsRadius(objectIndex) / std::max(mesh.boundsRadius, 1e-6f) };
+		const float distance{ glm::distance(cameraPosition, generatedScene.scene.getWorldBoundsCenter(objectIndex)) - generatedScene.scene.getWorldBoundsRadius(objectIndex) };
+		fullDetailTriangleCount += mesh.lods[0].indexCount / 3;
+		selectedTriangleCount += mesh.lods[lodSelector.select(mesh, distance, scale)].indexCount / 3;
+	}
+	std::cout << "Camera at (" << cameraPosition.x << ", " << cameraPosition.y << ", " << cameraPosition.z << "): "
+		<< fullDetailTriangleCount << " triangles without LOD, " << selectedTriangleCount << " with LOD, savings "
+		<< 100.0 * (1.0 - static_cast<double>(selectedTriangleCount) / fullDetailTriangleCount) << "%" << std::endl;
+}
+
+int main(const int argc, const char* argv[])
+{
+	SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+	sceneGeneratorCreateInfo.seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+	sceneGeneratorCreateInfo.terrainTriangleCount = 250000;
+	ThreadPool threadPool;
+	GeneratedScene generatedScene{ SceneGenerator(sceneGeneratorCreateInfo).generate(threadPool) };
+	const MeshLodGenerator meshLodGenerator;
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	meshLodGenerator.generate(generatedScene.meshes, threadPool);
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	std::cout << "LOD generation for " << generatedScene.meshes.size() << " meshes on " << threadPool.getThreadCount() << " threads: "
+		<< std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+	for (size_t meshIndex = 0; meshIndex < generatedScene.meshes.size(); ++meshIndex)
+	{
+		printLods(meshIndex, generatedScene.meshes[meshIndex]);
+	}
+	const LodSelector lodSelector{ 1080.0f, glm::radians(60.0f), 1.0f };
+	measureTriangleSavings(generatedScene, lodSelector, glm::vec3(0.0f, 20.0f, 0.0f));
+	measureTriangleSavings(generatedScene, lodSelector, glm::vec3(-90.0f, 15.0f, -90.0f));
+	measureTriangleSavings(generatedScene, lodSelector, glm::vec3(0.0f, 150.0f, 0.0f));
+	return EXIT_SUCCESS;
+}
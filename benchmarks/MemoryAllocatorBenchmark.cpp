@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "LinearAllocator.h"
+#include "TlsfAllocator.h"
+
+void runTlsfBenchmark(const uint64_t blockSize, const int operationCount)
+{
+	TlsfAllocator tlsfAllocator{ blockSize };
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_int_distribution<uint64_t> sizeDistribution{ 256, 1024 * 1024 };
+	std::uniform_int_distribution<int> alignmentExponentDistribution{ 4, 16 };
+	std::vector<uint32_t> liveHandles;
+	int failedAllocationCount{ 0 };
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	for (int operation = 0; operation < operationCount; ++operation)
+	{
+		if (liveHandles.empty() || randomGenerator() % 2 == 0)
+		{
+			const std::optional<TlsfAllocation> tlsfAllocation{ tlsfAllocator.allocate(sizeDistribution(randomGenerator), 1ull << alignmentExponentDistribution(randomGenerator)) };
+			if (tlsfAllocation)
+			{
+				liveHandles.push_back(tlsfAllocation->handle);
+			}
+			else
+			{
+				++failedAllocationCount;
+			}
+		}
+		else
+		{
+			const size_t liveIndex{ randomGenerator() % liveHandles.size() };
+			tlsfAllocator.free(liveHandles[liveIndex]);
+			liveHandles[liveIndex] = liveHandles.back();
+			liveHandles.pop_back();
+		}
+	}
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	const uint64_t freeSize{ tlsfAllocator.getSize() - tlsfAllocator.getUsedSize() };
+	std::cout << "TLSF: " << std::chrono::duration<double, std::nano>(end - start).count() / operationCount << " ns per operation"
+		<< " | Live allocations: " << tlsfAllocator.getAllocationCount()
+		<< " | Failed allocations: " << failedAllocationCount
+		<< " | Used: " << 100.0 * tlsfAllocator.getUsedSize() / tlsfAllocator.getSize() << "%"
+		<< " | Fragmentation: " << (freeSize > 0 ? 100.0 * (1.0 - static_cast<double>(tlsfAllocator.getLargestFreeRange()) / freeSize) : 0.0) << "%" << std::endl;
+}
+
+void runLinearBenchmark(const uint64_t frameSize, const int frameCount)
+{
+	LinearAllocator linearAllocator{ frameSize };
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_int_distribution<uint64_t> sizeDistribution{ 64, 1024 };
+	uint64_t allocationCount{ 0 };
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	for (int frame = 0; frame < frameCount; ++frame)
+	{
+		linearAllocator.reset();
+		while (linearAllocator.allocate(sizeDistribution(randomGenerator), 256))
+		{
+			++allocationCount;
+		}
+	}
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	std::cout << "Linear: " << std::chrono::duration<double, std::nano>(end - start).count() / allocationCount << " ns per allocation"
+		<< " | Allocations per frame: " << allocationCount / frameCount << std::endl;
+}
+
+int main(const int argc, const char* argv[])
+{
+	const uint64_t blockSize{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256ull * 1024 * 1024 };
+	const int operationCount{ argc > 2 ? std::atoi(argv[2]) : 1000000 };
+	runTlsfBenchmark(blockSize, operationCount);
+	runLinearBenchmark(4 * 1024 * 1024, 1000);
+	return EXIT_SUCCESS;
+}
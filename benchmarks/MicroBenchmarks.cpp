@@ -0,0 +1,537 @@
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BindlessDescriptorHeap.h"
+#include "CommandBuffer.h"
+#include "DeviceMemoryAllocator.h"
+#include "Framebuffer.h"
+#include "FrameUniforms.h"
+#include "Frustum.h"
+#include "GraphicsPipeline.h"
+#include "Image.h"
+#include "ImageQuality.h"
+#include "IndexBuffer.h"
+#include "JSONConfigurationFileParser.h"
+#include "MeshLodGenerator.h"
+#include "ParallelCommandRecorder.h"
+#include "PhysicalDeviceSuitabilityRater.h"
+#include "QueueFamilyIndices.h"
+#include "RenderPass.h"
+#include "Scene.h"
+#include "SceneGenerator.h"
+#include "Shader.h"
+#include "ShaderCompiler.h"
+#include "ThreadPool.h"
+#include "TlsfAllocator.h"
+#include "TransferQueue.h"
+#include "UniformRing.h"
+#include "UploadManager.h"
+#include "VertexBuffer.h"
+
+class SoftwareDevice
+{
+public:
+	SoftwareDevice()
+	{
+		createInstance();
+		createHeadlessSurface();
+		selectSoftwarePhysicalDevice();
+		createLogicalDevice();
+		createResources();
+		createForwardPass();
+	}
+
+	~SoftwareDevice()
+	{
+		vulkanLogicalDevice.waitIdle();
+		parallelCommandRecorder.reset();
+		graphicsPipeline.reset();
+		shaders.clear();
+		framebuffer.reset();
+		colorImage.reset();
+		deviceMemoryAllocator->free(colorImageMemoryAllocation);
+		renderPass.reset();
+		vertexBuffer.reset();
+		indexBuffer.reset();
+		bindlessDescriptorHeap.reset();
+		uniformRing.reset();
+		uploadManager.reset();
+		transferQueue.reset();
+		deviceMemoryAllocator.reset();
+		vulkanLogicalDevice.destroy();
+		vulkanInstance.destroySurfaceKHR(vulkanSurface);
+		vulkanInstance.destroy();
+	}
+
+	const CommandBufferRecordInfo buildCommandBufferRecordInfo(const std::vector<IndexedDraw>& draws) const
+	{
+		return CommandBufferRecordInfo{
+			.renderPassBeginInfo = renderPass->createRenderPassBeginInfo(framebuffer->getVulkanFramebuffer(), extent),
+			.graphicsPipeline = graphicsPipeline->getVulkanPipeline(),
+			.graphicsPipelineLayout = graphicsPipeline->getVulkanPipelineLayout(),
+			.vulkanVertexBuffer = vertexBuffer->getVulkanBuffer(),
+			.vulkanIndexBuffer = indexBuffer->getVulkanBuffer(),
+			.vulkanUniformDescriptorSet = uniformRing->getVulkanDescriptorSet(),
+			.uniformDynamicOffset = 0,
+			.vulkanBindlessDescriptorSet = bindlessDescriptorHeap->getVulkanDescriptorSet(),
+			.bindlessPushConstants = BindlessPushConstants{},
+			.draws = draws,
+			.indexType = vk::IndexType::eUint32
+		};
+	}
+
+	vk::Instance vulkanInstance;
+	vk::SurfaceKHR vulkanSurface;
+	vk::PhysicalDevice vulkanPhysicalDevice;
+	vk::Device vulkanLogicalDevice;
+	uint32_t graphicsFamilyIndex{ 0 };
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<UploadManager> uploadManager;
+	std::unique_ptr<ParallelCommandRecorder> parallelCommandRecorder;
+	ThreadPool threadPool;
+
+private:
+	void createInstance()
+	{
+		const vk::ApplicationInfo applicationInfo{
+			.pApplicationName = "MicroBenchmarks",
+			.applicationVersion = VK_MAKE_VERSION(1, 0, 0),
+			.pEngineName = "No Engine",
+			.engineVersion = VK_MAKE_VERSION(1, 0, 0),
+			.apiVersion = VK_API_VERSION_1_2
+		};
+		const std::vector<const char*> instanceExtensions{ VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+		vulkanInstance = vk::createInstance(vk::InstanceCreateInfo{
+			.pApplicationInfo = &applicationInfo,
+			.enabledExtensionCount = static_cast<uint32_t>(instanceExtensions.size()),
+			.ppEnabledExtensionNames = instanceExtensions.data()
+		});
+	}
+
+	void createHeadlessSurface()
+	{
+		const auto createHeadlessSurfaceEXT{ reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(vulkanInstance.getProcAddr("vkCreateHeadlessSurfaceEXT")) };
+		const VkHeadlessSurfaceCreateInfoEXT headlessSurfaceCreateInfo{ .sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT };
+		VkSurfaceKHR surface;
+		if (!createHeadlessSurfaceEXT || createHeadlessSurfaceEXT(vulkanInstance, &headlessSurfaceCreateInfo, nullptr, &surface) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Error in MicroBenchmarks! Failed to create a headless surface");
+		}
+		vulkanSurface = surface;
+	}
+
+	void selectSoftwarePhysicalDevice()
+	{
+		const PhysicalDeviceSuitabilityRater physicalDeviceSuitabilityRater;
+		for (const auto& candidatePhysicalDevice : vulkanInstance.enumeratePhysicalDevices())
+		{
+			const PhysicalDeviceSuitabilityRaterInfo physicalDeviceSuitabilityRaterInfo{
+				.vulkanPhysicalDevice = candidatePhysicalDevice,
+				.vulkanWindowSurface = vulkanSurface,
+				.vulkanDeviceExtensions = {}
+			};
+			if (candidatePhysicalDevice.getProperties().deviceType == vk::PhysicalDeviceType::eCpu && physicalDeviceSuitabilityRater.rate(physicalDeviceSuitabilityRaterInfo) > 0)
+			{
+				vulkanPhysicalDevice = candidatePhysicalDevice;
+				return;
+			}
+		}
+		throw std::runtime_error("Error in MicroBenchmarks! No suitable software Vulkan device was found");
+	}
+
+	void createLogicalDevice()
+	{
+		const QueueFamilyIndices queueFamilyIndices{ vulkanPhysicalDevice, vulkanSurface };
+		graphicsFamilyIndex = queueFamilyIndices.getGraphicsFamilyIndex().value();
+		transferFamilyIndex = queueFamilyIndices.getTransferFamilyIndex().value_or(graphicsFamilyIndex);
+		const std::set<uint32_t> uniqueQueueFamilies{ graphicsFamilyIndex, transferFamilyIndex };
+		const float queuePriority{ 1.0f };
+		std::vector<vk::DeviceQueueCreateInfo> deviceQueueCreateInfos;
+		for (const uint32_t queueFamilyIndex : uniqueQueueFamilies)
+		{
+			deviceQueueCreateInfos.push_back(vk::DeviceQueueCreateInfo{
+				.queueFamilyIndex = queueFamilyIndex,
+				.queueCount = 1,
+				.pQueuePriorities = &queuePriority
+			});
+		}
+		vk::PhysicalDeviceVulkan12Features physicalDeviceVulkan12Features{ .timelineSemaphore = true };
+		const auto physicalDeviceFeatures2{ vulkanPhysicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>() };
+		isDescriptorIndexingEnabled = BindlessDescriptorHeap::isDescriptorIndexingSupported(physicalDeviceFeatures2.get<vk::PhysicalDeviceVulkan12Features>());
+		if (isDescriptorIndexingEnabled)
+		{
+			BindlessDescriptorHeap::enableDescriptorIndexing(physicalDeviceVulkan12Features);
+		}
+		const vk::PhysicalDeviceFeatures physicalDeviceFeatures{};
+		vulkanLogicalDevice = vulkanPhysicalDevice.createDevice(vk::DeviceCreateInfo{
+			.pNext = &physicalDeviceVulkan12Features,
+			.queueCreateInfoCount = static_cast<uint32_t>(deviceQueueCreateInfos.size()),
+			.pQueueCreateInfos = deviceQueueCreateInfos.data(),
+			.pEnabledFeatures = &physicalDeviceFeatures
+		});
+	}
+
+	void createResources()
+	{
+		DeviceMemoryAllocatorCreateInfo deviceMemoryAllocatorCreateInfo;
+		deviceMemoryAllocatorCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+		deviceMemoryAllocatorCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+		deviceMemoryAllocator = std::make_shared<DeviceMemoryAllocator>(deviceMemoryAllocatorCreateInfo);
+		transferQueue = std::make_shared<TransferQueue>(vulkanLogicalDevice, transferFamilyIndex);
+		UploadManagerCreateInfo uploadManagerCreateInfo;
+		uploadManagerCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+		uploadManagerCreateInfo.transferQueue = transferQueue;
+		uploadManagerCreateInfo.transferFamilyIndex = transferFamilyIndex;
+		uploadManagerCreateInfo.sharingQueueFamilyIndices = { graphicsFamilyIndex };
+		if (transferFamilyIndex != graphicsFamilyIndex)
+		{
+			uploadManagerCreateInfo.sharingQueueFamilyIndices.push_back(transferFamilyIndex);
+		}
+		uploadManager = std::make_shared<UploadManager>(uploadManagerCreateInfo);
+		UniformRingCreateInfo uniformRingCreateInfo;
+		uniformRingCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+		uniformRingCreateInfo.uniformSize = sizeof(FrameUniforms);
+		uniformRingCreateInfo.minUniformBufferOffsetAlignment = vulkanPhysicalDevice.getProperties().limits.minUniformBufferOffsetAlignment;
+		uniformRingCreateInfo.frameCount = 1;
+		uniformRing = std::make_unique<UniformRing>(uniformRingCreateInfo);
+		BindlessDescriptorHeapCreateInfo bindlessDescriptorHeapCreateInfo;
+		bindlessDescriptorHeapCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+		bindlessDescriptorHeapCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+		bindlessDescriptorHeapCreateInfo.isDescriptorIndexingEnabled = isDescriptorIndexingEnabled;
+		bindlessDescriptorHeapCreateInfo.frameCount = 1;
+		bindlessDescriptorHeap = std::make_unique<BindlessDescriptorHeap>(bindlessDescriptorHeapCreateInfo);
+		BufferCreateInfo bufferCreateInfo;
+		bufferCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+		bufferCreateInfo.uploadManager = uploadManager;
+		vertexBuffer = std::make_unique<VertexBuffer>(bufferCreateInfo);
+		indexBuffer = std::make_unique<IndexBuffer>(bufferCreateInfo);
+		vertexBuffer->allocate(quadVertices);
+		indexBuffer->allocate(quadIndices);
+		uploadManager->flush();
+		uploadManager->waitForUploads();
+	}
+
+	void createForwardPass()
+	{
+		const vk::SurfaceFormatKHR surfaceFormat{ .format = vk::Format::eR8G8B8A8Unorm, .colorSpace = vk::ColorSpaceKHR::eSrgbNonlinear };
+		renderPass = std::make_unique<RenderPass>(vulkanLogicalDevice, surfaceFormat);
+		colorImage = std::make_unique<Image>(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = surfaceFormat.format,
+			.usage = vk::ImageUsageFlagBits::eColorAttachment
+		});
+		colorImageMemoryAllocation = deviceMemoryAllocator->allocateImageMemory(colorImage->getVulkanImage(), vk::MemoryPropertyFlagBits::eDeviceLocal);
+		colorImage->bindMemory(colorImageMemoryAllocation.vulkanDeviceMemory, colorImageMemoryAllocation.offset);
+		framebuffer = std::make_unique<Framebuffer>(vulkanLogicalDevice, renderPass->getVulkanRenderPass(), colorImage->getVulkanImageView(), extent);
+		ShaderCompiler shaderCompiler{ ShaderCompilerCreateInfo{} };
+		GraphicsPipelineCreateInfo graphicsPipelineCreateInfo;
+		graphicsPipelineCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+		graphicsPipelineCreateInfo.vulkanRenderPass = renderPass->getVulkanRenderPass();
+		graphicsPipelineCreateInfo.descriptorSetLayouts = { uniformRing->getVulkanDescriptorSetLayout(), bindlessDescriptorHeap->getVulkanDescriptorSetLayout() };
+		graphicsPipelineCreateInfo.pushConstantRanges = { vk::PushConstantRange{
+			.stageFlags = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
+			.offset = 0,
+			.size = sizeof(BindlessPushConstants)
+		} };
+		for (const auto& shaderSourceDescription : graphicsShaderSources)
+		{
+			shaders.push_back(std::make_unique<Shader>(shaderCompiler.compile(shaderSourceDescription).spirv, vulkanLogicalDevice, shaderSourceDescription.stage));
+			graphicsPipelineCreateInfo.shaderStages.push_back(shaders.back()->buildPipelineShaderStageCreateInfo());
+		}
+		graphicsPipeline = std::make_unique<GraphicsPipeline>(graphicsPipelineCreateInfo);
+		ParallelCommandRecorderCreateInfo parallelCommandRecorderCreateInfo;
+		parallelCommandRecorderCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+		parallelCommandRecorderCreateInfo.queueFamilyIndex = graphicsFamilyIndex;
+		parallelCommandRecorderCreateInfo.frameCount = 1;
+		parallelCommandRecorderCreateInfo.threadCount = threadPool.getThreadCount();
+		parallelCommandRecorder = std::make_unique<ParallelCommandRecorder>(parallelCommandRecorderCreateInfo);
+	}
+
+	const vk::Extent2D extent{ 1920, 1080 };
+	uint32_t transferFamilyIndex{ 0 };
+	bool isDescriptorIndexingEnabled{ false };
+	std::shared_ptr<TransferQueue> transferQueue;
+	std::unique_ptr<UniformRing> uniformRing;
+	std::unique_ptr<BindlessDescriptorHeap> bindlessDescriptorHeap;
+	std::unique_ptr<VertexBuffer> vertexBuffer;
+	std::unique_ptr<IndexBuffer> indexBuffer;
+	std::unique_ptr<RenderPass> renderPass;
+	std::unique_ptr<Image> colorImage;
+	MemoryAllocation colorImageMemoryAllocation{};
+	std::unique_ptr<Framebuffer> framebuffer;
+	std::vector<std::unique_ptr<Shader>> shaders;
+	std::unique_ptr<GraphicsPipeline> graphicsPipeline;
+	const std::vector<ShaderSourceDescription> graphicsShaderSources = {
+		{ .path = "shaders/shader.vert", .stage = vk::ShaderStageFlagBits::eVertex },
+		{ .path = "shaders/shader.frag", .stage = vk::ShaderStageFlagBits::eFragment }
+	};
+	const std::vector<Vertex> quadVertices = {
+		{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
+		{{-0.5f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}
+	};
+	const std::vector<uint32_t> quadIndices = {
+		0, 1, 2, 2, 3, 0
+	};
+};
+
+SoftwareDevice* findSoftwareDevice()
+{
+	static const std::unique_ptr<SoftwareDevice> softwareDevice{ []() -> std::unique_ptr<SoftwareDevice>
+	{
+		try
+		{
+			return std::make_unique<SoftwareDevice>();
+		}
+		catch (const std::exception& exception)
+		{
+			std::cerr << exception.what() << std::endl;
+			return nullptr;
+		}
+	}() };
+	return softwareDevice.get();
+}
+
+const std::string buildConfigurationFile(const int64_t presetCount)
+{
+	std::ostringstream configurationFile;
+	configurationFile << "{ \"window\": { \"width\": 1920, \"height\": 1080 }, \"rendering\": { \"cacheCommandBuffers\": true, \"framesInFlight\": 3, \"presentMode\": \"mailbox\", "
+		<< "\"targetFrameRate\": 144.0, \"profileGpu\": true }, \"presets\": [";
+	for (int64_t presetIndex = 0; presetIndex < presetCount; ++presetIndex)
+	{
+		configurationFile << (presetIndex > 0 ? ", " : "") << "{ \"name\": \"preset" << presetIndex << "\", \"width\": " << 640 + presetIndex % 1280
+			<< ", \"height\": " << 480 + presetIndex % 720 << ", \"sampleCounts\": [ 8, 12, 16 ], \"presentMode\": \"fifo\" }";
+	}
+	configurationFile << "] }";
+	return configurationFile.str();
+}
+
+const LuminanceImage generateLuminanceImage(const uint32_t width, const uint32_t height, const uint64_t seed, const float noiseAmplitude)
+{
+	std::mt19937 randomGenerator{ static_cast<std::mt19937::result_type>(seed) };
+	std::uniform_real_distribution<float> noiseDistribution{ -noiseAmplitude, noiseAmplitude };
+	LuminanceImage luminanceImage{
+		.width = width,
+		.height = height,
+		.pixels = std::vector<float>(static_cast<size_t>(width) * height)
+	};
+	for (uint32_t y = 0; y < height; ++y)
+	{
+		for (uint32_t x = 0; x < width; ++x)
+		{
+			const float gradient{ 0.5f + 0.25f * std::sin(0.01f * x) * std::cos(0.013f * y) };
+			luminanceImage.pixels[static_cast<size_t>(y) * width + x] = std::clamp(gradient + noiseDistribution(randomGenerator), 0.0f, 1.0f);
+		}
+	}
+	return luminanceImage;
+}
+
+void parseConfigurationFile(benchmark::State& state)
+{
+	const std::string configurationFile{ buildConfigurationFile(state.range(0)) };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(JSONConfigurationFileParser(configurationFile.c_str()).getConfigurationFileModel());
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(configurationFile.size()));
+}
+BENCHMARK(parseConfigurationFile)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+void churnTlsfAllocator(benchmark::State& state)
+{
+	TlsfAllocator tlsfAllocator{ 256ull * 1024 * 1024 };
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_int_distribution<uint64_t> sizeDistribution{ 256, 1024 * 1024 };
+	std::vector<uint32_t> liveHandles;
+	for (auto _ : state)
+	{
+		if (liveHandles.empty() || randomGenerator() % 2 == 0)
+		{
+			const std::optional<TlsfAllocation> tlsfAllocation{ tlsfAllocator.allocate(sizeDistribution(randomGenerator), 256) };
+			if (tlsfAllocation)
+			{
+				liveHandles.push_back(tlsfAllocation->handle);
+			}
+		}
+		else
+		{
+			const size_t liveIndex{ randomGenerator() % liveHandles.size() };
+			tlsfAllocator.free(liveHandles[liveIndex]);
+			liveHandles[liveIndex] = liveHandles.back();
+			liveHandles.pop_back();
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(churnTlsfAllocator);
+
+void generateScene(benchmark::State& state)
+{
+	SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+	sceneGeneratorCreateInfo.terrainTriangleCount = static_cast<uint32_t>(state.range(0));
+	ThreadPool threadPool;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(SceneGenerator(sceneGeneratorCreateInfo).generate(threadPool));
+	}
+}
+BENCHMARK(generateScene)->Arg(100000)->Arg(500000)->Unit(benchmark::kMillisecond);
+
+void generateMeshLods(benchmark::State& state)
+{
+	SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+	sceneGeneratorCreateInfo.terrainTriangleCount = static_cast<uint32_t>(state.range(0));
+	ThreadPool threadPool;
+	const Mesh terrainMesh{ SceneGenerator(sceneGeneratorCreateInfo).generate(threadPool).meshes.front() };
+	const MeshLodGenerator meshLodGenerator;
+	for (auto _ : state)
+	{
+		Mesh mesh{ terrainMesh };
+		meshLodGenerator.generate(mesh);
+		benchmark::DoNotOptimize(mesh.lods.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(terrainMesh.indices.size() / 3));
+}
+BENCHMARK(generateMeshLods)->Arg(20000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+void cullScene(benchmark::State& state)
+{
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_real_distribution<float> positionDistribution{ -500.0f, 500.0f };
+	std::uniform_real_distribution<float> radiusDistribution{ 0.5f, 4.0f };
+	Scene scene;
+	scene.reserve(static_cast<size_t>(state.range(0)));
+	for (int64_t objectIndex = 0; objectIndex < state.range(0); ++objectIndex)
+	{
+		const glm::vec3 position{ positionDistribution(randomGenerator), positionDistribution(randomGenerator), positionDistribution(randomGenerator) };
+		scene.addObject(SceneObjectCreateInfo{
+			.meshIndex = 0,
+			.boundsCenter = glm::vec3(0.0f),
+			.boundsRadius = radiusDistribution(randomGenerator),
+			.transform = glm::translate(glm::mat4(1.0f), position)
+		});
+	}
+	const glm::mat4 projection{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) };
+	const glm::mat4 view{ glm::lookAt(glm::vec3(0.0f, 0.0f, -600.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)) };
+	const Frustum frustum{ projection * view };
+	ThreadPool threadPool{ static_cast<unsigned int>(state.range(1)) };
+	for (auto _ : state)
+	{
+		scene.cull(frustum, threadPool);
+		benchmark::DoNotOptimize(scene.getVisibleObjects().data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(cullScene)->ArgsProduct({ { 10000, 100000, 1000000 }, { 1, 4 } });
+
+void compareImageQuality(benchmark::State& state)
+{
+	const uint32_t width{ static_cast<uint32_t>(state.range(0)) };
+	const uint32_t height{ static_cast<uint32_t>(state.range(1)) };
+	const LuminanceImage referenceImage{ generateLuminanceImage(width, height, 1, 0.0f) };
+	const LuminanceImage image{ generateLuminanceImage(width, height, 2, 0.05f) };
+	ThreadPool threadPool;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ImageQuality::compare(referenceImage, image, threadPool));
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * width * height);
+}
+BENCHMARK(compareImageQuality)->Args({ 1920, 1080 })->Args({ 3840, 2160 })->Unit(benchmark::kMillisecond);
+
+void ratePhysicalDevice(benchmark::State& state)
+{
+	const SoftwareDevice* softwareDevice{ findSoftwareDevice() };
+	if (!softwareDevice)
+	{
+		state.SkipWithError("No software Vulkan device is available");
+		return;
+	}
+	const PhysicalDeviceSuitabilityRater physicalDeviceSuitabilityRater;
+	const PhysicalDeviceSuitabilityRaterInfo physicalDeviceSuitabilityRaterInfo{
+		.vulkanPhysicalDevice = softwareDevice->vulkanPhysicalDevice,
+		.vulkanWindowSurface = softwareDevice->vulkanSurface,
+		.vulkanDeviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME }
+	};
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(physicalDeviceSuitabilityRater.rate(physicalDeviceSuitabilityRaterInfo));
+	}
+}
+BENCHMARK(ratePhysicalDevice);
+
+void uploadVertices(benchmark::State& state)
+{
+	SoftwareDevice* softwareDevice{ findSoftwareDevice() };
+	if (!softwareDevice)
+	{
+		state.SkipWithError("No software Vulkan device is available");
+		return;
+	}
+	std::mt19937 randomGenerator{ 42 };
+	std::uniform_real_distribution<float> coordinateDistribution{ -1.0f, 1.0f };
+	std::vector<Vertex> vertices(static_cast<size_t>(state.range(0)));
+	for (auto& vertex : vertices)
+	{
+		vertex.position = glm::vec3(coordinateDistribution(randomGenerator), coordinateDistribution(randomGenerator), coordinateDistribution(randomGenerator));
+		vertex.color = glm::vec3(1.0f);
+		vertex.normal = glm::vec3(0.0f, 0.0f, 1.0f);
+	}
+	BufferCreateInfo bufferCreateInfo;
+	bufferCreateInfo.deviceMemoryAllocator = softwareDevice->deviceMemoryAllocator;
+	bufferCreateInfo.uploadManager = softwareDevice->uploadManager;
+	bufferCreateInfo.initialElementCount = 2 * vertices.size();
+	VertexBuffer vertexBuffer{ bufferCreateInfo };
+	uint64_t frameNumber{ 0 };
+	for (auto _ : state)
+	{
+		vertexBuffer.beginFrame(frameNumber, frameNumber);
+		const uint32_t rangeHandle{ vertexBuffer.allocate(vertices) };
+		softwareDevice->uploadManager->flush();
+		softwareDevice->uploadManager->waitForUploads();
+		vertexBuffer.release(rangeHandle);
+		++frameNumber;
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(vertices.size() * sizeof(Vertex)));
+}
+BENCHMARK(uploadVertices)->RangeMultiplier(8)->Range(1024, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+void recordForwardPass(benchmark::State& state)
+{
+	SoftwareDevice* softwareDevice{ findSoftwareDevice() };
+	if (!softwareDevice)
+	{
+		state.SkipWithError("No software Vulkan device is available");
+		return;
+	}
+	const std::vector<IndexedDraw> draws(static_cast<size_t>(state.range(0)), IndexedDraw{ .indexCount = 6, .instanceCount = 1, .firstIndex = 0, .vertexOffset = 0, .firstInstance = 0 });
+	const CommandBufferRecordInfo commandBufferRecordInfo{ softwareDevice->buildCommandBufferRecordInfo(draws) };
+	for (auto _ : state)
+	{
+		softwareDevice->parallelCommandRecorder->beginFrame(0);
+		const vk::CommandBuffer vulkanCommandBuffer{ softwareDevice->parallelCommandRecorder->beginPrimaryCommandBuffer() };
+		CommandBuffer::recordForwardPass(vulkanCommandBuffer, commandBufferRecordInfo, *softwareDevice->parallelCommandRecorder, softwareDevice->threadPool);
+		vulkanCommandBuffer.end();
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(recordForwardPass)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,52 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "BenchmarkConfigurationParser.h"
+#include "BenchmarkReport.h"
+#include "BenchmarkRunner.h"
+
+const std::string readFile(const char* filePath)
+{
+	std::ifstream file(filePath);
+	if (!file.is_open())
+	{
+		throw std::runtime_error(std::string("Error in RenderBenchmark! ") + filePath + " could not be opened");
+	}
+	std::stringstream fileStream;
+	fileStream << file.rdbuf();
+	return fileStream.str();
+}
+
+int main(const int argc, const char* argv[])
+{
+	try
+	{
+		const char* scenariosFile{ argc > 1 ? argv[1] : "benchmarks/scenarios.json" };
+		const char* resultsFile{ argc > 2 ? argv[2] : "benchmark_results.json" };
+		const BenchmarkConfiguration benchmarkConfiguration{ BenchmarkConfigurationParser(readFile(scenariosFile).c_str()).getBenchmarkConfiguration() };
+		BenchmarkRunner benchmarkRunner{ benchmarkConfiguration };
+		const std::vector<BenchmarkResult> benchmarkResults{ benchmarkRunner.run() };
+		BenchmarkReport::write(benchmarkResults, resultsFile);
+		std::cout << benchmarkResults.size() << " scenarios have been written to " << resultsFile << std::endl;
+		if (argc > 3)
+		{
+			const std::vector<std::string> regressions{ BenchmarkReport::findRegressions(benchmarkResults, readFile(argv[3]), benchmarkConfiguration.regressionThreshold, benchmarkConfiguration.structuralSimilarityTolerance) };
+			for (const auto& regression : regressions)
+			{
+				std::cout << "Regression: " << regression << std::endl;
+			}
+			std::cout << regressions.size() << " regressions above " << 100.0 * benchmarkConfiguration.regressionThreshold << "% or " << benchmarkConfiguration.structuralSimilarityTolerance
+				<< " SSIM against " << argv[3] << std::endl;
+			return regressions.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
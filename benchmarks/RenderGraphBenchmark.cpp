@@ -0,0 +1,105 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "RenderGraph.h"
+
+const RenderGraphAccess describeAccess(const uint32_t imageHandle, const vk::PipelineStageFlags stageMask, const vk::AccessFlags accessMask, const vk::ImageLayout layout)
+{
+	return RenderGraphAccess{
+		.imageHandle = imageHandle,
+		.stageMask = stageMask,
+		.accessMask = accessMask,
+		.layout = layout
+	};
+}
+
+const RenderGraphAccess describeComputeRead(const uint32_t imageHandle)
+{
+	return describeAccess(imageHandle, vk::PipelineStageFlagBits::eComputeShader, vk::AccessFlagBits::eShaderRead, vk::ImageLayout::eShaderReadOnlyOptimal);
+}
+
+const RenderGraphAccess describeComputeWrite(const uint32_t imageHandle)
+{
+	return describeAccess(imageHandle, vk::PipelineStageFlagBits::eComputeShader, vk::AccessFlagBits::eShaderWrite, vk::ImageLayout::eGeneral);
+}
+
+void buildAmbientOcclusionGraph(RenderGraph& renderGraph)
+{
+	const uint32_t depth{ renderGraph.addImage(RenderGraphImageDescription{ .name = "Depth", .aspectMask = vk::ImageAspectFlagBits::eDepth }) };
+	const uint32_t normals{ renderGraph.addImage(RenderGraphImageDescription{ .name = "Normals" }) };
+	const uint32_t hiZ{ renderGraph.addImage(RenderGraphImageDescription{ .name = "HiZ", .mipLevels = 12 }) };
+	const uint32_t rawAmbientOcclusion{ renderGraph.addImage(RenderGraphImageDescription{ .name = "RawAmbientOcclusion" }) };
+	const uint32_t blurPing{ renderGraph.addImage(RenderGraphImageDescription{ .name = "BlurPing" }) };
+	const uint32_t blurPong{ renderGraph.addImage(RenderGraphImageDescription{ .name = "BlurPong" }) };
+	const uint32_t history{ renderGraph.addImage(RenderGraphImageDescription{
+		.name = "History",
+		.initialLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+		.initialStageMask = vk::PipelineStageFlagBits::eFragmentShader,
+		.finalLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+		.isExternal = true
+	}) };
+	const uint32_t shadowMap{ renderGraph.addImage(RenderGraphImageDescription{ .name = "ShadowMap", .aspectMask = vk::ImageAspectFlagBits::eDepth }) };
+	const uint32_t debugView{ renderGraph.addImage(RenderGraphImageDescription{ .name = "DebugView" }) };
+	const uint32_t swapChain{ renderGraph.addImage(RenderGraphImageDescription{
+		.name = "SwapChain",
+		.initialStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+		.finalLayout = vk::ImageLayout::ePresentSrcKHR,
+		.isExternal = true
+	}) };
+	const std::function<void(const vk::CommandBuffer&)> record{ [](const vk::CommandBuffer&) {} };
+	renderGraph.addPass(RenderGraphPassDescription{
+		.name = "Geometry",
+		.writes = {
+			describeAccess(depth, vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests, vk::AccessFlagBits::eDepthStencilAttachmentWrite, vk::ImageLayout::eDepthStencilAttachmentOptimal),
+			describeAccess(normals, vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::AccessFlagBits::eColorAttachmentWrite, vk::ImageLayout::eColorAttachmentOptimal)
+		},
+		.record = record
+	});
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "HiZ", .queue = RenderGraphQueue::eCompute, .reads = { describeComputeRead(normals) }, .writes = { describeComputeWrite(hiZ) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "DebugView", .reads = { describeComputeRead(normals) }, .writes = { describeComputeWrite(debugView) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "AmbientOcclusion", .queue = RenderGraphQueue::eCompute, .reads = { describeComputeRead(normals), describeComputeRead(hiZ) }, .writes = { describeComputeWrite(rawAmbientOcclusion) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "HorizontalBlur", .queue = RenderGraphQueue::eCompute, .reads = { describeComputeRead(rawAmbientOcclusion) }, .writes = { describeComputeWrite(blurPing) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "VerticalBlur", .queue = RenderGraphQueue::eCompute, .reads = { describeComputeRead(blurPing) }, .writes = { describeComputeWrite(blurPong) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{ .name = "TemporalResolve", .queue = RenderGraphQueue::eCompute, .reads = { describeComputeRead(blurPong) }, .writes = { describeComputeWrite(history) }, .record = record });
+	renderGraph.addPass(RenderGraphPassDescription{
+		.name = "Shadows",
+		.writes = { describeAccess(shadowMap, vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests, vk::AccessFlagBits::eDepthStencilAttachmentWrite, vk::ImageLayout::eDepthStencilAttachmentOptimal) },
+		.record = record
+	});
+	renderGraph.addPass(RenderGraphPassDescription{
+		.name = "Composite",
+		.reads = {
+			describeAccess(history, vk::PipelineStageFlagBits::eFragmentShader, vk::AccessFlagBits::eShaderRead, vk::ImageLayout::eShaderReadOnlyOptimal),
+			describeAccess(shadowMap, vk::PipelineStageFlagBits::eFragmentShader, vk::AccessFlagBits::eShaderRead, vk::ImageLayout::eShaderReadOnlyOptimal)
+		},
+		.writes = { describeAccess(swapChain, vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::AccessFlagBits::eColorAttachmentWrite, vk::ImageLayout::eColorAttachmentOptimal) },
+		.record = record
+	});
+}
+
+void runRenderGraphBenchmark(const std::string& label, const RenderGraphCreateInfo& renderGraphCreateInfo, const int iterationCount)
+{
+	RenderGraph renderGraph{ renderGraphCreateInfo };
+	buildAmbientOcclusionGraph(renderGraph);
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	for (int iteration = 0; iteration < iterationCount; ++iteration)
+	{
+		renderGraph.compile();
+	}
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	const RenderGraphStatistics statistics{ renderGraph.getStatistics() };
+	std::cout << label << std::endl << renderGraph.dump();
+	std::cout << "Compiled graph: " << statistics.segmentCount << " queue submissions, " << statistics.barrierBatchCount << " pipeline barrier calls, "
+		<< statistics.imageBarrierCount << " image barriers and " << statistics.queueOwnershipTransferCount << " queue ownership transfers"
+		<< " | Compilation: " << std::chrono::duration<double, std::micro>(end - start).count() / iterationCount << " us" << std::endl << std::endl;
+}
+
+int main(const int argc, const char* argv[])
+{
+	const int iterationCount{ argc > 1 ? std::atoi(argv[1]) : 100000 };
+	runRenderGraphBenchmark("Graphics queue only:", RenderGraphCreateInfo{ .graphicsFamilyIndex = 0 }, iterationCount);
+	runRenderGraphBenchmark("Async compute:", RenderGraphCreateInfo{ .graphicsFamilyIndex = 0, .computeFamilyIndex = 1 }, iterationCount);
+	return EXIT_SUCCESS;
+}
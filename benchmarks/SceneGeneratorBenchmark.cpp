@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "SceneGenerator.h"
+#include "ThreadPool.h"
+
+void hashBytes(uint64_t& hash, const void* data, const size_t size)
+{
+	const unsigned char* bytes{ static_cast<const unsigned char*>(data) };
+	for (size_t byteIndex = 0; byteIndex < size; ++byteIndex)
+	{
+		hash = (hash ^ bytes[byteIndex]) * 1099511628211ull;
+	}
+}
+
+const uint64_t hashGeneratedScene(const GeneratedScene& generatedScene)
+{
+	uint64_t hash{ 14695981039346656037ull };
+	for (const auto& mesh : generatedScene.meshes)
+	{
+		for (const auto& vertex : mesh.vertices)
+		{
+			const float attributes[]{ vertex.position.x, vertex.position.y, vertex.position.z, vertex.color.x, vertex.color.y, vertex.color.z, vertex.normal.x, vertex.normal.y, vertex.normal.z };
+			hashBytes(hash, attributes, sizeof(attributes));
+		}
+		hashBytes(hash, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+	}
+	for (uint32_t objectIndex = 0; objectIndex < generatedScene.scene.getObjectCount(); ++objectIndex)
+	{
+		const uint32_t meshIndex{ generatedScene.scene.getMeshIndex(objectIndex) };
+		const glm::mat4& transform{ generatedScene.scene.getTransform(objectIndex) };
+		hashBytes(hash, &meshIndex, sizeof(meshIndex));
+		for (int column = 0; column < 4; ++column)
+		{
+			const float values[]{ transform[column].x, transform[column].y, transform[column].z, transform[column].w };
+			hashBytes(hash, values, sizeof(values));
+		}
+	}
+	return hash;
+}
+
+int main(const int argc, const char* argv[])
+{
+	SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+	sceneGeneratorCreateInfo.seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+	sceneGeneratorCreateInfo.terrainTriangleCount = argc > 2 ? static_cast<uint32_t>(std::atoll(argv[2])) : 2000000;
+	sceneGeneratorCreateInfo.clutterCount = argc > 3 ? static_cast<uint32_t>(std::atoll(argv[3])) : 16384;
+	const SceneGenerator sceneGenerator{ sceneGeneratorCreateInfo };
+	ThreadPool threadPool;
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	const GeneratedScene generatedScene{ sceneGenerator.generate(threadPool) };
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	uint64_t uniqueTriangleCount{ 0 };
+	for (const auto& mesh : generatedScene.meshes)
+	{
+		uniqueTriangleCount += mesh.indices.size() / 3;
+	}
+	uint64_t sceneTriangleCount{ 0 };
+	for (uint32_t objectIndex = 0; objectIndex < generatedScene.scene.getObjectCount(); ++objectIndex)
+	{
+		sceneTriangleCount += generatedScene.meshes[generatedScene.scene.getMeshIndex(objectIndex)].indices.size() / 3;
+	}
+	std::cout << "Seed: " << sceneGeneratorCreateInfo.seed << std::endl;
+	std::cout << "Threads: " << threadPool.getThreadCount() << std::endl;
+	std::cout << "Generation time: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+	std::cout << "Meshes: " << generatedScene.meshes.size() << " (" << uniqueTriangleCount << " unique triangles)" << std::endl;
+	std::cout << "Objects: " << generatedScene.scene.getObjectCount() << " (" << sceneTriangleCount << " instanced triangles)" << std::endl;
+	std::cout << "Checksum: " << std::hex << hashGeneratedScene(generatedScene) << std::dec << std::endl;
+	return EXIT_SUCCESS;
+}
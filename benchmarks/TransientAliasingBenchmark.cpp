@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "AmbientOcclusionImageChain.h"
+#include "TransientMemoryPlanner.h"
+
+const uint64_t estimateTexelSize(const vk::Format format)
+{
+	switch (format)
+	{
+	case vk::Format::eR8Unorm:
+		return 1;
+	case vk::Format::eR16Sfloat:
+		return 2;
+	case vk::Format::eR16G16B16A16Sfloat:
+		return 8;
+	default:
+		return 4;
+	}
+}
+
+const uint64_t estimateImageSize(const ImageCreateInfo& imageCreateInfo, const uint64_t alignment)
+{
+	uint64_t imageSize{ 0 };
+	for (uint32_t mipLevel = 0; mipLevel < imageCreateInfo.mipLevels; ++mipLevel)
+	{
+		const uint64_t width{ std::max(imageCreateInfo.extent.width >> mipLevel, 1u) };
+		const uint64_t height{ std::max(imageCreateInfo.extent.height >> mipLevel, 1u) };
+		imageSize += width * height * estimateTexelSize(imageCreateInfo.format);
+	}
+	return (imageSize + alignment - 1) & ~(alignment - 1);
+}
+
+void runAliasingBenchmark(const vk::Extent2D& extent, const int iterationCount)
+{
+	const uint64_t alignment{ 64 * 1024 };
+	std::vector<TransientResourceRequest> transientResourceRequests;
+	uint64_t transientBytes{ 0 };
+	for (const auto& transientImageDescription : AmbientOcclusionImageChain::describe(vk::Device{}, extent))
+	{
+		const uint64_t imageSize{ estimateImageSize(transientImageDescription.imageCreateInfo, alignment) };
+		if (transientImageDescription.imageCreateInfo.isTransient)
+		{
+			transientBytes += imageSize;
+			continue;
+		}
+		transientResourceRequests.push_back(TransientResourceRequest{
+			.size = imageSize,
+			.alignment = alignment,
+			.firstPass = transientImageDescription.firstPass,
+			.lastPass = transientImageDescription.lastPass,
+			.isAliasable = transientImageDescription.isAliasable
+		});
+	}
+	TransientMemoryPlan transientMemoryPlan;
+	const auto start{ std::chrono::high_resolution_clock::now() };
+	for (int iteration = 0; iteration < iterationCount; ++iteration)
+	{
+		transientMemoryPlan = TransientMemoryPlanner::plan(transientResourceRequests);
+	}
+	const auto end{ std::chrono::high_resolution_clock::now() };
+	const double mebibyte{ 1024.0 * 1024.0 };
+	std::cout << extent.width << "x" << extent.height << ": " << (transientMemoryPlan.unaliasedSize + transientBytes) / mebibyte << " MiB without aliasing, "
+		<< (transientMemoryPlan.size + transientBytes) / mebibyte << " MiB aliased, " << transientMemoryPlan.size / mebibyte << " MiB when transient attachments are lazily allocated"
+		<< " | Planning: " << std::chrono::duration<double, std::micro>(end - start).count() / iterationCount << " us" << std::endl;
+}
+
+int main(const int argc, const char* argv[])
+{
+	const int iterationCount{ argc > 1 ? std::atoi(argv[1]) : 10000 };
+	runAliasingBenchmark(vk::Extent2D{ .width = 1920, .height = 1080 }, iterationCount);
+	runAliasingBenchmark(vk::Extent2D{ .width = 2560, .height = 1440 }, iterationCount);
+	runAliasingBenchmark(vk::Extent2D{ .width = 3840, .height = 2160 }, iterationCount);
+	return EXIT_SUCCESS;
+}
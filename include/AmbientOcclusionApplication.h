@@ -1,31 +1,70 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <memory>
+#include <optional>
+#include <set>
 #include "Window.h"
 #include "GraphicsInstance.h"
+#include "FramePacer.h"
+#include "Mesh.h"
+#include "PipelineShaders.h"
+#include "MeshLodGenerator.h"
+#include "RenderSettings.h"
 #include "Shader.h"
+#include "ShaderCompiler.h"
+#include "ShaderWatcher.h"
 #include "Vertex.h"
 
 class AmbientOcclusionApplication
 {
 
 public:
-	AmbientOcclusionApplication(const int windowWidth, const int windowHeight);
+	AmbientOcclusionApplication(const int windowWidth, const int windowHeight, const RenderSettings& renderSettings);
 	~AmbientOcclusionApplication();
 	void run();
 
 private:
-	const std::vector<std::shared_ptr<Shader>> loadShaders(const vk::Device& vulkanLogicalDevice) const;
+	const PipelineShaders loadShaders(const vk::Device& vulkanLogicalDevice);
+	const std::shared_ptr<Shader> loadShader(const vk::Device& vulkanLogicalDevice, const ShaderSourceDescription& shaderSourceDescription, std::set<std::filesystem::path>& dependencies);
+	void reloadChangedShaders();
+	void selectAmbientOcclusionQuality();
+	void printMemoryStatistics() const;
+	void printUploadStatistics() const;
+	void printTransientMemoryStatistics() const;
+	void printCommandRecordingStatistics() const;
+	void printCommandBufferCacheStatistics() const;
+	void printFramePacingSettings() const;
+	void printFrameLatencyStatistics() const;
+	void writeGpuProfile() const;
+	void writeTraceOnRequest();
+	void writeTrace() const;
+	void printStartupStatistics() const;
 
+	const std::chrono::steady_clock::time_point startTime{ std::chrono::steady_clock::now() };
+	std::optional<double> timeToFirstFrameMilliseconds;
+	bool wasTraceKeyPressed{ false };
+	const RenderSettings renderSettings;
+	FramePacer framePacer;
 	std::shared_ptr<Window> window;
 	std::shared_ptr<GraphicsInstance> graphicsInstance;
+	const MeshLodGenerator meshLodGenerator;
+	ShaderCompiler shaderCompiler{ ShaderCompilerCreateInfo{} };
+	ShaderWatcher shaderWatcher{ "shaders" };
+	const ShaderSourceDescription vertexShaderSource{ .path = "shaders/shader.vert", .stage = vk::ShaderStageFlagBits::eVertex };
+	const ShaderSourceDescription geometryShaderSource{ .path = "shaders/geometry.frag", .stage = vk::ShaderStageFlagBits::eFragment };
+	const ShaderSourceDescription ambientOcclusionShaderSource{ .path = "shaders/ambientOcclusion.comp", .stage = vk::ShaderStageFlagBits::eCompute };
+	const ShaderSourceDescription forwardShaderSource{ .path = "shaders/shader.frag", .stage = vk::ShaderStageFlagBits::eFragment };
+	std::set<std::filesystem::path> pipelineDependencies;
 	const std::vector<Vertex> vertices = {
-		{{-0.5f, -0.5f}, {1.0f, 0.0f, 0.0f}},
-		{{0.5f, -0.5f}, {0.0f, 1.0f, 0.0f}},
-		{{0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},
-		{{-0.5f, 0.5f}, {1.0f, 1.0f, 1.0f}}
+		{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
+		{{-0.5f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}
 	};
-	const std::vector<uint16_t> indices = {
+	const std::vector<uint32_t> indices = {
 		0, 1, 2, 2, 3, 0
 	};
 };
\ No newline at end of file
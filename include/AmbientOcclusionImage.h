@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+enum class AmbientOcclusionImage : uint32_t
+{
+	eDepth,
+	eNormals,
+	eHiZ,
+	eRawAmbientOcclusion,
+	eBlurPing,
+	eBlurPong,
+	eHistory
+};
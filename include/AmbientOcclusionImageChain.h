@@ -0,0 +1,32 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <bit>
+#include <memory>
+#include <vector>
+
+#include "AmbientOcclusionImage.h"
+#include "AmbientOcclusionPass.h"
+#include "DeviceMemoryAllocator.h"
+#include "TransientImageDescription.h"
+#include "TransientImagePool.h"
+
+class AmbientOcclusionImageChain
+{
+public:
+	static constexpr vk::Format depthFormat{ vk::Format::eD32Sfloat };
+	static constexpr vk::Format normalsFormat{ vk::Format::eR16G16B16A16Sfloat };
+
+	AmbientOcclusionImageChain(const std::shared_ptr<DeviceMemoryAllocator>& deviceMemoryAllocator, const vk::Extent2D& extent);
+
+	static const std::vector<TransientImageDescription> describe(const vk::Device& vulkanLogicalDevice, const vk::Extent2D& extent);
+
+	const Image& getImage(const AmbientOcclusionImage ambientOcclusionImage) const;
+	const TransientMemoryStatistics getStatistics() const;
+
+private:
+	static const TransientImageDescription describeImage(const ImageCreateInfo& imageCreateInfo, const AmbientOcclusionPass firstPass, const AmbientOcclusionPass lastPass, const bool isAliasable = true);
+
+	std::unique_ptr<TransientImagePool> transientImagePool;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "FrameUniforms.h"
+#include "Random.h"
+
+class AmbientOcclusionKernel
+{
+public:
+	static const std::array<glm::vec4, FrameUniforms::maximumKernelSampleCount> generate(const uint32_t sampleCount, const uint64_t seed);
+};
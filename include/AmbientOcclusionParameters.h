@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+struct AmbientOcclusionParameters
+{
+	float radius{ 0.5f };
+	float bias{ 0.025f };
+	float intensity{ 1.0f };
+	uint32_t sampleCount{ 16 };
+};
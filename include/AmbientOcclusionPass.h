@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+enum class AmbientOcclusionPass : uint32_t
+{
+	eGeometry,
+	eHiZ,
+	eAmbientOcclusion,
+	eHorizontalBlur,
+	eVerticalBlur,
+	eTemporalResolve,
+	eComposite
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+
+#include "BindlessPushConstants.h"
+
+struct AmbientOcclusionPassRecordInfo
+{
+	vk::Pipeline computePipeline;
+	vk::PipelineLayout computePipelineLayout;
+	vk::DescriptorSet vulkanUniformDescriptorSet;
+	uint32_t uniformDynamicOffset;
+	vk::DescriptorSet vulkanBindlessDescriptorSet;
+	BindlessPushConstants bindlessPushConstants;
+	vk::Extent2D extent;
+	uint32_t workgroupSize{ 8 };
+};
\ No newline at end of file
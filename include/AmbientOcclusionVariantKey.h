@@ -0,0 +1,13 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+struct AmbientOcclusionVariantKey
+{
+	uint32_t sampleCount;
+	uint32_t stepCount;
+	uint32_t directionCount;
+
+	auto operator<=>(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) const = default;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BenchmarkScenario.h"
+
+struct BenchmarkConfiguration
+{
+	std::vector<BenchmarkScenario> scenarios;
+	double regressionThreshold = 0.1;
+	std::vector<uint32_t> qualityFrameIndices;
+	std::string referenceDirectory = "benchmarks/references";
+	std::string heatmapDirectory = "benchmark_heatmaps";
+	float heatmapScale = 8.0f;
+	double structuralSimilarityTolerance = 0.005;
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cassert>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+#include "BenchmarkConfiguration.h"
+
+class BenchmarkConfigurationParser
+{
+public:
+	explicit BenchmarkConfigurationParser(const char* benchmarkConfigurationFile);
+	const BenchmarkConfiguration getBenchmarkConfiguration() const;
+
+private:
+	void validateJSONBenchmarkConfigurationFile() const;
+	void expandScenarioMatrix() noexcept;
+	void parseQualitySettings() noexcept;
+
+	rapidjson::Document JSONDocument;
+	BenchmarkConfiguration benchmarkConfiguration;
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+#include "BenchmarkResult.h"
+
+class BenchmarkReport
+{
+public:
+	static void write(const std::vector<BenchmarkResult>& benchmarkResults, const std::filesystem::path& filePath);
+	static const std::vector<std::string> findRegressions(const std::vector<BenchmarkResult>& benchmarkResults, const std::string& baselineContents, const double regressionThreshold, const double structuralSimilarityTolerance);
+
+private:
+	static void compareStructuralSimilarity(std::vector<std::string>& regressions, const BenchmarkResult& benchmarkResult, const rapidjson::Value& baselineScenario, const double structuralSimilarityTolerance);
+	static void compareMetric(std::vector<std::string>& regressions, const std::string& metricName, const double milliseconds, const rapidjson::Value& baselineMetric, const double regressionThreshold);
+	static const rapidjson::Value* findMember(const rapidjson::Value& array, const std::string& name);
+};
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "GpuPassStatistics.h"
+#include "ImageQualityMetrics.h"
+
+struct BenchmarkResult
+{
+	std::string scenarioName;
+	uint32_t measuredFrameCount;
+	double cpuFramePercentile50Milliseconds;
+	double cpuFramePercentile95Milliseconds;
+	double cpuFramePercentile99Milliseconds;
+	std::vector<GpuPassStatistics> gpuPassStatistics;
+	uint32_t qualityFrameCount;
+	ImageQualityMetrics imageQuality;
+};
\ No newline at end of file
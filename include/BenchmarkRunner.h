@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "BenchmarkConfiguration.h"
+#include "BenchmarkResult.h"
+#include "CameraPath.h"
+#include "GraphicsInstance.h"
+#include "ImageQuality.h"
+#include "LuminanceImageFile.h"
+#include "Mesh.h"
+#include "MeshLodGenerator.h"
+#include "Percentile.h"
+#include "PipelineShaders.h"
+#include "RenderSettings.h"
+#include "SceneGenerator.h"
+#include "Shader.h"
+#include "ShaderCompiler.h"
+#include "ThreadPool.h"
+#include "Vertex.h"
+#include "Window.h"
+
+class BenchmarkRunner
+{
+public:
+	explicit BenchmarkRunner(const BenchmarkConfiguration& benchmarkConfiguration);
+
+	const std::vector<BenchmarkResult> run();
+
+private:
+	const BenchmarkResult runScenario(const BenchmarkScenario& benchmarkScenario);
+	const RenderSettings buildRenderSettings(const BenchmarkScenario& benchmarkScenario) const;
+	const Mesh buildMesh(const BenchmarkScenario& benchmarkScenario);
+	const CameraPath loadOrRecordCameraPath(const std::filesystem::path& cameraPathFile, const Mesh& mesh) const;
+	const ImageQualityMetrics measureImageQuality(GraphicsInstance& graphicsInstance, const BenchmarkScenario& benchmarkScenario, const uint32_t qualityLevel, const std::function<void(const uint32_t)>& drawFrame);
+	const LuminanceImage loadOrCaptureReferenceImage(GraphicsInstance& graphicsInstance, const BenchmarkScenario& benchmarkScenario, const uint32_t qualityLevel, const uint32_t frameIndex, const std::function<void(const uint32_t)>& drawFrame) const;
+	const LuminanceImage captureFrame(GraphicsInstance& graphicsInstance, const uint32_t frameIndex, const std::function<void(const uint32_t)>& drawFrame) const;
+	const PipelineShaders loadShaders(const vk::Device& vulkanLogicalDevice);
+	const std::shared_ptr<Shader> loadShader(const vk::Device& vulkanLogicalDevice, const ShaderSourceDescription& shaderSourceDescription);
+
+	const BenchmarkConfiguration benchmarkConfiguration;
+	const uint32_t recordedCameraPoseCount{ 360 };
+	ThreadPool threadPool;
+	const MeshLodGenerator meshLodGenerator;
+	ShaderCompiler shaderCompiler{ ShaderCompilerCreateInfo{} };
+	const ShaderSourceDescription vertexShaderSource{ .path = "shaders/shader.vert", .stage = vk::ShaderStageFlagBits::eVertex };
+	const ShaderSourceDescription geometryShaderSource{ .path = "shaders/geometry.frag", .stage = vk::ShaderStageFlagBits::eFragment };
+	const ShaderSourceDescription ambientOcclusionShaderSource{ .path = "shaders/ambientOcclusion.comp", .stage = vk::ShaderStageFlagBits::eCompute };
+	const ShaderSourceDescription forwardShaderSource{ .path = "shaders/shader.frag", .stage = vk::ShaderStageFlagBits::eFragment };
+	const std::vector<Vertex> quadVertices = {
+		{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+		{{0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
+		{{-0.5f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}
+	};
+	const std::vector<uint32_t> quadIndices = {
+		0, 1, 2, 2, 3, 0
+	};
+};
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct BenchmarkScenario
+{
+	std::string name;
+	std::string scene;
+	uint64_t sceneSeed;
+	int width;
+	int height;
+	uint32_t sampleCount;
+	std::string cameraPath;
+	uint32_t warmupFrameCount;
+	uint32_t measuredFrameCount;
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "BindlessDescriptorHeapCreateInfo.h"
+#include "BindlessDescriptorWrite.h"
+#include "BindlessResourceType.h"
+#include "DescriptorPool.h"
+#include "DescriptorSetLayout.h"
+#include "ExceptionChecker.h"
+#include "PendingSlotRelease.h"
+
+class BindlessDescriptorHeap
+{
+public:
+	explicit BindlessDescriptorHeap(const BindlessDescriptorHeapCreateInfo& bindlessDescriptorHeapCreateInfo);
+
+	static const bool isDescriptorIndexingSupported(const vk::PhysicalDeviceVulkan12Features& physicalDeviceVulkan12Features);
+	static void enableDescriptorIndexing(vk::PhysicalDeviceVulkan12Features& physicalDeviceVulkan12Features);
+
+	void beginFrame(const uint32_t frameIndex, const uint64_t frameNumber, const uint64_t completedFrameCount);
+	const uint32_t registerSampledImage(const vk::ImageView& vulkanImageView, const vk::Sampler& vulkanSampler, const vk::ImageLayout imageLayout);
+	const uint32_t registerStorageImage(const vk::ImageView& vulkanImageView);
+	const uint32_t registerStorageBuffer(const vk::Buffer& vulkanBuffer, const vk::DeviceSize offset, const vk::DeviceSize range);
+	void release(const BindlessResourceType resourceType, const uint32_t handle);
+
+	const vk::DescriptorSetLayout getVulkanDescriptorSetLayout() const;
+	const vk::DescriptorSet getVulkanDescriptorSet() const;
+	const uint32_t getCapacity(const BindlessResourceType resourceType) const;
+	const bool isDescriptorIndexingEnabled() const;
+
+private:
+	static constexpr uint32_t resourceTypeCount{ 3 };
+
+	static const vk::DescriptorType toDescriptorType(const BindlessResourceType resourceType);
+	void computeCapacities(const BindlessDescriptorHeapCreateInfo& bindlessDescriptorHeapCreateInfo);
+	void createDescriptorSetLayout(const vk::ShaderStageFlags& shaderStages);
+	void createDescriptorSets(const uint32_t frameCount);
+	const uint32_t acquireSlot(const BindlessResourceType resourceType);
+	const uint32_t registerDescriptor(const BindlessDescriptorWrite& bindlessDescriptorWrite);
+	void applyPendingWrites();
+	void writeDescriptor(const BindlessDescriptorWrite& bindlessDescriptorWrite, const vk::DescriptorSet& vulkanDescriptorSet) const;
+	void recycleReleasedSlots(const uint64_t completedFrameCount);
+
+	const vk::Device vulkanLogicalDevice;
+	const bool descriptorIndexingEnabled;
+	std::array<uint32_t, resourceTypeCount> capacities;
+	std::array<std::vector<uint32_t>, resourceTypeCount> freeSlots;
+	std::vector<PendingSlotRelease> pendingSlotReleases;
+	std::vector<BindlessDescriptorWrite> pendingWrites;
+	std::unique_ptr<DescriptorSetLayout> descriptorSetLayout;
+	std::unique_ptr<DescriptorPool> descriptorPool;
+	std::vector<vk::DescriptorSet> vulkanDescriptorSets;
+	uint32_t currentFrame{ 0 };
+	uint64_t frameNumber{ 0 };
+};
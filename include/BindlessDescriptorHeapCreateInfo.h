@@ -0,0 +1,19 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct BindlessDescriptorHeapCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::PhysicalDevice vulkanPhysicalDevice;
+	bool isDescriptorIndexingEnabled;
+	uint32_t frameCount;
+	vk::ShaderStageFlags shaderStages{ vk::ShaderStageFlagBits::eFragment };
+	uint32_t sampledImageCapacity{ 16384 };
+	uint32_t storageImageCapacity{ 1024 };
+	uint32_t storageBufferCapacity{ 1024 };
+	uint32_t fallbackCapacity{ 16 };
+	uint32_t reservedResourceCount{ 8 };
+};
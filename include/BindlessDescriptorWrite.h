@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "BindlessResourceType.h"
+
+struct BindlessDescriptorWrite
+{
+	BindlessResourceType resourceType;
+	uint32_t slot;
+	vk::DescriptorImageInfo descriptorImageInfo;
+	vk::DescriptorBufferInfo descriptorBufferInfo;
+	uint32_t pendingFrameMask;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+struct BindlessPushConstants
+{
+	static constexpr uint32_t resourceHandleCount{ 4 };
+	static constexpr uint32_t invalidResourceHandle{ UINT32_MAX };
+
+	std::array<uint32_t, resourceHandleCount> resourceHandles{ invalidResourceHandle, invalidResourceHandle, invalidResourceHandle, invalidResourceHandle };
+};
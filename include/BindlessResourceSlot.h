@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+enum class BindlessResourceSlot : uint32_t
+{
+	eNormals,
+	eAmbientOcclusion,
+	eAmbientOcclusionStorage
+};
\ No newline at end of file
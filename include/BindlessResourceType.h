@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+enum class BindlessResourceType : uint32_t
+{
+	eSampledImage,
+	eStorageImage,
+	eStorageBuffer
+};
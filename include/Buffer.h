@@ -2,72 +2,64 @@
 
 #define VULKAN_HPP_NO_CONSTRUCTORS
 #include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
 
-#include "CommandBuffer.h"
-#include "MemoryProperties.h"
-#include "GraphicsQueue.h"
+#include "BufferCreateInfo.h"
+#include "BufferRange.h"
+#include "DeviceMemoryAllocator.h"
+#include "ExceptionChecker.h"
+#include "PendingRangeRelease.h"
+#include "RetiredBuffer.h"
+#include "TlsfAllocator.h"
+#include "UploadManager.h"
 
 class Buffer
 {
 public:
+	void beginFrame(const uint64_t frameNumber, const uint64_t completedFrameCount);
+	void release(const uint32_t rangeHandle);
+
+	const BufferRange& getRange(const uint32_t rangeHandle) const;
 	const vk::Buffer getVulkanBuffer() const;
+	const uint64_t getUploadTimelineValue() const;
+	const uint64_t getElementCapacity() const;
 
 protected:
-	Buffer(const vk::Device& vulkanLogicalDevice);
+	Buffer(const BufferCreateInfo& bufferCreateInfo, const vk::DeviceSize elementSize, const vk::BufferUsageFlags& bufferUsage);
 	virtual ~Buffer();
 
-	template<typename T>
-	void createStagingData(const std::vector<T>& content, const vk::PhysicalDevice& vulkanPhysicalDevice)
-	{
-		const vk::BufferUsageFlags stagingBufferUsage{ vk::BufferUsageFlagBits::eTransferSrc };
-		vulkanStagingBuffer = createVulkanBuffer<T>(content, stagingBufferUsage);
-		const vk::MemoryPropertyFlags stagingMemoryPropertyFlags{ vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent };
-		vulkanStagingBufferMemory = createVulkanBufferMemory(vulkanPhysicalDevice, stagingMemoryPropertyFlags);
-		bindBufferMemory(vulkanStagingBuffer, vulkanStagingBufferMemory);
-	}
-
-	template <typename T>
-	vk::Buffer createVulkanBuffer(const std::vector<T>& content, const vk::BufferUsageFlags& bufferUsage)
-	{
-		vulkanBufferCreateInfo = buildBufferCreateInfo<T>(content, bufferUsage);
-		return vulkanLogicalDevice.createBuffer(vulkanBufferCreateInfo);
-	}
-
-	vk::DeviceMemory createVulkanBufferMemory(const vk::PhysicalDevice& vulkanPhysicalDevice, const vk::MemoryPropertyFlags& memoryPropertyFlags);
-
-	void bindBufferMemory(vk::Buffer& buffer, vk::DeviceMemory& memory);
-	
 	template <typename T>
-	void copyFromCPUToStagingMemory(const std::vector<T>& content)
+	const uint32_t allocate(const std::vector<T>& content)
 	{
-		const vk::DeviceSize memoryOffset{ 0 };
-		void* data{ vulkanLogicalDevice.mapMemory(vulkanStagingBufferMemory, memoryOffset, vulkanBufferCreateInfo.size) };
-		std::memcpy(data, content.data(), static_cast<size_t>(vulkanBufferCreateInfo.size));
-		vulkanLogicalDevice.unmapMemory(vulkanStagingBufferMemory);
+		const uint32_t rangeHandle{ reserveRange(static_cast<uint32_t>(content.size())) };
+		upload(ranges[rangeHandle], content.data());
+		return rangeHandle;
 	}
-	
-	void copyFromStagingToDeviceMemory(const vk::CommandPool& vulkanCommandPool, const std::shared_ptr<GraphicsQueue>& graphicsQueue);
 
-	vk::Buffer vulkanBuffer;
-	vk::DeviceMemory vulkanBufferMemory;
-	
 private:
+	const uint32_t reserveRange(const uint32_t elementCount);
+	void upload(const BufferRange& range, const void* data);
+	void createVulkanBuffer(const uint64_t elementCapacity);
+	const vk::BufferCreateInfo buildBufferCreateInfo(const uint64_t elementCapacity) const;
+	void relocate(const uint64_t elementCapacity);
+	void releasePendingRanges(const uint64_t completedFrameCount);
+	void destroyRetiredBuffers(const uint64_t completedFrameCount);
+	const bool isFragmented() const;
 
-	const vk::MemoryAllocateInfo buildMemoryAllocateInfo(const vk::MemoryRequirements& memoryRequirements, const uint32_t memoryTypeIndex) const;
-
-	template <typename T>
-	const vk::BufferCreateInfo buildBufferCreateInfo(const std::vector<T>& content, const vk::BufferUsageFlags& bufferUsage) const
-	{
-		return vk::BufferCreateInfo{
-			.size = sizeof(content[0]) * content.size(),
-			.usage = bufferUsage,
-			.sharingMode = vk::SharingMode::eExclusive
-		};
-	}
-
-	vk::Buffer vulkanStagingBuffer;
-	vk::DeviceMemory vulkanStagingBufferMemory;
-	vk::BufferCreateInfo vulkanBufferCreateInfo;
+	vk::Buffer vulkanBuffer;
+	MemoryAllocation bufferMemoryAllocation{};
+	std::unique_ptr<TlsfAllocator> tlsfAllocator;
+	std::vector<BufferRange> ranges;
+	std::vector<uint32_t> unusedRangeHandles;
+	std::vector<PendingRangeRelease> pendingRangeReleases;
+	std::vector<RetiredBuffer> retiredBuffers;
+	const vk::DeviceSize elementSize;
+	const vk::BufferUsageFlags bufferUsage;
+	uint64_t elementCapacity{ 0 };
+	uint64_t frameNumber{ 0 };
+	uint64_t uploadTimelineValue{ 0 };
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<UploadManager> uploadManager;
 	const vk::Device vulkanLogicalDevice;
-
 };
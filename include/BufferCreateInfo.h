@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "DeviceMemoryAllocator.h"
+#include "UploadManager.h"
+
+struct BufferCreateInfo
+{
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<UploadManager> uploadManager;
+	uint64_t initialElementCount{ 64 * 1024 };
+};
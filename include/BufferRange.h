@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+struct BufferRange
+{
+	uint32_t firstElement;
+	uint32_t elementCount;
+	uint32_t handle;
+	bool isAllocated;
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+class Camera
+{
+public:
+	Camera(const glm::vec3& position, const glm::vec3& target, const float verticalFieldOfView);
+
+	const glm::mat4 getViewMatrix() const;
+	const glm::mat4 getProjectionMatrix(const float aspectRatio) const;
+	void lookAt(const glm::vec3& position, const glm::vec3& target);
+	const glm::vec3 getPosition() const;
+	const float getVerticalFieldOfView() const;
+
+private:
+	glm::vec3 position;
+	glm::vec3 target;
+	const glm::vec3 up{ 0.0f, 1.0f, 0.0f };
+	float verticalFieldOfView;
+	const float nearPlane{ 0.1f };
+	const float farPlane{ 1000.0f };
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cassert>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+#include "CameraPose.h"
+
+class CameraPath
+{
+public:
+	static const CameraPath parse(const std::string& cameraPathFile);
+	static const CameraPath recordOrbit(const glm::vec3& center, const float radius, const float height, const uint32_t poseCount);
+
+	void addPose(const CameraPose& cameraPose);
+	void save(const std::filesystem::path& filePath) const;
+
+	const CameraPose& getPose(const uint32_t frameIndex) const;
+	const uint32_t getPoseCount() const;
+
+private:
+	static const glm::vec3 parseVector(const rapidjson::Value& value);
+
+	std::vector<CameraPose> cameraPoses;
+};
\ No newline at end of file
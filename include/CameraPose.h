@@ -0,0 +1,9 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+struct CameraPose
+{
+	glm::vec3 position;
+	glm::vec3 target;
+};
\ No newline at end of file
@@ -4,21 +4,26 @@
 #include <vulkan/vulkan.hpp>
 #include "CommandPool.h"
 #include "ExceptionChecker.h"
-#include "CommandBufferCopyInfo.h"
 #include "CommandBufferRecordInfo.h"
+#include "AmbientOcclusionPassRecordInfo.h"
+#include "ParallelCommandRecorder.h"
+#include "ThreadPool.h"
 
 class CommandBuffer
 {
 public:
 	CommandBuffer(const vk::Device& vulkanLogicalDevice, const vk::CommandPool& vulkanCommandPool, const int maxFramesInFlight);
-	void copy(const CommandBufferCopyInfo& commandBufferCopyInfo);
-	void record(const CommandBufferRecordInfo& commandBufferRecordInfo);
+	static void recordGeometryPass(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo);
+	static void recordAmbientOcclusionPass(const vk::CommandBuffer& vulkanCommandBuffer, const AmbientOcclusionPassRecordInfo& ambientOcclusionPassRecordInfo);
+	static void recordForwardPass(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo, ParallelCommandRecorder& parallelCommandRecorder, ThreadPool& threadPool);
 	void reset(const int frameIndex);
 
 	const vk::CommandBuffer getVulkanCommandBuffer(const int frameIndex) const;
 
 private:
 	const vk::CommandBufferAllocateInfo buildCommandBufferAllocateInfo(const vk::CommandPool& vulkanCommandPool, uint32_t commandBufferCount);
+	static void recordForwardDraws(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo, const size_t firstDraw, const size_t lastDraw);
+	static const vk::Viewport buildViewport(const vk::Extent2D& extent);
 
 	std::vector<vk::CommandBuffer> vulkanCommandBuffers;
 };
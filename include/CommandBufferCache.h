@@ -0,0 +1,30 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "CommandBufferCacheEntry.h"
+#include "CommandBufferCacheKey.h"
+#include "CommandBufferCacheStatistics.h"
+#include "ExceptionChecker.h"
+
+class CommandBufferCache
+{
+public:
+	explicit CommandBufferCache(const uint32_t slotCount);
+
+	void resize(const uint32_t slotCount);
+	void invalidate();
+	const std::optional<std::vector<vk::CommandBuffer>> find(const uint32_t slotIndex, const CommandBufferCacheKey& key);
+	void store(const uint32_t slotIndex, const CommandBufferCacheKey& key, const std::vector<vk::CommandBuffer>& vulkanCommandBuffers);
+
+	const uint32_t getSlotCount() const;
+	const CommandBufferCacheStatistics getStatistics() const;
+
+private:
+	std::vector<std::optional<CommandBufferCacheEntry>> slots;
+	CommandBufferCacheStatistics statistics{};
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+#include "CommandBufferCacheKey.h"
+
+struct CommandBufferCacheEntry
+{
+	CommandBufferCacheKey key;
+	std::vector<vk::CommandBuffer> vulkanCommandBuffers;
+};
\ No newline at end of file
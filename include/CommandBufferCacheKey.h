@@ -0,0 +1,14 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct CommandBufferCacheKey
+{
+	vk::DescriptorSet vulkanUniformDescriptorSet;
+	uint32_t uniformDynamicOffset;
+	vk::DescriptorSet vulkanBindlessDescriptorSet;
+
+	bool operator==(const CommandBufferCacheKey& commandBufferCacheKey) const = default;
+};
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct CommandBufferCacheStatistics
+{
+	uint64_t recordedFrameCount;
+	uint64_t reusedFrameCount;
+	uint64_t invalidationCount;
+};
\ No newline at end of file
@@ -2,21 +2,26 @@
 
 #define VULKAN_HPP_NO_CONSTRUCTORS
 #include <vulkan/vulkan.hpp>
+#include <span>
+
+#include "BindlessPushConstants.h"
+#include "IndexedDraw.h"
 
 struct CommandBufferRecordInfo
 {
 	vk::RenderPassBeginInfo renderPassBeginInfo;
 	vk::Pipeline graphicsPipeline;
+	vk::PipelineLayout graphicsPipelineLayout;
 	vk::Buffer vulkanVertexBuffer;
 	vk::Buffer vulkanIndexBuffer;
-	unsigned int frameIndex;
-	size_t indexCount;
+	vk::DescriptorSet vulkanUniformDescriptorSet;
+	uint32_t uniformDynamicOffset;
+	vk::DescriptorSet vulkanBindlessDescriptorSet;
+	BindlessPushConstants bindlessPushConstants;
+	std::span<const IndexedDraw> draws;
 	vk::IndexType indexType;
 	uint32_t firstBinding = 0;
 	uint32_t bindingCount = 1;
-	uint32_t instanceCount = 1;
-	uint32_t firstIndex = 0;
-	uint32_t firstInstance = 0;
-	uint32_t vertexOffset = 0;
 	vk::DeviceSize offset = 0;
+	vk::QueryPipelineStatisticFlags pipelineStatistics = {};
 };
\ No newline at end of file
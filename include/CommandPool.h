@@ -7,13 +7,15 @@
 class CommandPool
 {
 public:
-	CommandPool(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t> graphicsFamilyIndex);
+	CommandPool(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t> graphicsFamilyIndex, const vk::CommandPoolCreateFlags flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
 	~CommandPool();
 
+	void reset();
+
 	const vk::CommandPool getVulkanCommandPool() const;
 
 private:
-	const vk::CommandPoolCreateInfo buildCommandPoolCreateInfo(const std::optional<uint32_t> graphicsFamilyIndex) const;
+	const vk::CommandPoolCreateInfo buildCommandPoolCreateInfo(const std::optional<uint32_t> graphicsFamilyIndex, const vk::CommandPoolCreateFlags flags) const;
 
 	vk::CommandPool vulkanCommandPool;
 	const vk::Device vulkanLogicalDevice;
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+struct CommandRecordingStatistics
+{
+	uint64_t recordedFrameCount;
+	uint64_t itemCount;
+	uint64_t secondaryCommandBufferCount;
+	uint32_t threadCount;
+	double recordingMilliseconds;
+};
\ No newline at end of file
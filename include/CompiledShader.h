@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+struct CompiledShader
+{
+	std::vector<uint32_t> spirv;
+	std::vector<std::filesystem::path> dependencies;
+	uint64_t hash;
+	bool isCached;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include "ComputePipelineCreateInfo.h"
+#include "ExceptionChecker.h"
+
+class ComputePipeline
+{
+public:
+	explicit ComputePipeline(const ComputePipelineCreateInfo& computePipelineCreateInfo);
+	~ComputePipeline();
+
+	const vk::Pipeline getVulkanPipeline() const;
+	const vk::PipelineLayout getVulkanPipelineLayout() const;
+
+private:
+	const vk::PipelineLayoutCreateInfo buildPipelineLayoutCreateInfo(const std::vector<vk::DescriptorSetLayout>& descriptorSetLayouts, const std::vector<vk::PushConstantRange>& pushConstantRanges) const;
+
+	const vk::Device vulkanLogicalDevice;
+	vk::PipelineLayout pipelineLayout;
+	vk::Pipeline pipeline;
+};
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+struct ComputePipelineCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::PipelineCache vulkanPipelineCache;
+	vk::PipelineShaderStageCreateInfo shaderStage;
+	std::vector<vk::DescriptorSetLayout> descriptorSetLayouts;
+	std::vector<vk::PushConstantRange> pushConstantRanges;
+};
\ No newline at end of file
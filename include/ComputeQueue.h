@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Queue.h"
+
+class ComputeQueue : public Queue
+{
+public:
+	ComputeQueue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex);
+};
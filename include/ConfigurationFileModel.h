@@ -1,13 +1,25 @@
 #pragma once
 
+#include <string>
+
 struct WindowConfigurationModel
 {
 	int width = 800;
 	int height = 600;
 };
 
+struct RenderingConfigurationModel
+{
+	bool cacheCommandBuffers = false;
+	int framesInFlight = 2;
+	std::string presentMode = "mailbox";
+	double targetFrameRate = 0.0;
+	bool profileGpu = false;
+};
+
 struct ConfigurationFileModel
 {
 	WindowConfigurationModel window;
+	RenderingConfigurationModel rendering;
 };
 
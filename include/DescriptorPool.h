@@ -0,0 +1,21 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+class DescriptorPool
+{
+public:
+	DescriptorPool(const vk::Device& vulkanLogicalDevice, const std::vector<vk::DescriptorPoolSize>& descriptorPoolSizes, const uint32_t maxSets, const vk::DescriptorPoolCreateFlags& descriptorPoolCreateFlags = {});
+	~DescriptorPool();
+
+	const vk::DescriptorSet allocate(const vk::DescriptorSetLayout& vulkanDescriptorSetLayout) const;
+	const vk::DescriptorPool getVulkanDescriptorPool() const;
+
+private:
+	const vk::DescriptorPoolCreateInfo buildDescriptorPoolCreateInfo(const std::vector<vk::DescriptorPoolSize>& descriptorPoolSizes, const uint32_t maxSets, const vk::DescriptorPoolCreateFlags& descriptorPoolCreateFlags) const;
+
+	vk::DescriptorPool vulkanDescriptorPool;
+	const vk::Device vulkanLogicalDevice;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+class DescriptorSetLayout
+{
+public:
+	DescriptorSetLayout(const vk::Device& vulkanLogicalDevice, const std::vector<vk::DescriptorSetLayoutBinding>& descriptorSetLayoutBindings, const vk::DescriptorSetLayoutCreateFlags& descriptorSetLayoutCreateFlags = {},
+		const std::vector<vk::DescriptorBindingFlags>& descriptorBindingFlags = {});
+	~DescriptorSetLayout();
+
+	const vk::DescriptorSetLayout getVulkanDescriptorSetLayout() const;
+
+private:
+	const vk::DescriptorSetLayoutCreateInfo buildDescriptorSetLayoutCreateInfo(const std::vector<vk::DescriptorSetLayoutBinding>& descriptorSetLayoutBindings, const vk::DescriptorSetLayoutCreateFlags& descriptorSetLayoutCreateFlags,
+		const vk::DescriptorSetLayoutBindingFlagsCreateInfo* descriptorSetLayoutBindingFlagsCreateInfo) const;
+
+	vk::DescriptorSetLayout vulkanDescriptorSetLayout;
+	const vk::Device vulkanLogicalDevice;
+};
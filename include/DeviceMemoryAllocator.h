@@ -0,0 +1,48 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "DeviceMemoryAllocatorCreateInfo.h"
+#include "MemoryAllocation.h"
+#include "MemoryBlock.h"
+#include "MemoryProperties.h"
+#include "MemoryStatistics.h"
+
+class DeviceMemoryAllocator
+{
+public:
+	explicit DeviceMemoryAllocator(const DeviceMemoryAllocatorCreateInfo& deviceMemoryAllocatorCreateInfo);
+
+	const MemoryAllocation allocate(const vk::MemoryRequirements& memoryRequirements, const vk::MemoryPropertyFlags& memoryPropertyFlags, const MemoryResourceType memoryResourceType, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags = {});
+	const MemoryAllocation allocateBufferMemory(const vk::Buffer& vulkanBuffer, const vk::MemoryPropertyFlags& memoryPropertyFlags, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags = {});
+	const MemoryAllocation allocateImageMemory(const vk::Image& vulkanImage, const vk::MemoryPropertyFlags& memoryPropertyFlags, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags = {});
+	void free(const MemoryAllocation& memoryAllocation);
+
+	const MemoryStatistics getStatistics() const;
+	const vk::MemoryPropertyFlags getMemoryPropertyFlags(const uint32_t memoryTypeIndex) const;
+	const vk::Device getVulkanLogicalDevice() const;
+
+private:
+	std::optional<MemoryAllocation> allocateFromMemoryType(const uint32_t memoryTypeIndex, const vk::MemoryRequirements& memoryRequirements, const MemoryResourceType memoryResourceType);
+	const MemoryAllocation allocateFromMemoryBlock(const uint32_t memoryBlockIndex, const vk::MemoryRequirements& memoryRequirements, const TlsfAllocation& tlsfAllocation) const;
+	const uint32_t createMemoryBlock(const uint32_t memoryTypeIndex, const MemoryResourceType memoryResourceType, const vk::DeviceSize size, const bool isDedicated);
+	std::optional<uint32_t> tryCreateMemoryBlock(const uint32_t memoryTypeIndex, const MemoryResourceType memoryResourceType, const vk::DeviceSize size, const bool isDedicated);
+	const bool hasOtherEmptyMemoryBlock(const uint32_t memoryBlockIndex) const;
+	const vk::DeviceSize computeBlockSize(const uint32_t memoryTypeIndex) const;
+	const bool fitsInMemoryHeap(const uint32_t memoryTypeIndex, const vk::DeviceSize size) const;
+
+	const vk::Device vulkanLogicalDevice;
+	const vk::PhysicalDevice vulkanPhysicalDevice;
+	vk::PhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
+	uint32_t maxMemoryAllocationCount;
+	vk::DeviceSize preferredBlockSize;
+	std::vector<std::unique_ptr<MemoryBlock>> memoryBlocks;
+	std::vector<vk::DeviceSize> memoryHeapUsages;
+	uint32_t activeMemoryBlockCount{ 0 };
+	mutable std::mutex memoryBlocksMutex;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+
+struct DeviceMemoryAllocatorCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::PhysicalDevice vulkanPhysicalDevice;
+	vk::DeviceSize preferredBlockSize{ 64ull * 1024 * 1024 };
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+struct EdgeCollapse
+{
+	float cost;
+	uint32_t from;
+	uint32_t to;
+	uint32_t fromVersion;
+	uint32_t toVersion;
+
+	bool operator>(const EdgeCollapse& edgeCollapse) const
+	{
+		return cost > edgeCollapse.cost;
+	}
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include "DeviceMemoryAllocator.h"
+#include "FrameCaptureCreateInfo.h"
+#include "LuminanceImage.h"
+#include "MemoryAllocation.h"
+
+class FrameCapture
+{
+public:
+	explicit FrameCapture(const FrameCaptureCreateInfo& frameCaptureCreateInfo);
+	~FrameCapture();
+
+	void request(const vk::Extent2D& extent);
+	void record(const vk::CommandBuffer& vulkanCommandBuffer, const vk::Image& vulkanImage, const vk::Extent2D& extent);
+	const std::optional<LuminanceImage> read();
+
+	const bool isRequested() const;
+
+private:
+	void createVulkanBuffer(const vk::Extent2D& extent);
+	void destroyVulkanBuffer();
+	const vk::BufferImageCopy buildBufferImageCopy() const;
+	const bool isBlueFirst() const;
+
+	static constexpr uint32_t bytesPerPixel{ 4 };
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	const vk::Format format;
+	vk::Buffer vulkanBuffer;
+	MemoryAllocation memoryAllocation;
+	vk::Extent2D bufferExtent{ 0, 0 };
+	bool isCaptureRequested{ false };
+	bool isCaptureRecorded{ false };
+};
\ No newline at end of file
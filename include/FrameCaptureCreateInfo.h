@@ -0,0 +1,13 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+
+#include "DeviceMemoryAllocator.h"
+
+struct FrameCaptureCreateInfo
+{
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	vk::Format format;
+};
\ No newline at end of file
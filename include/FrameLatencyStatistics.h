@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+struct FrameLatencyStatistics
+{
+	uint64_t frameCount;
+	double averageFrameMilliseconds;
+	double averageInputToPresentMilliseconds;
+	double maximumInputToPresentMilliseconds;
+	double averageSubmitToCompletionMilliseconds;
+	double maximumSubmitToCompletionMilliseconds;
+};
\ No newline at end of file
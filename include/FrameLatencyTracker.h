@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+
+#include "FrameLatencyStatistics.h"
+#include "FrameTimestamps.h"
+#include "TimelineSemaphore.h"
+
+class FrameLatencyTracker
+{
+public:
+	explicit FrameLatencyTracker(const TimelineSemaphore& timelineSemaphore);
+	~FrameLatencyTracker();
+
+	void addFrame(const FrameTimestamps& frameTimestamps);
+	const FrameLatencyStatistics getStatistics() const;
+
+private:
+	void runCompletionWaiter();
+	void addCompletion(const FrameTimestamps& frameTimestamps, const std::chrono::steady_clock::time_point completionTime);
+
+	const TimelineSemaphore& timelineSemaphore;
+	const uint64_t completionPollTimeout{ 100000000 };
+	std::queue<FrameTimestamps> pendingFrames;
+	mutable std::mutex mutex;
+	std::condition_variable pendingFramesCondition;
+	std::atomic<bool> isStopping{ false };
+	std::optional<std::chrono::steady_clock::time_point> firstPresentTime;
+	std::chrono::steady_clock::time_point lastPresentTime;
+	uint64_t presentedFrameCount{ 0 };
+	uint64_t completedFrameCount{ 0 };
+	double inputToPresentMilliseconds{ 0.0 };
+	double maximumInputToPresentMilliseconds{ 0.0 };
+	double submitToCompletionMilliseconds{ 0.0 };
+	double maximumSubmitToCompletionMilliseconds{ 0.0 };
+	std::thread completionWaiter;
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <thread>
+
+#include "TraceZone.h"
+
+class FramePacer
+{
+public:
+	explicit FramePacer(const std::optional<double>& targetFrameRate);
+
+	void waitForNextFrame();
+
+private:
+	const std::optional<std::chrono::steady_clock::duration> framePeriod;
+	const std::chrono::steady_clock::duration spinDuration{ std::chrono::milliseconds(1) };
+	std::optional<std::chrono::steady_clock::time_point> deadline;
+};
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+struct FrameTimestamps
+{
+	uint64_t completionValue;
+	std::chrono::steady_clock::time_point inputTime;
+	std::chrono::steady_clock::time_point submitTime;
+	std::chrono::steady_clock::time_point presentTime;
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+
+struct FrameUniforms
+{
+	static constexpr uint32_t maximumKernelSampleCount{ 16 };
+
+	glm::mat4 view;
+	glm::mat4 projection;
+	glm::vec4 cameraPosition;
+	glm::vec4 ambientOcclusionParameters;
+	std::array<glm::vec4, maximumKernelSampleCount> ambientOcclusionKernel;
+};
@@ -8,12 +8,13 @@ class Framebuffer
 {
 public:
 	Framebuffer(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass, const vk::ImageView& vulkanSwapChainImageView, const vk::Extent2D& swapChainExtent);
+	Framebuffer(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass, const std::vector<vk::ImageView>& vulkanImageViews, const vk::Extent2D& extent);
 	~Framebuffer();
 
 	const vk::Framebuffer getVulkanFramebuffer() const;
 
 private:
-	const vk::FramebufferCreateInfo buildFramebufferCreateInfo(const vk::RenderPass& vulkanRenderPass, const vk::ImageView& vulkanSwapChainImageView, const vk::Extent2D& swapChainExtent) const;
+	const vk::FramebufferCreateInfo buildFramebufferCreateInfo(const vk::RenderPass& vulkanRenderPass, const std::vector<vk::ImageView>& vulkanImageViews, const vk::Extent2D& extent) const;
 
 	const vk::Device vulkanLogicalDevice;
 	vk::Framebuffer vulkanFramebuffer;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+
+class Frustum
+{
+public:
+	explicit Frustum(const glm::mat4& viewProjection);
+
+	const bool intersectsSphere(const glm::vec3& center, const float radius) const;
+	const std::array<glm::vec4, 6>& getPlanes() const;
+
+private:
+	const glm::vec4 normalizePlane(const glm::vec4& plane) const;
+
+	std::array<glm::vec4, 6> planes;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <vector>
+
+#include "Mesh.h"
+#include "Scene.h"
+
+struct GeneratedScene
+{
+	std::vector<Mesh> meshes;
+	Scene scene;
+};
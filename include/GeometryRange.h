@@ -0,0 +1,16 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "MeshLod.h"
+
+struct GeometryRange
+{
+	uint32_t vertexRangeHandle;
+	uint32_t indexRangeHandle;
+	std::vector<MeshLod> lods;
+	glm::vec3 boundsCenter{ 0.0f };
+	float boundsRadius{ 0.0f };
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <array>
+
+class GeometryRenderPass
+{
+public:
+	GeometryRenderPass(const vk::Device& vulkanLogicalDevice, const vk::Format normalsFormat, const vk::Format depthFormat);
+	~GeometryRenderPass();
+
+	const vk::RenderPassBeginInfo createRenderPassBeginInfo(const vk::Framebuffer& vulkanFramebuffer, const vk::Extent2D& extent) const;
+	const vk::RenderPass getVulkanRenderPass() const;
+
+private:
+	const vk::AttachmentDescription createAttachmentDescription(const vk::Format format, const vk::ImageLayout layout) const;
+	const vk::SubpassDependency createSubpassDependency() const;
+
+	const vk::Device vulkanLogicalDevice;
+	const std::array<vk::ClearValue, 2> clearValues{
+		vk::ClearValue{ .color = vk::ClearColorValue(std::array<float, 4>{ 0.0f, 0.0f, 0.0f, 0.0f }) },
+		vk::ClearValue{ .depthStencil = vk::ClearDepthStencilValue{ .depth = 1.0f, .stencil = 0 } }
+	};
+	vk::RenderPass vulkanRenderPass;
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "RenderGraphQueue.h"
+
+struct GpuPassStatistics
+{
+	std::string name;
+	RenderGraphQueue queue;
+	size_t sampleCount;
+	double minimumMilliseconds;
+	double averageMilliseconds;
+	double percentile50Milliseconds;
+	double percentile95Milliseconds;
+	double percentile99Milliseconds;
+	double maximumMilliseconds;
+	double averageFragmentShaderInvocations;
+	double averageComputeShaderInvocations;
+};
\ No newline at end of file
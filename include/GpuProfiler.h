@@ -0,0 +1,88 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ExceptionChecker.h"
+#include "GpuPassStatistics.h"
+#include "GpuProfilerCreateInfo.h"
+#include "Percentile.h"
+#include "RenderGraphQueue.h"
+#include "Tracer.h"
+
+class GpuProfiler
+{
+public:
+	explicit GpuProfiler(const GpuProfilerCreateInfo& gpuProfilerCreateInfo);
+	~GpuProfiler();
+
+	const uint32_t addPass(const std::string& name, const RenderGraphQueue queue);
+	void beginFrame(const uint32_t frameIndex);
+	void readAllFrames();
+	void resetStatistics();
+	void beginPass(const vk::CommandBuffer& vulkanCommandBuffer, const uint32_t passIndex);
+	void endPass(const vk::CommandBuffer& vulkanCommandBuffer, const uint32_t passIndex) const;
+	void writeCsv(const std::filesystem::path& filePath) const;
+	void writeJson(const std::filesystem::path& filePath) const;
+
+	const std::vector<GpuPassStatistics> getStatistics() const;
+	const bool isPipelineStatisticsEnabled() const;
+	const vk::QueryPipelineStatisticFlags getGraphicsPipelineStatistics() const;
+
+private:
+	struct Sample
+	{
+		double milliseconds;
+		uint64_t fragmentShaderInvocations;
+		uint64_t computeShaderInvocations;
+	};
+
+	struct ProfiledPass
+	{
+		std::string name;
+		RenderGraphQueue queue;
+		bool isTimestampSupported;
+		bool isRecorded;
+		std::deque<Sample> samples;
+	};
+
+	struct FrameQueryPools
+	{
+		vk::QueryPool timestampQueryPool;
+		vk::QueryPool graphicsStatisticsQueryPool;
+		vk::QueryPool computeStatisticsQueryPool;
+		bool isPending;
+		int64_t beginCpuNanoseconds;
+	};
+
+	const uint64_t buildTimestampMask(const uint32_t timestampValidBits) const;
+	const vk::QueryPool createQueryPool(const vk::QueryType queryType, const vk::QueryPipelineStatisticFlags pipelineStatistics) const;
+	void readFrame(const uint32_t frameIndex);
+	const bool readTimestamps(const FrameQueryPools& frameQueryPool, const uint32_t passIndex, int64_t& startNanoseconds, int64_t& endNanoseconds) const;
+	void readPipelineStatistics(const FrameQueryPools& frameQueryPool, const uint32_t passIndex, Sample& sample) const;
+	const GpuPassStatistics buildStatistics(const ProfiledPass& profiledPass) const;
+	const vk::QueryPool getStatisticsQueryPool(const FrameQueryPools& frameQueryPool, const RenderGraphQueue queue) const;
+	const std::string getQueueName(const RenderGraphQueue queue) const;
+
+	const vk::Device vulkanLogicalDevice;
+	const uint32_t maximumPassCount;
+	const size_t sampleCount;
+	const bool isPipelineStatisticsQueryEnabled;
+	const vk::QueryPipelineStatisticFlags graphicsPipelineStatistics{ vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations | vk::QueryPipelineStatisticFlagBits::eComputeShaderInvocations };
+	double timestampPeriod;
+	uint64_t graphicsTimestampMask;
+	uint64_t computeTimestampMask;
+	std::vector<FrameQueryPools> frameQueryPools;
+	std::vector<ProfiledPass> profiledPasses;
+	uint32_t currentFrameIndex{ 0 };
+};
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <optional>
+
+struct GpuProfilerCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::PhysicalDevice vulkanPhysicalDevice;
+	uint32_t graphicsFamilyIndex;
+	std::optional<uint32_t> computeFamilyIndex;
+	uint32_t frameCount;
+	bool isPipelineStatisticsEnabled{ false };
+	uint32_t maximumPassCount{ 32 };
+	size_t sampleCount{ 256 };
+};
\ No newline at end of file
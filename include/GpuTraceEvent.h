@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct GpuTraceEvent
+{
+	std::string lane;
+	std::string name;
+	int64_t startNanoseconds;
+	int64_t endNanoseconds;
+};
\ No newline at end of file
@@ -19,12 +19,30 @@ public:
 
 	void createWindowSurface(GLFWwindow* glfwWindow);
 	void selectPhysicalDevice();
-	void createLogicalDevice(const WindowSize& framebufferSize, const std::vector<Vertex>& vertices, const std::vector<uint16_t>& indices);
-	void createGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders);
-	void drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	void createLogicalDevice(const WindowSize& framebufferSize, const Mesh& mesh, const RenderSettings& renderSettings);
+	void createPipelines(const PipelineShaders& pipelineShaders);
+	void drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const std::chrono::steady_clock::time_point inputTime);
 	void waitIdle();
+	void setAmbientOcclusionQuality(const uint32_t qualityLevel);
+	void setCameraPose(const glm::vec3& position, const glm::vec3& target);
+	void resetGpuProfile();
+	void requestFrameCapture();
+	const std::optional<LuminanceImage> readFrameCapture();
 
 	const vk::Device getVulkanLogicalDevice() const;
+	const MemoryStatistics getMemoryStatistics() const;
+	const UploadStatistics getUploadStatistics() const;
+	const TransientMemoryStatistics getTransientMemoryStatistics() const;
+	const std::string getRenderGraphSchedule() const;
+	const CommandRecordingStatistics getCommandRecordingStatistics() const;
+	const CommandBufferCacheStatistics getCommandBufferCacheStatistics() const;
+	const PipelineCacheStatistics getPipelineCacheStatistics() const;
+	const FrameLatencyStatistics getFrameLatencyStatistics() const;
+	const std::vector<GpuPassStatistics> getGpuPassStatistics() const;
+	void writeGpuProfile(const std::filesystem::path& csvFilePath, const std::filesystem::path& jsonFilePath) const;
+	const vk::PresentModeKHR getPresentMode() const;
+	const uint32_t getAmbientOcclusionQualityLevelCount() const;
+	const std::optional<uint32_t> findAmbientOcclusionQualityLevel(const uint32_t sampleCount) const;
 
 private:
 	void createVulkanInstance(const std::string& applicationName);
@@ -13,19 +13,19 @@ public:
 	~GraphicsPipeline();
 
 	const vk::Pipeline getVulkanPipeline() const;
+	const vk::PipelineLayout getVulkanPipelineLayout() const;
 
 private:
-	const vk::PipelineVertexInputStateCreateInfo buildPipelineVertexInputStateCreateInfo(const vk::VertexInputBindingDescription& vertexBindingDescription, const std::array<vk::VertexInputAttributeDescription, 2>&  vertexAttributeDescriptions) const;
+	const vk::PipelineVertexInputStateCreateInfo buildPipelineVertexInputStateCreateInfo(const vk::VertexInputBindingDescription& vertexBindingDescription, const std::array<vk::VertexInputAttributeDescription, 3>&  vertexAttributeDescriptions) const;
 	const vk::PipelineInputAssemblyStateCreateInfo buildPipelineInputAssemblyStateCreateInfo() const;
-	const vk::Viewport buildViewport(const vk::Extent2D& swapChainExtent) const;
-	const vk::Rect2D buildScissor(const vk::Extent2D& swapChainExtent) const;
-	const vk::PipelineViewportStateCreateInfo buildPipelineViewportStateCreateInfo(const vk::Viewport& viewport, const vk::Rect2D& scissor) const;
+	const vk::PipelineViewportStateCreateInfo buildPipelineViewportStateCreateInfo() const;
 	const vk::PipelineRasterizationStateCreateInfo buildPipelineRasterizationStateCreateInfo() const;
 	const vk::PipelineMultisampleStateCreateInfo buildPipelineMultisampleStateCreateInfo() const;
+	const vk::PipelineDepthStencilStateCreateInfo buildPipelineDepthStencilStateCreateInfo() const;
 	const vk::PipelineColorBlendAttachmentState buildPipelineColorBlendAttachmentState() const;
 	const vk::PipelineColorBlendStateCreateInfo buildPipelineColorBlendStateCreateInfo(const vk::PipelineColorBlendAttachmentState& colorBlendAttachmentState) const;
-	const vk::PipelineDynamicStateCreateInfo buildPipelineDynamicStateCreateInfo() const;
-	const vk::PipelineLayoutCreateInfo buildPipelineLayoutCreateInfo() const;
+	const vk::PipelineDynamicStateCreateInfo buildPipelineDynamicStateCreateInfo(const std::vector<vk::DynamicState>& dynamicStates) const;
+	const vk::PipelineLayoutCreateInfo buildPipelineLayoutCreateInfo(const std::vector<vk::DescriptorSetLayout>& descriptorSetLayouts, const std::vector<vk::PushConstantRange>& pushConstantRanges) const;
 	
 	const vk::Device vulkanLogicalDevice;
 	vk::PipelineLayout pipelineLayout;
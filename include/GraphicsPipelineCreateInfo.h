@@ -7,7 +7,10 @@
 struct GraphicsPipelineCreateInfo
 {
 	vk::Device vulkanLogicalDevice;
-	vk::Extent2D swapChainExtent;
+	vk::PipelineCache vulkanPipelineCache;
 	std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
 	vk::RenderPass vulkanRenderPass;
+	std::vector<vk::DescriptorSetLayout> descriptorSetLayouts;
+	std::vector<vk::PushConstantRange> pushConstantRanges;
+	bool isDepthTestEnabled{ false };
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+
+#include "ImageCreateInfo.h"
+#include "ImageView.h"
+
+class Image
+{
+public:
+	explicit Image(const ImageCreateInfo& imageCreateInfo);
+	~Image();
+
+	void bindMemory(const vk::DeviceMemory& vulkanDeviceMemory, const vk::DeviceSize offset);
+
+	const vk::MemoryRequirements getMemoryRequirements() const;
+	const vk::Image getVulkanImage() const;
+	const vk::ImageView getVulkanImageView() const;
+	const vk::Format getFormat() const;
+	const vk::Extent2D getExtent() const;
+	const uint32_t getMipLevels() const;
+	const bool isTransient() const;
+
+private:
+	const vk::ImageCreateInfo buildImageCreateInfo(const ImageCreateInfo& imageCreateInfo) const;
+
+	const vk::Device vulkanLogicalDevice;
+	const vk::Format format;
+	const vk::Extent2D extent;
+	const vk::ImageAspectFlags aspectMask;
+	const uint32_t mipLevels;
+	const bool transient;
+	vk::Image vulkanImage;
+	std::unique_ptr<ImageView> imageView;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct ImageCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::Extent2D extent;
+	vk::Format format;
+	vk::ImageUsageFlags usage;
+	vk::ImageAspectFlags aspectMask{ vk::ImageAspectFlagBits::eColor };
+	uint32_t mipLevels{ 1 };
+	bool isTransient{ false };
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ImageQualityMetrics.h"
+#include "LuminanceImage.h"
+#include "ThreadPool.h"
+
+class ImageQuality
+{
+public:
+	static const ImageQualityMetrics compare(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool);
+	static const double computeMeanSquaredError(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool);
+	static const double computePeakSignalToNoiseRatio(const double meanSquaredError);
+	static const double computeStructuralSimilarity(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool);
+
+private:
+	struct BlockSums
+	{
+		uint32_t countX;
+		uint32_t countY;
+		std::vector<float> reference;
+		std::vector<float> image;
+		std::vector<float> referenceSquared;
+		std::vector<float> imageSquared;
+		std::vector<float> product;
+	};
+
+	static void throwExceptionIfSizesDiffer(const LuminanceImage& referenceImage, const LuminanceImage& image);
+	static const float accumulateSquaredError(const float* referencePixels, const float* pixels, const size_t pixelCount);
+	static const size_t accumulateSquaredErrorSIMD(const float* referencePixels, const float* pixels, const size_t pixelCount, float& squaredError);
+	static void sumBlockRow(const LuminanceImage& referenceImage, const LuminanceImage& image, const uint32_t blockRow, BlockSums& blockSums);
+	static const uint32_t sumBlockRowSIMD(const LuminanceImage& referenceImage, const LuminanceImage& image, const uint32_t blockRow, BlockSums& blockSums);
+	static const double accumulateWindowRowSimilarity(const BlockSums& blockSums, const uint32_t blockRow);
+	static const uint32_t accumulateWindowRowSimilaritySIMD(const BlockSums& blockSums, const uint32_t blockRow, double& similarity);
+	static const float computeWindowSimilarity(const float sumReference, const float sumImage, const float sumReferenceSquared, const float sumImageSquared, const float sumProduct);
+
+	static constexpr uint32_t blockSize{ 4 };
+	static constexpr float windowPixelCount{ 4.0f * blockSize * blockSize };
+	static constexpr float luminanceStabilizer{ 0.01f * 0.01f };
+	static constexpr float contrastStabilizer{ 0.03f * 0.03f };
+	static constexpr double maximumPeakSignalToNoiseRatio{ 100.0 };
+	static constexpr size_t rowChunkSize{ 16 };
+};
\ No newline at end of file
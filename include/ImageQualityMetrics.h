@@ -0,0 +1,8 @@
+#pragma once
+
+struct ImageQualityMetrics
+{
+	double meanSquaredError;
+	double peakSignalToNoiseRatio;
+	double structuralSimilarity;
+};
\ No newline at end of file
@@ -8,12 +8,13 @@ class ImageView
 
 public:
 	ImageView(const vk::Device& vulkanLogicalDevice, const vk::Image& image, const vk::SurfaceFormatKHR& surfaceFormat);
+	ImageView(const vk::Device& vulkanLogicalDevice, const vk::Image& image, const vk::Format format, const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels);
 	~ImageView();
 	vk::ImageView getVulkanImageView() const;
 
 private:
-	const vk::ImageViewCreateInfo buildImageViewCreateInfo(const vk::Image& image, const vk::SurfaceFormatKHR& surfaceFormat) const;
-	const vk::ImageSubresourceRange createImageSubresourceRange() const;
+	const vk::ImageViewCreateInfo buildImageViewCreateInfo(const vk::Image& image, const vk::Format format, const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels) const;
+	const vk::ImageSubresourceRange createImageSubresourceRange(const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels) const;
 
 	const vk::Device vulkanLogicalDevice;
 	vk::ImageView vulkanImageView;
@@ -1,15 +1,11 @@
 #pragma once
 
 #include "Buffer.h"
-#include "ContentBufferCreateInfo.h"
+#include "BufferCreateInfo.h"
 
 class IndexBuffer : public Buffer
 {
 public:
-	IndexBuffer(const ContentBufferCreateInfo<uint16_t>& contentBufferCreateInfo);
-	const size_t getIndexCount() const;
-
-private:
-	void createIndexData(const std::vector<uint16_t>& indices, const vk::PhysicalDevice& vulkanPhysicalDevice);
-	size_t indexCount;
+	explicit IndexBuffer(const BufferCreateInfo& bufferCreateInfo);
+	const uint32_t allocate(const std::vector<uint32_t>& indices);
 };
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+struct IndexedDraw
+{
+	uint32_t indexCount;
+	uint32_t instanceCount;
+	uint32_t firstIndex;
+	uint32_t vertexOffset;
+	uint32_t firstInstance;
+
+	bool operator==(const IndexedDraw& indexedDraw) const = default;
+};
\ No newline at end of file
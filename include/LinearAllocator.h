@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+class LinearAllocator
+{
+public:
+	explicit LinearAllocator(const uint64_t size);
+
+	std::optional<uint64_t> allocate(const uint64_t size, const uint64_t alignment);
+	void reset();
+
+	const uint64_t getSize() const;
+	const uint64_t getUsedSize() const;
+	const uint32_t getAllocationCount() const;
+
+private:
+	uint64_t size;
+	uint64_t usedSize{ 0 };
+	uint32_t allocationCount{ 0 };
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+
+struct LinearMemoryAllocation
+{
+	vk::Buffer vulkanBuffer;
+	vk::DeviceSize offset;
+	void* mappedData;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
+
+#include "DeviceMemoryAllocator.h"
+#include "LinearAllocator.h"
+#include "LinearMemoryAllocation.h"
+#include "LinearMemoryPoolCreateInfo.h"
+
+class LinearMemoryPool
+{
+public:
+	explicit LinearMemoryPool(const LinearMemoryPoolCreateInfo& linearMemoryPoolCreateInfo);
+	~LinearMemoryPool();
+
+	void beginFrame(const uint32_t frameIndex);
+	const LinearMemoryAllocation allocate(const vk::DeviceSize size, const vk::DeviceSize alignment);
+
+	const vk::Buffer getVulkanBuffer() const;
+	const vk::DeviceSize getFrameSize() const;
+	const vk::DeviceSize getUsedSize() const;
+
+private:
+	const vk::BufferCreateInfo buildBufferCreateInfo(const LinearMemoryPoolCreateInfo& linearMemoryPoolCreateInfo) const;
+
+	const vk::DeviceSize frameAlignment{ 256 };
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	vk::Buffer vulkanBuffer;
+	MemoryAllocation memoryAllocation;
+	std::vector<LinearAllocator> frameAllocators;
+	vk::DeviceSize frameSize;
+	uint32_t currentFrame{ 0 };
+};
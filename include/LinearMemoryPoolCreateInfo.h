@@ -0,0 +1,18 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
+
+#include "DeviceMemoryAllocator.h"
+
+struct LinearMemoryPoolCreateInfo
+{
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	vk::DeviceSize frameSize;
+	uint32_t frameCount;
+	vk::BufferUsageFlags bufferUsage;
+	vk::MemoryPropertyFlags memoryPropertyFlags{ vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent };
+	std::vector<uint32_t> sharingQueueFamilyIndices;
+};
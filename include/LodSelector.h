@@ -0,0 +1,21 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Mesh.h"
+
+class LodSelector
+{
+public:
+	LodSelector(const float viewportHeight, const float verticalFieldOfView, const float maximumPixelError);
+
+	const uint32_t select(const Mesh& mesh, const float distance, const float scale = 1.0f) const;
+	const uint32_t select(const std::vector<MeshLod>& lods, const float distance, const float scale = 1.0f) const;
+
+private:
+	float pixelsPerUnitAtUnitDistance;
+	const float maximumPixelError;
+};
@@ -2,6 +2,7 @@
 
 #define VULKAN_HPP_NO_CONSTRUCTORS
 #include <vulkan/vulkan.hpp>
+#include <chrono>
 #include <optional>
 #include <iostream>
 #include <set>
@@ -9,15 +10,47 @@
 #include "LogicalDeviceCreateInfo.h"
 #include "SwapChain.h"
 #include "RenderPass.h"
+#include "GeometryRenderPass.h"
+#include "Framebuffer.h"
 #include "CommandPool.h"
 #include "CommandBuffer.h"
+#include "ParallelCommandRecorder.h"
+#include "CommandBufferCache.h"
+#include "RenderSettings.h"
+#include "IndexedDraw.h"
 #include "GraphicsPipeline.h"
 #include "Shader.h"
+#include "PipelineShaders.h"
 #include "SynchronizationObjects.h"
 #include "GraphicsQueue.h"
+#include "ComputeQueue.h"
 #include "PresentQueue.h"
+#include "TransferQueue.h"
+#include "TimelineSemaphore.h"
+#include "FrameLatencyTracker.h"
+#include "QueueSubmitInfo.h"
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
+#include "DeviceMemoryAllocator.h"
+#include "UploadManager.h"
+#include "GeometryRange.h"
+#include "UniformRing.h"
+#include "Camera.h"
+#include "LodSelector.h"
+#include "AmbientOcclusionKernel.h"
+#include "AmbientOcclusionParameters.h"
+#include "FrameUniforms.h"
+#include "BindlessDescriptorHeap.h"
+#include "AmbientOcclusionImageChain.h"
+#include "BindlessResourceSlot.h"
+#include "Sampler.h"
+#include "RenderGraph.h"
+#include "GpuProfiler.h"
+#include "FrameCapture.h"
+#include "PipelineCache.h"
+#include "PipelineVariantManager.h"
+#include "ThreadPool.h"
+#include "TraceZone.h"
  
 class LogicalDevice
 {
@@ -25,11 +58,29 @@ public:
 	explicit LogicalDevice(const LogicalDeviceCreateInfo& logicalDeviceCreateInfo);
 	~LogicalDevice();
 
-	void createGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders);
-	void drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	void createPipelines(const PipelineShaders& pipelineShaders);
+	void drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const std::chrono::steady_clock::time_point inputTime);
 	void waitIdle();
+	void setAmbientOcclusionQuality(const uint32_t qualityLevel);
+	void setCameraPose(const glm::vec3& position, const glm::vec3& target);
+	void resetGpuProfile();
+	void requestFrameCapture();
+	const std::optional<LuminanceImage> readFrameCapture();
 
 	const vk::Device getVulkanLogicalDevice() const;
+	const MemoryStatistics getMemoryStatistics() const;
+	const UploadStatistics getUploadStatistics() const;
+	const TransientMemoryStatistics getTransientMemoryStatistics() const;
+	const std::string getRenderGraphSchedule() const;
+	const CommandRecordingStatistics getCommandRecordingStatistics() const;
+	const CommandBufferCacheStatistics getCommandBufferCacheStatistics() const;
+	const PipelineCacheStatistics getPipelineCacheStatistics() const;
+	const FrameLatencyStatistics getFrameLatencyStatistics() const;
+	const std::vector<GpuPassStatistics> getGpuPassStatistics() const;
+	void writeGpuProfile(const std::filesystem::path& csvFilePath, const std::filesystem::path& jsonFilePath) const;
+	const vk::PresentModeKHR getPresentMode() const;
+	const uint32_t getAmbientOcclusionQualityLevelCount() const;
+	const std::optional<uint32_t> findAmbientOcclusionQualityLevel(const uint32_t sampleCount) const;
 
 private:
 	const std::set<uint32_t> createUniqueQueueFamilies(const QueueFamilyIndices& queueFamilyIndices) const;
@@ -38,34 +89,122 @@ private:
 	const vk::DeviceCreateInfo buildVulkanLogicalDeviceCreateInfo(const std::vector<vk::DeviceQueueCreateInfo>& deviceQueueCreateInfos, const LogicalDeviceCreateInfo& logicalDeviceCreateInfo) const;
 	void createSwapChain(const LogicalDeviceCreateInfo& logicalDeviceCreateInfo);
 	void createRenderPass();
+	void createPipelineCache(const vk::PhysicalDevice& vulkanPhysicalDevice);
 	void createFramebuffers();
-	void createCommandPool(const std::optional<uint32_t> graphicsFamilyIndex);
-	void createCommandBuffers();
+	void createCommandRecorders();
+	void resizeCommandRecordingSlots();
+	const uint32_t getCommandRecordingSlotCount() const;
+	const uint32_t getCommandRecordingSlotIndex() const;
 	void createSynchronizationObjects();
 	void createQueues(const QueueFamilyIndices& queueFamilyIndices);
-	void createVertexBuffer(const std::vector<Vertex>& vertices, const vk::PhysicalDevice& vulkanPhysicalDevice);
-	template<typename T>
-	const ContentBufferCreateInfo<T> buildContentBufferCreateInfo(const std::vector<T>& content, const vk::PhysicalDevice& vulkanPhysicalDevice) const;
-	void createIndexBuffer(const std::vector<uint16_t>& indices, const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void createDeviceMemoryAllocator(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void createUploadManager(const QueueFamilyIndices& queueFamilyIndices);
+	void createUniformRing(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void enableDescriptorIndexingIfSupported(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void enablePipelineStatisticsQueryIfSupported(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void createGpuProfiler(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void createFrameCapture();
+	void createBindlessDescriptorHeap(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void createAmbientOcclusionImageChains();
+	void updateAmbientOcclusionImageChain();
+	void registerAmbientOcclusionImages(const uint32_t frameIndex);
+	void releaseAmbientOcclusionImages(const uint32_t frameIndex);
+	void createGeometryFramebuffer(const uint32_t frameIndex);
+	void createRenderGraph();
+	std::unique_ptr<GraphicsPipeline> buildGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders, const vk::RenderPass& vulkanRenderPass, const bool isDepthTestEnabled) const;
+	const uint32_t addRenderGraphPass(RenderGraphPassDescription renderGraphPassDescription);
+	void createGeometryBuffers();
+	void generateAmbientOcclusionKernel();
+	const GeometryRange addMesh(const Mesh& mesh);
+	void beginGeometryBufferFrame();
+	const uint64_t getCompletedFrameCount() const;
 	void waitForFences(const uint32_t fenceCount);
+	void releaseRetiredSwapChainResources();
 	const uint32_t acquireNextImageFromSwapChain(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	const vk::Result tryAcquireNextImageFromSwapChain(uint32_t& imageIndex);
 	void recreateSwapChainIfResultIsOutOfDateOrSuboptimalKHR(vk::Result& result, std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	const bool isFramebufferSizeDifferentFromSwapChainExtent(std::function<WindowSize()> getFramebufferSize) const;
 	void resetFences(const uint32_t fenceCount);
+	void updateFrameUniforms();
+	const FrameUniforms buildFrameUniforms() const;
+	void setRenderGraphImages(const uint32_t imageIndex);
+	const CommandBufferRecordInfo createGeometryPassRecordInfo() const;
+	const AmbientOcclusionPassRecordInfo createAmbientOcclusionPassRecordInfo() const;
 	const CommandBufferRecordInfo createCommandBufferRecordInfo(const uint32_t imageIndex) const;
+	const MeshLod selectMeshLod(const GeometryRange& geometryRange) const;
+	void updateForwardDraws();
+	void recordRenderGraph();
+	const CommandBufferCacheKey buildCommandBufferCacheKey() const;
+	void submitRenderGraph();
+	void assignSegmentSignalValues();
+	const QueueSubmitInfo buildSegmentSubmitInfo(const uint32_t segmentIndex, const uint32_t firstGraphicsSegmentIndex, const uint32_t lastGraphicsSegmentIndex, const uint32_t lastComputeSegmentIndex) const;
+	const uint32_t findFirstSegmentIndex(const RenderGraphQueue queue) const;
+	const uint32_t findLastSegmentIndex(const RenderGraphQueue queue) const;
+	const vk::Semaphore getRenderGraphSemaphore(const RenderGraphQueue queue) const;
+	const uint64_t getRequiredUploadTimelineValue() const;
 	void presentResult(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const uint32_t imageIndex);
 
-	const int MAX_FRAMES_IN_FLIGHT = 2;
+	const RenderSettings renderSettings;
+	const int MAX_FRAMES_IN_FLIGHT;
 	unsigned int currentFrame = 0;
+	uint64_t frameNumber{ 0 };
+	double initialUploadMilliseconds{ 0.0 };
 	vk::Device vulkanLogicalDevice; 
 	std::unique_ptr<SwapChain> swapChain;
 	std::unique_ptr<RenderPass> renderPass;
-	std::unique_ptr<GraphicsPipeline> graphicsPipeline;
-	std::unique_ptr<CommandPool> commandPool;
+	std::unique_ptr<GeometryRenderPass> geometryRenderPass;
+	std::unique_ptr<PipelineCache> pipelineCache;
+	std::unique_ptr<GraphicsPipeline> geometryPipeline;
+	std::unique_ptr<GraphicsPipeline> forwardPipeline;
+	std::unique_ptr<PipelineVariantManager> pipelineVariantManager;
+	const std::vector<AmbientOcclusionVariantKey> ambientOcclusionQualityLevels{ { 8, 4, 2 }, { 12, 6, 4 }, { 16, 8, 8 } };
+	AmbientOcclusionVariantKey ambientOcclusionVariantKey{ ambientOcclusionQualityLevels.back() };
+	std::unique_ptr<ThreadPool> threadPool;
+	std::unique_ptr<ParallelCommandRecorder> graphicsCommandRecorder;
+	std::unique_ptr<ParallelCommandRecorder> computeCommandRecorder;
+	std::unique_ptr<CommandBufferCache> commandBufferCache;
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<UploadManager> uploadManager;
+	std::unique_ptr<UniformRing> uniformRing;
+	std::unique_ptr<BindlessDescriptorHeap> bindlessDescriptorHeap;
+	std::unique_ptr<Sampler> nearestSampler;
+	std::vector<std::unique_ptr<AmbientOcclusionImageChain>> ambientOcclusionImageChains;
+	std::vector<std::unique_ptr<Framebuffer>> geometryFramebuffers;
+	std::unique_ptr<RenderGraph> renderGraph;
+	std::unique_ptr<TimelineSemaphore> graphicsRenderGraphSemaphore;
+	std::unique_ptr<TimelineSemaphore> computeRenderGraphSemaphore;
+	uint64_t graphicsRenderGraphSemaphoreValue{ 0 };
+	uint64_t computeRenderGraphSemaphoreValue{ 0 };
+	std::vector<uint64_t> segmentSignalValues;
+	std::unique_ptr<FrameLatencyTracker> frameLatencyTracker;
+	std::unique_ptr<GpuProfiler> gpuProfiler;
+	std::unique_ptr<FrameCapture> frameCapture;
+	uint32_t swapChainImageHandle{ 0 };
+	uint32_t depthImageHandle{ 0 };
+	uint32_t normalsImageHandle{ 0 };
+	uint32_t rawAmbientOcclusionImageHandle{ 0 };
+	uint32_t swapChainImageIndex{ 0 };
+	std::vector<BindlessPushConstants> bindlessPushConstants;
+	bool isDescriptorIndexingEnabled{ false };
+	uint32_t uniformDynamicOffset{ 0 };
+	Camera camera{ glm::vec3(0.0f, 0.0f, 2.0f), glm::vec3(0.0f), glm::radians(45.0f) };
+	const float maximumLodPixelError{ 1.0f };
+	AmbientOcclusionParameters ambientOcclusionParameters;
+	std::array<glm::vec4, FrameUniforms::maximumKernelSampleCount> ambientOcclusionKernel;
 	std::unique_ptr<VertexBuffer> vertexBuffer;
 	std::unique_ptr<IndexBuffer> indexBuffer;
-	std::unique_ptr<CommandBuffer> commandBuffers;
+	GeometryRange meshGeometryRange;
+	std::vector<IndexedDraw> forwardDraws;
+	vk::Buffer forwardVertexBuffer;
+	vk::Buffer forwardIndexBuffer;
+	std::vector<vk::CommandBuffer> segmentVulkanCommandBuffers;
 	std::shared_ptr<GraphicsQueue> graphicsQueue;
+	std::unique_ptr<ComputeQueue> computeQueue;
 	std::unique_ptr<PresentQueue> presentQueue;
+	std::shared_ptr<TransferQueue> transferQueue;
 	std::vector<std::shared_ptr<SynchronizationObjects>> synchronizationObjects;
+	uint32_t graphicsFamilyIndex{ 0 };
+	std::optional<uint32_t> computeFamilyIndex;
 	vk::PhysicalDeviceFeatures physicalDeviceFeatures;
+	vk::PhysicalDeviceVulkan12Features physicalDeviceVulkan12Features{ .timelineSemaphore = true };
 };
\ No newline at end of file
@@ -6,7 +6,8 @@
 
 #include "QueueFamilyIndices.h"
 #include "WindowSize.h"
-#include "Vertex.h"
+#include "Mesh.h"
+#include "RenderSettings.h"
 
 struct LogicalDeviceCreateInfo
 {
@@ -17,6 +18,6 @@ struct LogicalDeviceCreateInfo
 	WindowSize framebufferSize;
 	uint32_t enabledLayerCount;
 	char* const* enabledLayerNames;
-	std::vector<Vertex> vertices;
-	std::vector<uint16_t> indices;
+	Mesh mesh;
+	RenderSettings renderSettings;
 };
\ No newline at end of file
@@ -4,7 +4,8 @@
 #include <optional>
 
 #include "WindowSize.h"
-#include "Vertex.h"
+#include "Mesh.h"
+#include "RenderSettings.h"
 
 struct LogicalDevicePartialCreateInfo
 {
@@ -12,6 +13,6 @@ struct LogicalDevicePartialCreateInfo
 	WindowSize framebufferSize;
 	uint32_t enabledLayerCount;
 	char* const* enabledLayerNames;
-	std::vector<Vertex> vertices;
-	std::vector<uint16_t> indices;
+	Mesh mesh;
+	RenderSettings renderSettings;
 };
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct LuminanceImage
+{
+	uint32_t width;
+	uint32_t height;
+	std::vector<float> pixels;
+};
\ No newline at end of file
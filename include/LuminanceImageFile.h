@@ -0,0 +1,25 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "LuminanceImage.h"
+
+class LuminanceImageFile
+{
+public:
+	static const LuminanceImage read(const std::filesystem::path& filePath);
+	static void write(const LuminanceImage& luminanceImage, const std::filesystem::path& filePath);
+	static void writeDifferenceHeatmap(const LuminanceImage& referenceImage, const LuminanceImage& image, const std::filesystem::path& filePath, const float differenceScale);
+
+private:
+	static const uint8_t quantize(const float value);
+
+	static constexpr uint32_t maximumValue{ 255 };
+};
\ No newline at end of file
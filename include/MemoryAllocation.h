@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct MemoryAllocation
+{
+	vk::DeviceMemory vulkanDeviceMemory;
+	vk::DeviceSize offset;
+	vk::DeviceSize size;
+	void* mappedData;
+	uint32_t memoryTypeIndex;
+	uint32_t memoryBlockIndex;
+	uint32_t handle;
+};
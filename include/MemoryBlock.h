@@ -0,0 +1,36 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <optional>
+
+#include "MemoryBlockCreateInfo.h"
+#include "TlsfAllocator.h"
+
+class MemoryBlock
+{
+public:
+	explicit MemoryBlock(const MemoryBlockCreateInfo& memoryBlockCreateInfo);
+	~MemoryBlock();
+
+	std::optional<TlsfAllocation> allocate(const vk::DeviceSize size, const vk::DeviceSize alignment);
+	void free(const uint32_t handle);
+
+	const vk::DeviceMemory getVulkanDeviceMemory() const;
+	void* getMappedData(const vk::DeviceSize offset) const;
+	const uint32_t getMemoryTypeIndex() const;
+	const MemoryResourceType getMemoryResourceType() const;
+	const bool isDedicated() const;
+	const TlsfAllocator& getTlsfAllocator() const;
+
+private:
+	const vk::MemoryAllocateInfo buildMemoryAllocateInfo(const MemoryBlockCreateInfo& memoryBlockCreateInfo) const;
+
+	const vk::Device vulkanLogicalDevice;
+	vk::DeviceMemory vulkanDeviceMemory;
+	void* mappedData{ nullptr };
+	TlsfAllocator tlsfAllocator;
+	const uint32_t memoryTypeIndex;
+	const MemoryResourceType memoryResourceType;
+	const bool dedicated;
+};
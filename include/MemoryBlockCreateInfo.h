@@ -0,0 +1,17 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "MemoryResourceType.h"
+
+struct MemoryBlockCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::DeviceSize size;
+	uint32_t memoryTypeIndex;
+	MemoryResourceType memoryResourceType;
+	bool isHostVisible;
+	bool isDedicated;
+};
@@ -2,9 +2,24 @@
 
 #define VULKAN_HPP_NO_CONSTRUCTORS
 #include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <bit>
+#include <vector>
 
 class MemoryProperties
 {
 public:
 	static uint32_t findMemoryType(const vk::PhysicalDevice& vulkanPhysicalDevice, uint32_t memoryTypeFilter, vk::MemoryPropertyFlags memoryPropertyFlags);
+	static std::vector<uint32_t> rankMemoryTypes(const vk::PhysicalDeviceMemoryProperties& physicalDeviceMemoryProperties, uint32_t memoryTypeFilter, vk::MemoryPropertyFlags requiredMemoryPropertyFlags, vk::MemoryPropertyFlags preferredMemoryPropertyFlags);
+
+private:
+	struct MemoryTypeScore
+	{
+		uint32_t memoryTypeIndex;
+		int preferredFlagCount;
+		int unwantedFlagCount;
+		vk::DeviceSize heapSize;
+	};
+
+	static int countFlags(vk::MemoryPropertyFlags memoryPropertyFlags);
 };
\ No newline at end of file
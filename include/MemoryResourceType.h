@@ -0,0 +1,7 @@
+#pragma once
+
+enum class MemoryResourceType
+{
+	eBuffer,
+	eImage
+};
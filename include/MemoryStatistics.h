@@ -0,0 +1,15 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct MemoryStatistics
+{
+	uint32_t memoryBlockCount;
+	uint32_t allocationCount;
+	vk::DeviceSize reservedBytes;
+	vk::DeviceSize usedBytes;
+	vk::DeviceSize largestFreeRange;
+	float fragmentation;
+};
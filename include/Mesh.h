@@ -0,0 +1,17 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "MeshLod.h"
+#include "Vertex.h"
+
+struct Mesh
+{
+	std::vector<Vertex> vertices;
+	std::vector<uint32_t> indices;
+	std::vector<MeshLod> lods;
+	glm::vec3 boundsCenter{ 0.0f };
+	float boundsRadius{ 0.0f };
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct MeshLod
+{
+	uint32_t firstIndex;
+	uint32_t indexCount;
+	float error;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <future>
+#include <vector>
+
+#include "Mesh.h"
+#include "MeshSimplifier.h"
+#include "ThreadPool.h"
+
+class MeshLodGenerator
+{
+public:
+	void generate(std::vector<Mesh>& meshes, ThreadPool& threadPool) const;
+	void generate(Mesh& mesh) const;
+
+private:
+	const bool isReductionSufficient(const size_t previousIndexCount, const size_t simplifiedIndexCount) const;
+
+	const size_t maximumLodCount{ 5 };
+	const size_t minimumIndexCount{ 36 };
+	const float reductionRatio{ 0.5f };
+	const float minimumReduction{ 0.9f };
+};
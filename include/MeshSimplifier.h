@@ -0,0 +1,50 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+#include "EdgeCollapse.h"
+#include "Quadric.h"
+#include "SimplificationResult.h"
+#include "Vertex.h"
+
+class MeshSimplifier
+{
+public:
+	MeshSimplifier(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+	const SimplificationResult simplify(const size_t targetIndexCount);
+
+private:
+	void weldVertices();
+	void buildTriangles(const std::vector<uint32_t>& indices);
+	void buildQuadrics();
+	void buildBoundaries();
+	void pushCollapse(const uint32_t from, const uint32_t to);
+	void pushCollapsesAroundVertex(const uint32_t vertex);
+	const bool isCollapseValid(const EdgeCollapse& edgeCollapse) const;
+	void applyCollapse(const EdgeCollapse& edgeCollapse);
+	const glm::vec3 computeTriangleNormal(const std::array<uint32_t, 3>& triangle) const;
+	const std::vector<uint32_t> buildIndices() const;
+
+	const float boundaryWeight{ 10.0f };
+	const std::vector<Vertex>& vertices;
+	std::vector<uint32_t> canonicalVertices;
+	std::vector<std::array<uint32_t, 3>> originalTriangles;
+	std::vector<std::array<uint32_t, 3>> triangles;
+	std::vector<bool> isTriangleAlive;
+	std::vector<std::vector<uint32_t>> vertexTriangles;
+	std::vector<Quadric> quadrics;
+	std::vector<bool> isBoundaryVertex;
+	std::vector<uint32_t> vertexVersions;
+	std::vector<bool> isVertexCollapsed;
+	std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>, std::greater<EdgeCollapse>> edgeCollapses;
+	size_t aliveTriangleCount{ 0 };
+};
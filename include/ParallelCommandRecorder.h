@@ -0,0 +1,49 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "CommandPool.h"
+#include "CommandRecordingStatistics.h"
+#include "ExceptionChecker.h"
+#include "ParallelCommandRecorderCreateInfo.h"
+#include "ThreadPool.h"
+#include "TraceZone.h"
+
+class ParallelCommandRecorder
+{
+public:
+	explicit ParallelCommandRecorder(const ParallelCommandRecorderCreateInfo& parallelCommandRecorderCreateInfo);
+
+	void reserveFrames(const int frameCount);
+	void beginFrame(const int frameIndex);
+	const vk::CommandBuffer beginPrimaryCommandBuffer();
+	void recordSecondaryCommandBuffers(const vk::CommandBuffer& vulkanPrimaryCommandBuffer, const vk::CommandBufferInheritanceInfo& commandBufferInheritanceInfo, const size_t itemCount,
+		const std::function<void(const vk::CommandBuffer&, const size_t, const size_t)>& recordItems, ThreadPool& threadPool);
+
+	const CommandRecordingStatistics getStatistics() const;
+
+private:
+	struct CommandPoolSlot
+	{
+		std::unique_ptr<CommandPool> commandPool;
+		std::vector<vk::CommandBuffer> vulkanCommandBuffers;
+		uint32_t usedCommandBufferCount{ 0 };
+	};
+
+	const vk::CommandBuffer acquireCommandBuffer(CommandPoolSlot& commandPoolSlot, const vk::CommandBufferLevel level);
+
+	const vk::Device vulkanLogicalDevice;
+	const uint32_t queueFamilyIndex;
+	const uint32_t threadCount;
+	const size_t minimumItemsPerCommandBuffer;
+	const vk::CommandBufferUsageFlags usageFlags;
+	std::vector<CommandPoolSlot> primaryCommandPools;
+	std::vector<std::vector<CommandPoolSlot>> secondaryCommandPools;
+	int currentFrameIndex{ 0 };
+	CommandRecordingStatistics statistics{};
+};
\ No newline at end of file
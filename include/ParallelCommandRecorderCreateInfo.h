@@ -0,0 +1,15 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct ParallelCommandRecorderCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	uint32_t queueFamilyIndex;
+	int frameCount;
+	uint32_t threadCount;
+	size_t minimumItemsPerCommandBuffer{ 256 };
+	bool isReusable{ false };
+};
\ No newline at end of file
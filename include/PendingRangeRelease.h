@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+struct PendingRangeRelease
+{
+	uint32_t rangeHandle;
+	uint64_t frameNumber;
+};
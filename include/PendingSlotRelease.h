@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+#include "BindlessResourceType.h"
+
+struct PendingSlotRelease
+{
+	BindlessResourceType resourceType;
+	uint32_t slot;
+	uint64_t frameNumber;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+class Percentile
+{
+public:
+	static const double compute(const std::vector<double>& sortedValues, const double percentile);
+	static const std::vector<double> sort(std::vector<double> values);
+};
\ No newline at end of file
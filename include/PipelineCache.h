@@ -0,0 +1,44 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "PipelineCacheCreateInfo.h"
+#include "PipelineCacheStatistics.h"
+
+class PipelineCache
+{
+public:
+	explicit PipelineCache(const PipelineCacheCreateInfo& pipelineCacheCreateInfo);
+	~PipelineCache();
+
+	void save();
+	void addPipelineCreationTime(const double milliseconds);
+
+	const vk::PipelineCache getVulkanPipelineCache() const;
+	const PipelineCacheStatistics getStatistics() const;
+
+private:
+	static constexpr size_t headerSize{ 16 + VK_UUID_SIZE };
+
+	const std::filesystem::path buildFilePath(const std::filesystem::path& directory, const vk::PhysicalDeviceProperties& physicalDeviceProperties, const vk::PhysicalDeviceIDProperties& physicalDeviceIDProperties) const;
+	const std::vector<char> load() const;
+	const bool isHeaderValid(const std::vector<char>& cacheData) const;
+	const uint32_t readHeaderField(const std::vector<char>& cacheData, const size_t offset) const;
+
+	const vk::Device vulkanLogicalDevice;
+	vk::PipelineCache vulkanPipelineCache;
+	std::filesystem::path filePath;
+	uint32_t vendorID;
+	uint32_t deviceID;
+	std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUUID;
+	PipelineCacheStatistics pipelineCacheStatistics{};
+};
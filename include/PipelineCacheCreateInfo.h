@@ -0,0 +1,12 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <filesystem>
+
+struct PipelineCacheCreateInfo
+{
+	vk::Device vulkanLogicalDevice;
+	vk::PhysicalDevice vulkanPhysicalDevice;
+	std::filesystem::path directory{ "cache" };
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+struct PipelineCacheStatistics
+{
+	bool isWarm;
+	size_t loadedBytes;
+	size_t savedBytes;
+	double pipelineCreationMilliseconds;
+};
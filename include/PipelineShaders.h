@@ -0,0 +1,13 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Shader.h"
+
+struct PipelineShaders
+{
+	std::vector<std::shared_ptr<Shader>> geometryShaders;
+	std::shared_ptr<Shader> ambientOcclusionShader;
+	std::vector<std::shared_ptr<Shader>> forwardShaders;
+};
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "AmbientOcclusionVariantKey.h"
+#include "ComputePipeline.h"
+#include "ComputePipelineCreateInfo.h"
+#include "Shader.h"
+#include "SpecializationConstants.h"
+#include "ThreadPool.h"
+
+class PipelineVariantManager
+{
+public:
+	void build(const ComputePipelineCreateInfo& computePipelineCreateInfo, const std::shared_ptr<Shader>& shader, const std::vector<AmbientOcclusionVariantKey>& ambientOcclusionVariantKeys, ThreadPool& threadPool);
+
+	const ComputePipeline& getPipeline(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) const;
+	const bool contains(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) const;
+	const size_t getVariantCount() const;
+	const double getBuildMilliseconds() const;
+
+private:
+	static const SpecializationConstants buildSpecializationConstants(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey);
+	static std::unique_ptr<ComputePipeline> buildVariant(ComputePipelineCreateInfo computePipelineCreateInfo, const std::shared_ptr<Shader>& shader, const AmbientOcclusionVariantKey& ambientOcclusionVariantKey);
+
+	std::map<AmbientOcclusionVariantKey, std::unique_ptr<ComputePipeline>> pipelines;
+	double buildMilliseconds{ 0.0 };
+};
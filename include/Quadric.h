@@ -0,0 +1,21 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+
+class Quadric
+{
+public:
+	Quadric() = default;
+	Quadric(const glm::vec3& planeNormal, const float planeDistance, const float weight);
+
+	Quadric& operator+=(const Quadric& quadric);
+	const float evaluate(const glm::vec3& position) const;
+
+private:
+	double a2{ 0.0 }, ab{ 0.0 }, ac{ 0.0 }, ad{ 0.0 };
+	double b2{ 0.0 }, bc{ 0.0 }, bd{ 0.0 };
+	double c2{ 0.0 }, cd{ 0.0 };
+	double d2{ 0.0 };
+	double weight{ 0.0 };
+};
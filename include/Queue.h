@@ -4,11 +4,14 @@
 #include <vulkan/vulkan.hpp>
 #include <optional>
 
+#include "QueueSubmitInfo.h"
+
 class Queue
 {
 public:
 	Queue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex);
 	virtual ~Queue() {};
+	void submit(const QueueSubmitInfo& queueSubmitInfo);
 protected:
 	vk::Queue vulkanQueue;
 };
\ No newline at end of file
@@ -9,11 +9,17 @@ public:
 	QueueFamilyIndices(const vk::PhysicalDevice& vulkanPhysicalDevice, const vk::SurfaceKHR& vulkanWindowSurface);
 	const std::optional<uint32_t> getGraphicsFamilyIndex() const;
 	const std::optional<uint32_t> getPresentFamilyIndex() const;
+	const std::optional<uint32_t> getTransferFamilyIndex() const;
+	const std::optional<uint32_t> getComputeFamilyIndex() const;
 
 private:
 	void computeValidGraphicsFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice);
 	void computeValidPresentFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice, const vk::SurfaceKHR& vulkanWindowSurface);
+	void computeValidTransferFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice);
+	void computeValidComputeFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice);
 
 	std::optional<uint32_t> graphicsFamilyIndex;
 	std::optional<uint32_t> presentFamilyIndex;
+	std::optional<uint32_t> transferFamilyIndex;
+	std::optional<uint32_t> computeFamilyIndex;
 };
\ No newline at end of file
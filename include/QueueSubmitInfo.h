@@ -0,0 +1,17 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <vector>
+
+struct QueueSubmitInfo
+{
+	vk::CommandBuffer vulkanCommandBuffer;
+	std::vector<vk::Semaphore> waitSemaphores;
+	std::vector<uint64_t> waitValues;
+	std::vector<vk::PipelineStageFlags> waitStageMasks;
+	std::vector<vk::Semaphore> signalSemaphores;
+	std::vector<uint64_t> signalValues;
+	vk::Fence vulkanFence;
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+class Random
+{
+public:
+	explicit Random(const uint64_t seed);
+
+	static const uint64_t deriveSeed(const uint64_t seed, const uint64_t stream);
+	const uint32_t nextUint();
+	const uint32_t nextUint(const uint32_t bound);
+	const float nextFloat();
+	const float nextFloat(const float minimum, const float maximum);
+
+private:
+	static const uint64_t mix(uint64_t value);
+
+	uint64_t state;
+	const uint64_t increment{ 1442695040888963407ull };
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ExceptionChecker.h"
+#include "RenderGraphAccess.h"
+#include "RenderGraphBarrierBatch.h"
+#include "RenderGraphCreateInfo.h"
+#include "RenderGraphImageDescription.h"
+#include "RenderGraphPassDescription.h"
+#include "RenderGraphQueue.h"
+#include "RenderGraphSegment.h"
+#include "RenderGraphStatistics.h"
+
+class RenderGraph
+{
+public:
+	explicit RenderGraph(const RenderGraphCreateInfo& renderGraphCreateInfo);
+
+	const uint32_t addImage(const RenderGraphImageDescription& renderGraphImageDescription);
+	const uint32_t addPass(const RenderGraphPassDescription& renderGraphPassDescription);
+	void setVulkanImage(const uint32_t imageHandle, const vk::Image& vulkanImage);
+	void compile();
+	void execute(const uint32_t segmentIndex, const vk::CommandBuffer& vulkanCommandBuffer) const;
+
+	const std::string dump() const;
+	const RenderGraphStatistics getStatistics() const;
+	const std::vector<RenderGraphSegment>& getSegments() const;
+	const bool isAsyncComputeEnabled() const;
+
+private:
+	struct ImageState
+	{
+		vk::ImageLayout layout;
+		vk::PipelineStageFlags writeStageMask;
+		vk::AccessFlags writeAccessMask;
+		vk::PipelineStageFlags readStageMask;
+		vk::PipelineStageFlags visibleStageMask;
+		vk::AccessFlags visibleAccessMask;
+		RenderGraphQueue queue;
+		std::optional<uint32_t> segmentIndex;
+		bool isOwned;
+	};
+
+	struct PassAccess
+	{
+		RenderGraphAccess access;
+		bool isWrite;
+	};
+
+	struct CompiledPass
+	{
+		uint32_t passIndex;
+		uint32_t segmentIndex;
+		RenderGraphBarrierBatch barrierBatch;
+	};
+
+	const std::vector<bool> findUsedPasses() const;
+	const RenderGraphQueue getExecutionQueue(const RenderGraphQueue requestedQueue) const;
+	const uint32_t getQueueFamilyIndex(const RenderGraphQueue queue) const;
+	const uint32_t beginSegment(const RenderGraphQueue queue);
+	const std::optional<uint32_t> findFirstGraphicsSegmentIndex(const uint32_t lastSegmentIndex) const;
+	void addSegmentWait(const uint32_t segmentIndex, const uint32_t waitSegmentIndex, const vk::PipelineStageFlags stageMask);
+	void transferOwnership(RenderGraphBarrierBatch& barrierBatch, ImageState& imageState, const PassAccess& passAccess, const uint32_t segmentIndex);
+	const std::vector<PassAccess> mergePassAccesses(const RenderGraphPassDescription& renderGraphPassDescription) const;
+	void addAccessBarrier(RenderGraphBarrierBatch& barrierBatch, ImageState& imageState, const PassAccess& passAccess) const;
+	void addFinalBarrier(const ImageState& imageState, const uint32_t imageHandle);
+	void waitForLastComputeSegment();
+	void recordBarrierBatch(const vk::CommandBuffer& vulkanCommandBuffer, const RenderGraphBarrierBatch& barrierBatch) const;
+	const vk::ImageMemoryBarrier buildImageMemoryBarrier(const RenderGraphImageBarrier& imageBarrier) const;
+	void dumpBarrierBatch(std::ostringstream& schedule, const std::string& label, const RenderGraphBarrierBatch& barrierBatch) const;
+
+	const RenderGraphCreateInfo renderGraphCreateInfo;
+	std::vector<RenderGraphImageDescription> images;
+	std::vector<RenderGraphPassDescription> passes;
+	std::vector<CompiledPass> compiledPasses;
+	std::vector<RenderGraphSegment> segments;
+	RenderGraphBarrierBatch finalBarrierBatch;
+	bool isCompiled{ false };
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct RenderGraphAccess
+{
+	uint32_t imageHandle;
+	vk::PipelineStageFlags stageMask;
+	vk::AccessFlags accessMask;
+	vk::ImageLayout layout;
+};
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+#include "RenderGraphImageBarrier.h"
+
+struct RenderGraphBarrierBatch
+{
+	vk::PipelineStageFlags srcStageMask;
+	vk::PipelineStageFlags dstStageMask;
+	std::vector<RenderGraphImageBarrier> imageBarriers;
+};
\ No newline at end of file
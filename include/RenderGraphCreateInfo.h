@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+struct RenderGraphCreateInfo
+{
+	uint32_t graphicsFamilyIndex;
+	std::optional<uint32_t> computeFamilyIndex;
+};
\ No newline at end of file
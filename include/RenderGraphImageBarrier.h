@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct RenderGraphImageBarrier
+{
+	uint32_t imageHandle;
+	vk::AccessFlags srcAccessMask;
+	vk::AccessFlags dstAccessMask;
+	vk::ImageLayout oldLayout;
+	vk::ImageLayout newLayout;
+	uint32_t srcQueueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+	uint32_t dstQueueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+};
\ No newline at end of file
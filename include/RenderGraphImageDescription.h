@@ -0,0 +1,19 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <string>
+
+struct RenderGraphImageDescription
+{
+	std::string name;
+	vk::Image vulkanImage;
+	vk::ImageAspectFlags aspectMask{ vk::ImageAspectFlagBits::eColor };
+	uint32_t mipLevels{ 1 };
+	vk::ImageLayout initialLayout{ vk::ImageLayout::eUndefined };
+	vk::PipelineStageFlags initialStageMask{ vk::PipelineStageFlagBits::eTopOfPipe };
+	vk::ImageLayout finalLayout{ vk::ImageLayout::eUndefined };
+	vk::PipelineStageFlags finalStageMask{ vk::PipelineStageFlagBits::eBottomOfPipe };
+	bool isExternal{ false };
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "RenderGraphAccess.h"
+#include "RenderGraphQueue.h"
+
+struct RenderGraphPassDescription
+{
+	std::string name;
+	RenderGraphQueue queue{ RenderGraphQueue::eGraphics };
+	std::vector<RenderGraphAccess> reads;
+	std::vector<RenderGraphAccess> writes;
+	std::function<void(const vk::CommandBuffer&)> record;
+	bool hasSideEffects{ false };
+};
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+enum class RenderGraphQueue : uint32_t
+{
+	eGraphics,
+	eCompute
+};
\ No newline at end of file
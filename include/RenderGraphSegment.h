@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+#include "RenderGraphBarrierBatch.h"
+#include "RenderGraphQueue.h"
+#include "RenderGraphSemaphoreWait.h"
+
+struct RenderGraphSegment
+{
+	RenderGraphQueue queue;
+	std::vector<RenderGraphSemaphoreWait> waits;
+	RenderGraphBarrierBatch releaseBarrierBatch;
+};
\ No newline at end of file
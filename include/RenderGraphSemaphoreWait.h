@@ -0,0 +1,11 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct RenderGraphSemaphoreWait
+{
+	uint32_t segmentIndex;
+	vk::PipelineStageFlags stageMask;
+};
\ No newline at end of file
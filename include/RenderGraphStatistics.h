@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+struct RenderGraphStatistics
+{
+	uint32_t passCount;
+	uint32_t culledPassCount;
+	uint32_t segmentCount;
+	uint32_t queueOwnershipTransferCount;
+	uint32_t barrierBatchCount;
+	uint32_t imageBarrierCount;
+};
\ No newline at end of file
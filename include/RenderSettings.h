@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <optional>
+
+struct RenderSettings
+{
+	bool isCommandBufferCachingEnabled{ false };
+	int framesInFlight{ 2 };
+	vk::PresentModeKHR presentMode{ vk::PresentModeKHR::eMailbox };
+	std::optional<double> targetFrameRate;
+	bool isGpuProfilingEnabled{ false };
+	size_t gpuProfilerSampleCount{ 256 };
+	bool isFrameCaptureEnabled{ false };
+};
\ No newline at end of file
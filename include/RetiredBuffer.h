@@ -0,0 +1,15 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "MemoryAllocation.h"
+
+struct RetiredBuffer
+{
+	vk::Buffer vulkanBuffer;
+	MemoryAllocation memoryAllocation;
+	uint64_t frameNumber;
+	uint64_t copyTimelineValue;
+};
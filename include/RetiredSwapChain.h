@@ -0,0 +1,18 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Framebuffer.h"
+#include "ImageView.h"
+
+struct RetiredSwapChain
+{
+	vk::SwapchainKHR vulkanSwapChain;
+	std::vector<std::unique_ptr<ImageView>> imageViews;
+	std::vector<std::unique_ptr<Framebuffer>> framebuffers;
+	uint64_t frameNumber;
+};
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "RingMarker.h"
+
+class RingAllocator
+{
+public:
+	explicit RingAllocator(const uint64_t size);
+
+	std::optional<uint64_t> allocate(const uint64_t size, const uint64_t alignment);
+	const RingMarker createMarker();
+	void release(const RingMarker& ringMarker);
+
+	const uint64_t getSize() const;
+	const uint64_t getUsedSize() const;
+	const uint64_t getPendingSize() const;
+
+private:
+	void consume(const uint64_t consumedSize, const uint64_t newHead);
+
+	uint64_t size;
+	uint64_t head{ 0 };
+	uint64_t tail{ 0 };
+	uint64_t usedSize{ 0 };
+	uint64_t pendingSize{ 0 };
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+struct RingMarker
+{
+	uint64_t head;
+	uint64_t size;
+};
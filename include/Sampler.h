@@ -0,0 +1,19 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+
+class Sampler
+{
+public:
+	Sampler(const vk::Device& vulkanLogicalDevice, const vk::Filter filter);
+	~Sampler();
+
+	const vk::Sampler getVulkanSampler() const;
+
+private:
+	const vk::SamplerCreateInfo buildSamplerCreateInfo(const vk::Filter filter) const;
+
+	vk::Sampler vulkanSampler;
+	const vk::Device vulkanLogicalDevice;
+};
\ No newline at end of file
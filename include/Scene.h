@@ -0,0 +1,45 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Frustum.h"
+#include "SceneObjectCreateInfo.h"
+#include "ThreadPool.h"
+
+class Scene
+{
+public:
+	const uint32_t addObject(const SceneObjectCreateInfo& sceneObjectCreateInfo);
+	void setTransform(const uint32_t objectIndex, const glm::mat4& transform);
+	void reserve(const size_t objectCount);
+	void clear();
+	void cull(const Frustum& frustum, ThreadPool& threadPool);
+
+	const size_t getObjectCount() const;
+	const uint32_t getMeshIndex(const uint32_t objectIndex) const;
+	const glm::mat4& getTransform(const uint32_t objectIndex) const;
+	const glm::vec3 getWorldBoundsCenter(const uint32_t objectIndex) const;
+	const float getWorldBoundsRadius(const uint32_t objectIndex) const;
+	const std::vector<uint32_t>& getVisibleObjects() const;
+
+private:
+	void updateWorldBounds(const uint32_t objectIndex);
+	void cullRange(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visibleRange) const;
+	const size_t cullRangeSIMD(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visibleRange) const;
+
+	const size_t cullChunkSize{ 4096 };
+	std::vector<float> worldBoundsCenterX;
+	std::vector<float> worldBoundsCenterY;
+	std::vector<float> worldBoundsCenterZ;
+	std::vector<float> worldBoundsRadius;
+	std::vector<glm::vec3> localBoundsCenter;
+	std::vector<float> localBoundsRadius;
+	std::vector<glm::mat4> transforms;
+	std::vector<uint32_t> meshIndices;
+	std::vector<std::vector<uint32_t>> visibleChunks;
+	std::vector<uint32_t> visibleObjects;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <vector>
+
+#include "GeneratedScene.h"
+#include "Mesh.h"
+#include "Random.h"
+#include "SceneGeneratorCreateInfo.h"
+#include "SceneObjectCreateInfo.h"
+#include "ThreadPool.h"
+
+class SceneGenerator
+{
+public:
+	explicit SceneGenerator(const SceneGeneratorCreateInfo& sceneGeneratorCreateInfo);
+
+	GeneratedScene generate(ThreadPool& threadPool) const;
+
+private:
+	void buildMeshes(std::vector<Mesh>& meshes, ThreadPool& threadPool) const;
+	const Mesh buildTerrainMesh(ThreadPool& threadPool) const;
+	const Mesh buildColumnMesh(const uint32_t variant) const;
+	const Mesh buildBoxMesh() const;
+	const Mesh buildClutterMesh(const uint32_t variant) const;
+	void placeObjects(Scene& scene, const std::vector<Mesh>& meshes, ThreadPool& threadPool) const;
+	void placeGroups(std::vector<SceneObjectCreateInfo>& objects, const uint32_t groupCount, const uint64_t stream, ThreadPool& threadPool, const std::function<void(Random&, const uint32_t, std::vector<SceneObjectCreateInfo>&)>& placeGroup) const;
+	void placeColumnArray(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const;
+	void placeBoxStack(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const;
+	void placeClutterPatch(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const;
+	const SceneObjectCreateInfo buildObject(const uint32_t meshIndex, const glm::vec3& position, const float rotation, const glm::vec3& scale) const;
+	void addQuad(Mesh& mesh, const glm::vec3& corner, const glm::vec3& edge0, const glm::vec3& edge1, const glm::vec3& color) const;
+	void computeNormals(Mesh& mesh) const;
+	void computeBounds(Mesh& mesh) const;
+	const float terrainHeight(const float x, const float z) const;
+	const glm::vec3 terrainNormal(const float x, const float z, const float step) const;
+	const float valueNoise(const float x, const float z, const uint32_t octave) const;
+	const float latticeValue(const int32_t x, const int32_t z, const uint32_t octave) const;
+	static const float deterministicSin(const float angle);
+	static const float deterministicCos(const float angle);
+
+	const SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+	const uint32_t columnsPerArray{ 32 };
+	const uint32_t boxesPerStack{ 8 };
+	const uint32_t clutterPerPatch{ 64 };
+	const uint32_t terrainMeshIndex{ 0 };
+	const uint32_t boxMeshIndex{ 1 };
+	const uint32_t firstColumnMeshIndex{ 2 };
+	const uint32_t firstClutterMeshIndex;
+	const uint64_t columnVariantStream{ 1ull << 32 };
+	const uint64_t clutterVariantStream{ 2ull << 32 };
+	const uint64_t columnArrayStream{ 3ull << 32 };
+	const uint64_t boxStackStream{ 4ull << 32 };
+	const uint64_t clutterPatchStream{ 5ull << 32 };
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+struct SceneGeneratorCreateInfo
+{
+	uint64_t seed = 1;
+	float extent = 200.0f;
+	uint32_t terrainTriangleCount = 500000;
+	uint32_t columnCount = 256;
+	uint32_t columnTriangleCount = 2000;
+	uint32_t boxCount = 2048;
+	uint32_t clutterCount = 4096;
+	uint32_t clutterTriangleCount = 400;
+	uint32_t variantCount = 4;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+
+struct SceneObjectCreateInfo
+{
+	uint32_t meshIndex;
+	glm::vec3 boundsCenter;
+	float boundsRadius;
+	glm::mat4 transform;
+};
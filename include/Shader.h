@@ -2,24 +2,18 @@
 
 #define VULKAN_HPP_NO_CONSTRUCTORS
 #include <vulkan/vulkan.hpp>
-#include <string>
 #include <vector>
-#include <fstream>
-#include <iostream>
-
-#include "ExceptionChecker.h"
 
 class Shader
 {
 public:
-	Shader(const std::string& filename, const vk::Device& vulkanLogicalDevice, const vk::ShaderStageFlagBits stage);
+	Shader(const std::vector<uint32_t>& spirv, const vk::Device& vulkanLogicalDevice, const vk::ShaderStageFlagBits stage);
 	~Shader();
 
-	const vk::PipelineShaderStageCreateInfo buildPipelineShaderStageCreateInfo() const;
+	const vk::PipelineShaderStageCreateInfo buildPipelineShaderStageCreateInfo(const vk::SpecializationInfo* specializationInfo = nullptr) const;
 
 private:
-	const std::vector<char> readFile(const std::string& filename) const;
-	void createShaderModule(const std::vector<char>& shaderCode, const vk::Device& vulkanLogicalDevice);
+	void createShaderModule(const std::vector<uint32_t>& spirv, const vk::Device& vulkanLogicalDevice);
 
 	const vk::Device vulkanLogicalDevice;
 	vk::ShaderModule vulkanShaderModule;
@@ -0,0 +1,48 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <shaderc/shaderc.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CompiledShader.h"
+#include "ExceptionChecker.h"
+#include "ShaderCompilerCreateInfo.h"
+#include "ShaderCompilerStatistics.h"
+#include "ShaderIncluder.h"
+#include "ShaderSourceDescription.h"
+
+class ShaderCompiler
+{
+public:
+	explicit ShaderCompiler(const ShaderCompilerCreateInfo& shaderCompilerCreateInfo);
+
+	const CompiledShader compile(const ShaderSourceDescription& shaderSourceDescription);
+	const ShaderCompilerStatistics getStatistics() const;
+
+private:
+	static const shaderc_shader_kind toShaderKind(const vk::ShaderStageFlagBits stage);
+	static void hashBytes(uint64_t& hash, const void* data, const size_t size);
+	const std::string readSource(const std::filesystem::path& path) const;
+	static const std::string stripComments(const std::string& source);
+	void collectDependencies(const std::filesystem::path& path, std::vector<std::filesystem::path>& dependencies) const;
+	const uint64_t computeHash(const ShaderSourceDescription& shaderSourceDescription, const std::vector<std::filesystem::path>& dependencies) const;
+	const std::filesystem::path buildCachePath(const uint64_t hash) const;
+	const std::optional<std::vector<uint32_t>> loadCachedSpirv(const uint64_t hash) const;
+	void storeCachedSpirv(const uint64_t hash, const std::vector<uint32_t>& spirv) const;
+	const std::vector<uint32_t> compileSource(const ShaderSourceDescription& shaderSourceDescription) const;
+
+	const shaderc::Compiler compiler;
+	const std::filesystem::path cacheDirectory;
+	const bool isOptimizationEnabled;
+	ShaderCompilerStatistics shaderCompilerStatistics{};
+};
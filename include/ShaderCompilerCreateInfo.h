@@ -0,0 +1,9 @@
+#pragma once
+
+#include <filesystem>
+
+struct ShaderCompilerCreateInfo
+{
+	std::filesystem::path cacheDirectory{ "cache/shaders" };
+	bool isOptimizationEnabled{ true };
+};
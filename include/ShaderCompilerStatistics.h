@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct ShaderCompilerStatistics
+{
+	uint32_t compiledShaderCount;
+	uint32_t cachedShaderCount;
+	double compilationMilliseconds;
+};
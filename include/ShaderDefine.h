@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+struct ShaderDefine
+{
+	std::string name;
+	std::string value;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <shaderc/shaderc.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+class ShaderIncluder : public shaderc::CompileOptions::IncluderInterface
+{
+public:
+	shaderc_include_result* GetInclude(const char* requestedSource, shaderc_include_type type, const char* requestingSource, size_t includeDepth) override;
+	void ReleaseInclude(shaderc_include_result* data) override;
+
+	static const std::filesystem::path resolve(const std::filesystem::path& requestedSource, const std::filesystem::path& requestingSource);
+
+private:
+	struct IncludeResult
+	{
+		shaderc_include_result result;
+		std::string sourceName;
+		std::string content;
+	};
+};
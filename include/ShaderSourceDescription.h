@@ -0,0 +1,15 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <filesystem>
+#include <vector>
+
+#include "ShaderDefine.h"
+
+struct ShaderSourceDescription
+{
+	std::filesystem::path path;
+	vk::ShaderStageFlagBits stage;
+	std::vector<ShaderDefine> defines;
+};
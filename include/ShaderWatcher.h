@@ -0,0 +1,31 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <set>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+class ShaderWatcher
+{
+public:
+	explicit ShaderWatcher(const std::filesystem::path& directory);
+	~ShaderWatcher();
+
+	void watch(const std::set<std::filesystem::path>& files);
+	const std::set<std::filesystem::path> poll();
+
+private:
+	void addDirectory(const std::filesystem::path& directory);
+	void fallBackToPolling();
+	const std::map<std::filesystem::path, std::filesystem::file_time_type> scanDirectories() const;
+
+	std::set<std::filesystem::path> directories;
+	std::map<int, std::filesystem::path> watchDescriptorDirectories;
+	int inotifyFileDescriptor{ -1 };
+	std::map<std::filesystem::path, std::filesystem::file_time_type> lastWriteTimes;
+};
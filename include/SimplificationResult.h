@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct SimplificationResult
+{
+	std::vector<uint32_t> indices;
+	float error;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstring>
+#include <vector>
+
+class SpecializationConstants
+{
+public:
+	template <typename T>
+	void add(const uint32_t constantID, const T& value)
+	{
+		mapEntries.push_back(vk::SpecializationMapEntry{
+			.constantID = constantID,
+			.offset = static_cast<uint32_t>(data.size()),
+			.size = sizeof(T)
+		});
+		data.resize(data.size() + sizeof(T));
+		std::memcpy(data.data() + data.size() - sizeof(T), &value, sizeof(T));
+	}
+
+	const vk::SpecializationInfo buildSpecializationInfo() const;
+
+private:
+	std::vector<vk::SpecializationMapEntry> mapEntries;
+	std::vector<uint8_t> data;
+};
@@ -12,6 +12,7 @@
 #include "ExceptionChecker.h"
 #include "Framebuffer.h"
 #include "ImageView.h"
+#include "RetiredSwapChain.h"
 
 class SwapChain
 {
@@ -23,20 +24,28 @@ public:
 	vk::Result acquireNextImage(vk::Semaphore& imageAvailable, const vk::RenderPass& vulkanRenderPass, uint32_t& imageIndex);
 	void buildFramebuffers(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass);
 	void recreateIfResultIsOutOfDateOrSuboptimalKHR(vk::Result& result, const SwapChainRecreateInfo& swapChainRecreateInfo);
+	void releaseRetiredSwapChains(const uint64_t completedFrameCount);
 
 	const vk::Extent2D getExtent() const;
 	const vk::Framebuffer getVulkanFramebuffer(const int framebufferIndex) const;
+	const vk::Image getVulkanImage(const int imageIndex) const;
+	const uint32_t getImageCount() const;
 	const vk::SurfaceFormatKHR getSurfaceFormat() const;
+	const vk::PresentModeKHR getPresentMode() const;
+	const vk::ImageUsageFlags getImageUsage() const;
 	const vk::SwapchainKHR getVulkanSwapChain() const;
 
 private:
 	void chooseSwapSurfaceFormat(const std::vector<vk::SurfaceFormatKHR>& availableFormats);
 	void chooseSwapPresentMode(const std::vector<vk::PresentModeKHR>& availablePresentModes);
 	void chooseSwapExtent(const vk::SurfaceCapabilitiesKHR& capabilities, const WindowSize& framebufferSize);
+	void chooseSwapImageUsage(const vk::SurfaceCapabilitiesKHR& capabilities);
 	const uint32_t estimateImageCount(const vk::SurfaceCapabilitiesKHR& capabilities);
-	void buildVulkanSwapChain(const SwapChainCreateInfo& swapChainCreateInfo, const vk::SurfaceCapabilitiesKHR& capabilities, const uint32_t imageCount);
+	void buildVulkanSwapChain(const SwapChainCreateInfo& swapChainCreateInfo, const vk::SurfaceCapabilitiesKHR& capabilities, const uint32_t imageCount, const vk::SwapchainKHR& oldVulkanSwapChain = nullptr);
 	void buildSwapChainImageViews(const SwapChainCreateInfo& swapChainCreateInfo); 
-	void waitValidFramebufferSize(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	const WindowSize waitValidFramebufferSize(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents);
+	void retire(const uint64_t frameNumber);
+	void destroyRetiredSwapChain(RetiredSwapChain& retiredSwapChain);
 	void cleanup();
 
 	const SwapChainCreateInfo swapChainCreateInfo;
@@ -44,7 +53,9 @@ private:
 	std::vector<vk::Image> images; 
 	std::vector<std::unique_ptr<ImageView>> imageViews;
 	std::vector<std::unique_ptr<Framebuffer>> framebuffers;
+	std::vector<RetiredSwapChain> retiredSwapChains;
 	vk::SurfaceFormatKHR surfaceFormat;
 	vk::PresentModeKHR presentMode;
+	vk::ImageUsageFlags imageUsage;
 	vk::Extent2D extent;
 };
\ No newline at end of file
@@ -14,4 +14,6 @@ struct SwapChainCreateInfo
 	WindowSize framebufferSize;
 	QueueFamilyIndices queueFamilyIndices;
 	vk::Device vulkanLogicalDevice;
+	vk::PresentModeKHR requestedPresentMode;
+	vk::ImageUsageFlags requestedImageUsage;
 };
\ No newline at end of file
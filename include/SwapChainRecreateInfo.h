@@ -9,4 +9,5 @@ struct SwapChainRecreateInfo
 	vk::RenderPass vulkanRenderPass;
 	std::function<WindowSize()> getFramebufferSize;
 	std::function<void()> waitEvents;
+	uint64_t frameNumber;
 };
\ No newline at end of file
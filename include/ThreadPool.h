@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+	explicit ThreadPool(const unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency()));
+	~ThreadPool();
+
+	template<typename F>
+	std::future<std::invoke_result_t<F>> submit(F&& task)
+	{
+		using ResultType = std::invoke_result_t<F>;
+		auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(task));
+		std::future<ResultType> result{ packagedTask->get_future() };
+		{
+			std::lock_guard<std::mutex> lock(tasksMutex);
+			tasks.emplace([packagedTask]() { (*packagedTask)(); });
+		}
+		tasksCondition.notify_one();
+		return result;
+	}
+
+	void parallelFor(const size_t count, const size_t chunkSize, const std::function<void(const size_t, const size_t, const size_t)>& task);
+	const unsigned int getThreadCount() const;
+
+private:
+	void runWorker();
+
+	std::vector<std::thread> workers;
+	std::queue<std::function<void()>> tasks;
+	std::mutex tasksMutex;
+	std::condition_variable tasksCondition;
+	bool isStopping{ false };
+};
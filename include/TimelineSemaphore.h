@@ -0,0 +1,23 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "ExceptionChecker.h"
+
+class TimelineSemaphore
+{
+public:
+	explicit TimelineSemaphore(const vk::Device& vulkanLogicalDevice);
+	~TimelineSemaphore();
+
+	void wait(const uint64_t value) const;
+	const bool waitFor(const uint64_t value, const uint64_t timeout) const;
+	const uint64_t getCompletedValue() const;
+	const vk::Semaphore getVulkanSemaphore() const;
+
+private:
+	vk::Semaphore vulkanSemaphore;
+	const vk::Device vulkanLogicalDevice;
+};
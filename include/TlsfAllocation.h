@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct TlsfAllocation
+{
+	uint64_t offset;
+	uint64_t size;
+	uint32_t handle;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "ExceptionChecker.h"
+#include "TlsfAllocation.h"
+
+class TlsfAllocator
+{
+public:
+	static constexpr uint64_t minimumAlignment{ 16 };
+
+	explicit TlsfAllocator(const uint64_t size);
+
+	std::optional<TlsfAllocation> allocate(const uint64_t size, const uint64_t alignment);
+	void free(const uint32_t handle);
+
+	const uint64_t getSize() const;
+	const uint64_t getUsedSize() const;
+	const uint64_t getLargestFreeRange() const;
+	const uint32_t getAllocationCount() const;
+	const bool isEmpty() const;
+
+private:
+	struct Range
+	{
+		uint64_t offset;
+		uint64_t size;
+		uint32_t previousPhysical;
+		uint32_t nextPhysical;
+		uint32_t previousFree;
+		uint32_t nextFree;
+		bool isFree;
+	};
+
+	static constexpr uint32_t secondLevelCountLog2{ 5 };
+	static constexpr uint32_t secondLevelCount{ 1u << secondLevelCountLog2 };
+	static constexpr uint32_t firstLevelCount{ 64 - secondLevelCountLog2 + 1 };
+	static constexpr uint32_t invalidRange{ UINT32_MAX };
+
+	void mapping(const uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const;
+	const uint32_t findFreeRange(const uint64_t size, const uint64_t alignment) const;
+	const uint32_t findFittingRangeInFreeList(const uint32_t firstLevel, const uint32_t secondLevel, const uint64_t size, const uint64_t alignment) const;
+	void insertFreeRange(const uint32_t rangeIndex);
+	void removeFreeRange(const uint32_t rangeIndex);
+	const uint32_t splitRange(const uint32_t rangeIndex, const uint64_t size);
+	void mergeWithNextRange(const uint32_t rangeIndex);
+	const uint32_t createRange(const Range& range);
+	void destroyRange(const uint32_t rangeIndex);
+
+	std::vector<Range> ranges;
+	std::vector<uint32_t> unusedRanges;
+	std::array<std::array<uint32_t, secondLevelCount>, firstLevelCount> freeLists;
+	std::array<uint32_t, firstLevelCount> secondLevelBitmaps{};
+	uint64_t firstLevelBitmap{ 0 };
+	uint64_t size;
+	uint64_t usedSize{ 0 };
+	uint32_t allocationCount{ 0 };
+};
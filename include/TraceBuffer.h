@@ -0,0 +1,26 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "TraceEvent.h"
+
+class TraceBuffer
+{
+public:
+	TraceBuffer(const uint32_t threadIndex, const size_t capacity);
+
+	void push(const TraceEvent& traceEvent);
+	void drain(std::vector<TraceEvent>& traceEvents);
+
+	const uint32_t getThreadIndex() const;
+	const uint64_t getDroppedEventCount() const;
+
+private:
+	const uint32_t threadIndex;
+	std::vector<TraceEvent> traceEvents;
+	std::atomic<uint64_t> writeIndex{ 0 };
+	std::atomic<uint64_t> readIndex{ 0 };
+	std::atomic<uint64_t> droppedEventCount{ 0 };
+};
\ No newline at end of file
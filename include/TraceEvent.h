@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct TraceEvent
+{
+	const char* name;
+	int64_t startNanoseconds;
+	int64_t endNanoseconds;
+};
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Tracer.h"
+
+class TraceZone
+{
+public:
+	explicit TraceZone(const char* name);
+	~TraceZone();
+
+	TraceZone(const TraceZone&) = delete;
+	TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+	const char* name;
+	const int64_t startNanoseconds;
+};
+
+#define TRACE_CONCATENATE_IMPLEMENTATION(first, second) first##second
+#define TRACE_CONCATENATE(first, second) TRACE_CONCATENATE_IMPLEMENTATION(first, second)
+#ifdef ENABLE_TRACING
+#define TRACE_ZONE(name) const TraceZone TRACE_CONCATENATE(traceZone, __LINE__){ name }
+#else
+#define TRACE_ZONE(name)
+#endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "GpuTraceEvent.h"
+#include "TraceBuffer.h"
+#include "TraceEvent.h"
+
+class Tracer
+{
+public:
+	static Tracer& getInstance();
+
+	const int64_t getNanoseconds() const;
+	void addZone(const char* name, const int64_t startNanoseconds, const int64_t endNanoseconds);
+	void addGpuZone(const GpuTraceEvent& gpuTraceEvent);
+	void calibrateGpuClock(const int64_t cpuNanoseconds, const int64_t gpuNanoseconds);
+	void writeChromeTrace(const std::filesystem::path& filePath);
+
+private:
+	struct ThreadTraceEvents
+	{
+		uint32_t threadIndex;
+		std::vector<TraceEvent> traceEvents;
+	};
+
+	Tracer() = default;
+
+	TraceBuffer& getThreadBuffer();
+	void drainThreadBuffers();
+	const uint64_t getDroppedEventCount() const;
+	void writeCpuEvents(std::ofstream& file, bool& isFirstEvent) const;
+	void writeGpuEvents(std::ofstream& file, bool& isFirstEvent) const;
+	void writeEvent(std::ofstream& file, bool& isFirstEvent, const std::string& name, const uint32_t processIndex, const uint32_t threadIndex, const int64_t startNanoseconds, const int64_t endNanoseconds) const;
+
+	const std::chrono::steady_clock::time_point startTime{ std::chrono::steady_clock::now() };
+	const size_t threadBufferCapacity{ 1 << 16 };
+	const size_t maximumThreadEventCount{ 1 << 20 };
+	const size_t maximumGpuEventCount{ 1 << 20 };
+	std::vector<std::shared_ptr<TraceBuffer>> threadBuffers;
+	std::vector<ThreadTraceEvents> threadTraceEvents;
+	std::vector<GpuTraceEvent> gpuTraceEvents;
+	int64_t gpuClockOffsetNanoseconds{ std::numeric_limits<int64_t>::max() };
+	uint64_t droppedThreadEventCount{ 0 };
+	uint64_t droppedGpuEventCount{ 0 };
+	std::mutex mutex;
+};
\ No newline at end of file
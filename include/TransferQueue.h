@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Queue.h"
+
+class TransferQueue : public Queue
+{
+public:
+	TransferQueue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex);
+	void submit(const vk::CommandBuffer& vulkanCommandBuffer, const vk::Semaphore& timelineSemaphore, const uint64_t signalValue);
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ImageCreateInfo.h"
+
+struct TransientImageDescription
+{
+	ImageCreateInfo imageCreateInfo;
+	uint32_t firstPass;
+	uint32_t lastPass;
+	bool isAliasable{ true };
+};
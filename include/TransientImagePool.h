@@ -0,0 +1,35 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
+
+#include "DeviceMemoryAllocator.h"
+#include "ExceptionChecker.h"
+#include "Image.h"
+#include "TransientImageDescription.h"
+#include "TransientMemoryPlanner.h"
+#include "TransientMemoryStatistics.h"
+
+class TransientImagePool
+{
+public:
+	explicit TransientImagePool(const std::shared_ptr<DeviceMemoryAllocator>& deviceMemoryAllocator);
+	~TransientImagePool();
+
+	const uint32_t addImage(const TransientImageDescription& transientImageDescription);
+	void allocate();
+
+	const Image& getImage(const uint32_t imageIndex) const;
+	const TransientMemoryStatistics getStatistics() const;
+
+private:
+	void allocateAliasedMemory(const bool isTransient);
+
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::vector<std::unique_ptr<Image>> images;
+	std::vector<TransientImageDescription> transientImageDescriptions;
+	std::vector<MemoryAllocation> memoryAllocations;
+	TransientMemoryStatistics transientMemoryStatistics{};
+};
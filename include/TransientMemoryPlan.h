@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct TransientMemoryPlan
+{
+	std::vector<uint64_t> offsets;
+	uint64_t size;
+	uint64_t unaliasedSize;
+};
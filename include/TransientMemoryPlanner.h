@@ -0,0 +1,21 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "TransientMemoryPlan.h"
+#include "TransientResourceRequest.h"
+
+class TransientMemoryPlanner
+{
+public:
+	static const TransientMemoryPlan plan(const std::vector<TransientResourceRequest>& transientResourceRequests);
+
+private:
+	static const uint64_t findOffset(const std::vector<TransientResourceRequest>& transientResourceRequests, const std::vector<uint64_t>& offsets, const std::vector<uint32_t>& placedRequests, const uint32_t requestIndex);
+	static const bool canAlias(const TransientResourceRequest& firstRequest, const TransientResourceRequest& secondRequest);
+	static const bool lifetimesOverlap(const TransientResourceRequest& firstRequest, const TransientResourceRequest& secondRequest);
+	static const uint64_t alignUp(const uint64_t offset, const uint64_t alignment);
+};
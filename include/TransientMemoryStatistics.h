@@ -0,0 +1,13 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct TransientMemoryStatistics
+{
+	uint32_t imageCount;
+	vk::DeviceSize unaliasedBytes;
+	vk::DeviceSize allocatedBytes;
+	vk::DeviceSize lazilyAllocatedBytes;
+};
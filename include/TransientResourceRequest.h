@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+struct TransientResourceRequest
+{
+	uint64_t size;
+	uint64_t alignment;
+	uint32_t firstPass;
+	uint32_t lastPass;
+	bool isAliasable{ true };
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstring>
+#include <memory>
+
+#include "DescriptorPool.h"
+#include "DescriptorSetLayout.h"
+#include "LinearMemoryPool.h"
+#include "UniformRingCreateInfo.h"
+
+class UniformRing
+{
+public:
+	explicit UniformRing(const UniformRingCreateInfo& uniformRingCreateInfo);
+
+	void beginFrame(const uint32_t frameIndex);
+
+	template <typename T>
+	const uint32_t write(const T& uniforms)
+	{
+		if (sizeof(T) > uniformSize)
+		{
+			throw std::runtime_error("Error in UniformRing! Uniform data is larger than the descriptor range");
+		}
+		const LinearMemoryAllocation linearMemoryAllocation{ linearMemoryPool->allocate(uniformSize, uniformAlignment) };
+		std::memcpy(linearMemoryAllocation.mappedData, &uniforms, sizeof(T));
+		return static_cast<uint32_t>(linearMemoryAllocation.offset);
+	}
+
+	const vk::DescriptorSetLayout getVulkanDescriptorSetLayout() const;
+	const vk::DescriptorSet getVulkanDescriptorSet() const;
+
+private:
+	void createDescriptorSetLayout(const vk::ShaderStageFlags& shaderStages);
+	void createDescriptorPool();
+	void writeDescriptorSet() const;
+
+	const vk::Device vulkanLogicalDevice;
+	const vk::DeviceSize uniformSize;
+	const vk::DeviceSize uniformAlignment;
+	std::unique_ptr<LinearMemoryPool> linearMemoryPool;
+	std::unique_ptr<DescriptorSetLayout> descriptorSetLayout;
+	std::unique_ptr<DescriptorPool> descriptorPool;
+	vk::DescriptorSet vulkanDescriptorSet;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
+
+#include "DeviceMemoryAllocator.h"
+
+struct UniformRingCreateInfo
+{
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	vk::DeviceSize uniformSize;
+	vk::DeviceSize minUniformBufferOffsetAlignment;
+	uint32_t frameCount;
+	uint32_t uniformsPerFrame{ 4 };
+	vk::ShaderStageFlags shaderStages{ vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment };
+	std::vector<uint32_t> sharingQueueFamilyIndices;
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "RingMarker.h"
+
+struct UploadBatch
+{
+	vk::CommandBuffer vulkanCommandBuffer;
+	uint64_t timelineValue;
+	RingMarker ringMarker;
+};
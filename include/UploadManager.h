@@ -0,0 +1,70 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "CommandBuffer.h"
+#include "CommandPool.h"
+#include "DeviceMemoryAllocator.h"
+#include "ExceptionChecker.h"
+#include "RingAllocator.h"
+#include "TimelineSemaphore.h"
+#include "TransferQueue.h"
+#include "UploadBatch.h"
+#include "UploadManagerCreateInfo.h"
+#include "UploadStatistics.h"
+
+class UploadManager
+{
+public:
+	explicit UploadManager(const UploadManagerCreateInfo& uploadManagerCreateInfo);
+	~UploadManager();
+
+	const uint64_t upload(const vk::Buffer& vulkanDstBuffer, const MemoryAllocation& dstMemoryAllocation, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size);
+	const uint64_t copy(const vk::Buffer& vulkanSrcBuffer, const vk::Buffer& vulkanDstBuffer, const std::vector<vk::BufferCopy>& bufferCopyRegions);
+	void flush();
+	void collectCompletedUploads();
+	void waitForUploads();
+
+	const vk::Semaphore getVulkanTimelineSemaphore() const;
+	const uint64_t getCompletedTimelineValue() const;
+	const std::vector<uint32_t>& getSharingQueueFamilyIndices() const;
+	const UploadStatistics getStatistics();
+
+private:
+	const vk::BufferCreateInfo buildStagingBufferCreateInfo(const vk::DeviceSize stagingSize) const;
+	const bool isZeroCopyDestination(const MemoryAllocation& dstMemoryAllocation) const;
+	void write(const MemoryAllocation& dstMemoryAllocation, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size);
+	void stage(const vk::Buffer& vulkanDstBuffer, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size);
+	const vk::DeviceSize reserveStagingMemory(const vk::DeviceSize size);
+	UploadBatch& getRecordingBatch();
+	void submitRecordingBatch();
+	void collectCompletedBatches();
+	void waitForOldestBatch();
+	void releaseOldestBatch();
+
+	const vk::DeviceSize stagingAlignment{ 16 };
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<TransferQueue> transferQueue;
+	const vk::Device vulkanLogicalDevice;
+	const std::vector<uint32_t> sharingQueueFamilyIndices;
+	std::unique_ptr<CommandPool> commandPool;
+	std::unique_ptr<CommandBuffer> commandBuffers;
+	std::unique_ptr<TimelineSemaphore> timelineSemaphore;
+	uint64_t nextTimelineValue{ 1 };
+	vk::Buffer vulkanStagingBuffer;
+	MemoryAllocation stagingMemoryAllocation;
+	RingAllocator ringAllocator;
+	std::vector<UploadBatch> uploadBatches;
+	std::vector<uint32_t> freeBatchIndices;
+	std::deque<uint32_t> submittedBatchIndices;
+	std::optional<uint32_t> recordingBatchIndex;
+	UploadStatistics uploadStatistics{};
+	std::mutex uploadMutex;
+};
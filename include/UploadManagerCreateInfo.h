@@ -0,0 +1,19 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <memory>
+#include <vector>
+
+#include "DeviceMemoryAllocator.h"
+#include "TransferQueue.h"
+
+struct UploadManagerCreateInfo
+{
+	std::shared_ptr<DeviceMemoryAllocator> deviceMemoryAllocator;
+	std::shared_ptr<TransferQueue> transferQueue;
+	uint32_t transferFamilyIndex;
+	std::vector<uint32_t> sharingQueueFamilyIndices;
+	vk::DeviceSize stagingSize{ 32ull * 1024 * 1024 };
+	uint32_t batchCount{ 4 };
+};
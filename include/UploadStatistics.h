@@ -0,0 +1,16 @@
+#pragma once
+
+#define VULKAN_HPP_NO_CONSTRUCTORS
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+struct UploadStatistics
+{
+	uint32_t zeroCopyUploadCount;
+	vk::DeviceSize zeroCopyBytes;
+	double zeroCopyMilliseconds;
+	uint32_t stagedUploadCount;
+	vk::DeviceSize stagedBytes;
+	double stagedMilliseconds;
+	double initialUploadMilliseconds;
+};
@@ -8,11 +8,13 @@ class Vertex
 {
 public:
 	static const vk::VertexInputBindingDescription getBindingDescription();
-	static const std::array<vk::VertexInputAttributeDescription, 2> getAttributeDescriptions();
-	glm::vec2 position;
+	static const std::array<vk::VertexInputAttributeDescription, 3> getAttributeDescriptions();
+	glm::vec3 position;
 	glm::vec3 color;
+	glm::vec3 normal;
 
 private:
 	static const vk::VertexInputAttributeDescription getPositionAttributeDescription();
 	static const vk::VertexInputAttributeDescription getColorAttributeDescription();
+	static const vk::VertexInputAttributeDescription getNormalAttributeDescription();
 };
\ No newline at end of file
@@ -1,16 +1,12 @@
 #pragma once
 
 #include "Buffer.h"
+#include "BufferCreateInfo.h"
 #include "Vertex.h"
-#include "ContentBufferCreateInfo.h"
 
 class VertexBuffer : public Buffer
 {
 public:
-	VertexBuffer(const ContentBufferCreateInfo<Vertex>& contentBufferCreateInfo);
-	const size_t getVertexCount() const;
-
-private:
-	void createVertexData(const std::vector<Vertex>& vertices, const vk::PhysicalDevice& vulkanPhysicalDevice);
-	size_t vertexCount;
+	explicit VertexBuffer(const BufferCreateInfo& bufferCreateInfo);
+	const uint32_t allocate(const std::vector<Vertex>& vertices);
 };
@@ -4,18 +4,21 @@
 #include <string>
 #include <functional>
 
+#include "TraceZone.h"
 #include "WindowSize.h"
 
 class Window
 {
 public:
-	Window(const int width, const int height, const std::string& title);
+	Window(const int width, const int height, const std::string& title, const bool isVisible = true);
 	~Window();
 	
 	GLFWwindow* getGLFWWindow() const noexcept;
 	WindowSize getFramebufferSize() const;
 	void waitEvents() const;
-	void open(std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame);
+	void pollEvents() const;
+	const bool isKeyPressed(const int key) const;
+	void open(std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame, std::function<void()> waitForNextFrame);
 
 private:
 	void setGlfwWindowHints() const;
@@ -24,5 +27,6 @@ private:
 	const int width;
 	const int height;
 	const std::string title;
+	const bool isVisible;
 	GLFWwindow* glfwWindow;
 };
\ No newline at end of file
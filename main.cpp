@@ -6,12 +6,43 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <map>
 #include <stdexcept>
 
 #include "AmbientOcclusionApplication.h"
 #include "ArgumentParser.h"
 #include "JSONConfigurationFileParser.h"
 
+const vk::PresentModeKHR convertToPresentMode(const std::string& presentMode)
+{
+    const std::map<std::string, vk::PresentModeKHR> presentModes{
+        { "immediate", vk::PresentModeKHR::eImmediate },
+        { "mailbox", vk::PresentModeKHR::eMailbox },
+        { "fifo", vk::PresentModeKHR::eFifo },
+        { "fifoRelaxed", vk::PresentModeKHR::eFifoRelaxed }
+    };
+    if (!presentModes.contains(presentMode))
+    {
+        throw std::runtime_error("Error in the configuration file! Unknown present mode " + presentMode);
+    }
+    return presentModes.at(presentMode);
+}
+
+const RenderSettings buildRenderSettings(const RenderingConfigurationModel& renderingConfigurationModel)
+{
+    if (renderingConfigurationModel.framesInFlight < 1 || renderingConfigurationModel.framesInFlight > 4)
+    {
+        throw std::runtime_error("Error in the configuration file! Frames in flight must be between 1 and 4");
+    }
+    return RenderSettings{
+        .isCommandBufferCachingEnabled = renderingConfigurationModel.cacheCommandBuffers,
+        .framesInFlight = renderingConfigurationModel.framesInFlight,
+        .presentMode = convertToPresentMode(renderingConfigurationModel.presentMode),
+        .targetFrameRate = renderingConfigurationModel.targetFrameRate > 0.0 ? std::optional<double>(renderingConfigurationModel.targetFrameRate) : std::nullopt,
+        .isGpuProfilingEnabled = renderingConfigurationModel.profileGpu
+    };
+}
+
 int main(const int argc, const char *argv[]) 
 {
     try 
@@ -19,7 +50,8 @@ int main(const int argc, const char *argv[])
         ArgumentParser argumentParser{argc, argv};
         JSONConfigurationFileParser JSONConfigurationFileParser{argumentParser.getConfigurationFile().c_str()};
         ConfigurationFileModel configurationFileModel{JSONConfigurationFileParser.getConfigurationFileModel()};
-        AmbientOcclusionApplication app{configurationFileModel.window.width, configurationFileModel.window.height};
+        const RenderSettings renderSettings{ buildRenderSettings(configurationFileModel.rendering) };
+        AmbientOcclusionApplication app{configurationFileModel.window.width, configurationFileModel.window.height, renderSettings};
         app.run();
     } catch (const vk::SystemError &error) 
     {
@@ -1,3 +0,0 @@
-C:/Libraries/VulkanSDK/1.3.211.0/Bin/glslc.exe shader.vert -o vert.spv
-C:/Libraries/VulkanSDK/1.3.211.0/Bin/glslc.exe shader.frag -o frag.spv
-pause
\ No newline at end of file
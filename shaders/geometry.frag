@@ -0,0 +1,21 @@
+#version 450
+
+layout(set = 0, binding = 0) uniform FrameUniforms {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 ambientOcclusionParameters;
+    vec4 ambientOcclusionKernel[16];
+} frameUniforms;
+
+layout(location = 0) in vec3 fragColor;
+layout(location = 1) in vec3 fragNormal;
+layout(location = 2) in vec3 fragPosition;
+
+layout(location = 0) out vec4 outNormalDepth;
+
+void main() {
+    vec3 viewNormal = length(fragNormal) > 0.0 ? normalize(mat3(frameUniforms.view) * fragNormal) : vec3(0.0);
+    float viewDepth = -(frameUniforms.view * vec4(fragPosition, 1.0)).z;
+    outNormalDepth = vec4(viewNormal, viewDepth);
+}
\ No newline at end of file
@@ -1,9 +1,36 @@
 #version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+const uint AMBIENT_OCCLUSION_SLOT = 1;
+
+layout(set = 0, binding = 0) uniform FrameUniforms {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 ambientOcclusionParameters;
+    vec4 ambientOcclusionKernel[16];
+} frameUniforms;
+
+layout(set = 1, binding = 0) uniform sampler2D sampledImages[];
+
+layout(push_constant) uniform BindlessPushConstants {
+    uint resourceHandles[4];
+} bindlessPushConstants;
 
 layout(location = 0) in vec3 fragColor;
+layout(location = 1) in vec3 fragNormal;
+layout(location = 2) in vec3 fragPosition;
 
 layout(location = 0) out vec4 outColor;
 
 void main() {
-    outColor = vec4(fragColor, 1.0);
+    if (length(fragNormal) == 0.0) {
+        outColor = vec4(fragColor, 1.0);
+        return;
+    }
+    vec3 normal = normalize(fragNormal);
+    float intensity = frameUniforms.ambientOcclusionParameters.z;
+    float occlusion = texelFetch(sampledImages[bindlessPushConstants.resourceHandles[AMBIENT_OCCLUSION_SLOT]], ivec2(gl_FragCoord.xy), 0).r;
+    float hemisphere = 0.5 + 0.5 * normal.y;
+    outColor = vec4(fragColor * mix(0.5, 1.0, hemisphere) * (1.0 - intensity * occlusion), 1.0);
 }
\ No newline at end of file
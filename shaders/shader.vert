@@ -1,11 +1,24 @@
 #version 450
 
-layout(location = 0) in vec2 inPosition;
+layout(set = 0, binding = 0) uniform FrameUniforms {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 ambientOcclusionParameters;
+    vec4 ambientOcclusionKernel[16];
+} frameUniforms;
+
+layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec3 inNormal;
 
 layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec3 fragPosition;
 
 void main() {
-    gl_Position = vec4(inPosition, 0.0, 1.0);
+    gl_Position = frameUniforms.projection * frameUniforms.view * vec4(inPosition, 1.0);
     fragColor = inColor;
+    fragNormal = inNormal;
+    fragPosition = inPosition;
 }
\ No newline at end of file
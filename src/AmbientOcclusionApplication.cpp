@@ -1,14 +1,18 @@
 #include "AmbientOcclusionApplication.h"
 
-AmbientOcclusionApplication::AmbientOcclusionApplication(const int windowWidth, const int windowHeight)
+AmbientOcclusionApplication::AmbientOcclusionApplication(const int windowWidth, const int windowHeight, const RenderSettings& renderSettings) : renderSettings(renderSettings), framePacer(renderSettings.targetFrameRate)
 {
 	const std::string applicationName{ "Ambient Occlusion Application" };
 	window = std::make_shared<Window>(windowWidth, windowHeight, applicationName);
 	graphicsInstance = std::make_shared<GraphicsInstance>(applicationName);
 	graphicsInstance->createWindowSurface(window->getGLFWWindow());
 	graphicsInstance->selectPhysicalDevice();
-	graphicsInstance->createLogicalDevice(window->getFramebufferSize(), vertices, indices);
-	graphicsInstance->createGraphicsPipeline(loadShaders(graphicsInstance->getVulkanLogicalDevice()));
+	Mesh mesh{ .vertices = vertices, .indices = indices };
+	meshLodGenerator.generate(mesh);
+	graphicsInstance->createLogicalDevice(window->getFramebufferSize(), mesh, renderSettings);
+	graphicsInstance->createPipelines(loadShaders(graphicsInstance->getVulkanLogicalDevice()));
+	std::cout << graphicsInstance->getRenderGraphSchedule();
+	printFramePacingSettings();
 }
 
 AmbientOcclusionApplication::~AmbientOcclusionApplication()
@@ -17,17 +21,191 @@ AmbientOcclusionApplication::~AmbientOcclusionApplication()
 	window.reset();
 }
 
-const std::vector<std::shared_ptr<Shader>> AmbientOcclusionApplication::loadShaders(const vk::Device& vulkanLogicalDevice) const
+const PipelineShaders AmbientOcclusionApplication::loadShaders(const vk::Device& vulkanLogicalDevice)
 {
-	std::vector<std::shared_ptr<Shader>> shaders;
-	shaders.push_back(std::make_shared<Shader>("shaders/vert.spv", vulkanLogicalDevice, vk::ShaderStageFlagBits::eVertex));
-	shaders.push_back(std::make_shared<Shader>("shaders/frag.spv", vulkanLogicalDevice, vk::ShaderStageFlagBits::eFragment));
-	return shaders;
+	std::set<std::filesystem::path> dependencies;
+	const std::shared_ptr<Shader> vertexShader{ loadShader(vulkanLogicalDevice, vertexShaderSource, dependencies) };
+	PipelineShaders pipelineShaders{
+		.geometryShaders = { vertexShader, loadShader(vulkanLogicalDevice, geometryShaderSource, dependencies) },
+		.ambientOcclusionShader = loadShader(vulkanLogicalDevice, ambientOcclusionShaderSource, dependencies),
+		.forwardShaders = { vertexShader, loadShader(vulkanLogicalDevice, forwardShaderSource, dependencies) }
+	};
+	pipelineDependencies = dependencies;
+	shaderWatcher.watch(dependencies);
+	return pipelineShaders;
+}
+
+const std::shared_ptr<Shader> AmbientOcclusionApplication::loadShader(const vk::Device& vulkanLogicalDevice, const ShaderSourceDescription& shaderSourceDescription, std::set<std::filesystem::path>& dependencies)
+{
+	const CompiledShader compiledShader{ shaderCompiler.compile(shaderSourceDescription) };
+	dependencies.insert(compiledShader.dependencies.begin(), compiledShader.dependencies.end());
+	std::cout << "Shader file located at " << shaderSourceDescription.path.string() << " has been " << (compiledShader.isCached ? "loaded from the cache" : "compiled") << std::endl;
+	return std::make_shared<Shader>(compiledShader.spirv, vulkanLogicalDevice, shaderSourceDescription.stage);
+}
+
+void AmbientOcclusionApplication::reloadChangedShaders()
+{
+	TRACE_ZONE("ReloadChangedShaders");
+	const std::set<std::filesystem::path> changedFiles{ shaderWatcher.poll() };
+	const bool isPipelineAffected{ std::any_of(changedFiles.begin(), changedFiles.end(), [&](const std::filesystem::path& changedFile) { return pipelineDependencies.contains(changedFile); }) };
+	if (!isPipelineAffected)
+	{
+		return;
+	}
+	try
+	{
+		const PipelineShaders pipelineShaders{ loadShaders(graphicsInstance->getVulkanLogicalDevice()) };
+		graphicsInstance->waitIdle();
+		graphicsInstance->createPipelines(pipelineShaders);
+		std::cout << "Pipelines have been rebuilt" << std::endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << error.what() << std::endl;
+	}
+}
+
+void AmbientOcclusionApplication::selectAmbientOcclusionQuality()
+{
+	for (uint32_t qualityLevel = 0; qualityLevel < graphicsInstance->getAmbientOcclusionQualityLevelCount(); ++qualityLevel)
+	{
+		if (window->isKeyPressed(GLFW_KEY_1 + static_cast<int>(qualityLevel)))
+		{
+			graphicsInstance->setAmbientOcclusionQuality(qualityLevel);
+		}
+	}
 }
 
 void AmbientOcclusionApplication::run()
 {
-	std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame = std::bind(&GraphicsInstance::drawFrame, graphicsInstance, std::placeholders::_1, std::placeholders::_2);
-	window->open(drawFrame);
+	std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame = [this](std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
+	{
+		const auto inputTime{ std::chrono::steady_clock::now() };
+		reloadChangedShaders();
+		selectAmbientOcclusionQuality();
+		writeTraceOnRequest();
+		graphicsInstance->drawFrame(getFramebufferSize, waitEvents, inputTime);
+		if (!timeToFirstFrameMilliseconds)
+		{
+			timeToFirstFrameMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		}
+	};
+	window->open(drawFrame, [this]() { framePacer.waitForNextFrame(); });
 	graphicsInstance->waitIdle();
+	printStartupStatistics();
+	printMemoryStatistics();
+	printUploadStatistics();
+	printTransientMemoryStatistics();
+	printCommandRecordingStatistics();
+	printCommandBufferCacheStatistics();
+	printFrameLatencyStatistics();
+	writeGpuProfile();
+	writeTrace();
+}
+
+void AmbientOcclusionApplication::printMemoryStatistics() const
+{
+	const MemoryStatistics memoryStatistics{ graphicsInstance->getMemoryStatistics() };
+	std::cout << "Device memory: " << memoryStatistics.allocationCount << " allocations in " << memoryStatistics.memoryBlockCount << " blocks, "
+		<< memoryStatistics.usedBytes << "/" << memoryStatistics.reservedBytes << " bytes in use, largest free range " << memoryStatistics.largestFreeRange
+		<< " bytes, fragmentation " << memoryStatistics.fragmentation * 100.0f << "%" << std::endl;
+}
+
+void AmbientOcclusionApplication::printUploadStatistics() const
+{
+	const UploadStatistics uploadStatistics{ graphicsInstance->getUploadStatistics() };
+	std::cout << "Uploads: " << uploadStatistics.zeroCopyUploadCount << " zero-copy (" << uploadStatistics.zeroCopyBytes << " bytes, " << uploadStatistics.zeroCopyMilliseconds << " ms), "
+		<< uploadStatistics.stagedUploadCount << " staged (" << uploadStatistics.stagedBytes << " bytes, " << uploadStatistics.stagedMilliseconds << " ms), initial upload completed in "
+		<< uploadStatistics.initialUploadMilliseconds << " ms" << std::endl;
+}
+
+void AmbientOcclusionApplication::printTransientMemoryStatistics() const
+{
+	const TransientMemoryStatistics transientMemoryStatistics{ graphicsInstance->getTransientMemoryStatistics() };
+	std::cout << "Ambient occlusion images: " << transientMemoryStatistics.imageCount << " images in " << transientMemoryStatistics.allocatedBytes << " bytes ("
+		<< transientMemoryStatistics.unaliasedBytes << " bytes without aliasing, " << transientMemoryStatistics.lazilyAllocatedBytes << " bytes lazily allocated)" << std::endl;
+}
+
+void AmbientOcclusionApplication::printCommandRecordingStatistics() const
+{
+	const CommandRecordingStatistics commandRecordingStatistics{ graphicsInstance->getCommandRecordingStatistics() };
+	std::cout << "Command recording: " << commandRecordingStatistics.itemCount << " draws in " << commandRecordingStatistics.secondaryCommandBufferCount << " secondary command buffers on up to "
+		<< commandRecordingStatistics.threadCount << " threads, " << (commandRecordingStatistics.recordedFrameCount > 0 ? commandRecordingStatistics.recordingMilliseconds / commandRecordingStatistics.recordedFrameCount : 0.0)
+		<< " ms per frame" << std::endl;
+}
+
+void AmbientOcclusionApplication::printCommandBufferCacheStatistics() const
+{
+	if (!renderSettings.isCommandBufferCachingEnabled)
+	{
+		return;
+	}
+	const CommandBufferCacheStatistics commandBufferCacheStatistics{ graphicsInstance->getCommandBufferCacheStatistics() };
+	std::cout << "Command buffer cache: " << commandBufferCacheStatistics.recordedFrameCount << " frames recorded, " << commandBufferCacheStatistics.reusedFrameCount << " frames reused, "
+		<< commandBufferCacheStatistics.invalidationCount << " invalidations" << std::endl;
+}
+
+void AmbientOcclusionApplication::printFramePacingSettings() const
+{
+	std::cout << "Frame pacing: " << renderSettings.framesInFlight << " frames in flight, " << vk::to_string(graphicsInstance->getPresentMode()) << " present mode ("
+		<< vk::to_string(renderSettings.presentMode) << " requested), ";
+	if (renderSettings.targetFrameRate)
+	{
+		std::cout << "target " << *renderSettings.targetFrameRate << " fps" << std::endl;
+	}
+	else
+	{
+		std::cout << "no target frame rate" << std::endl;
+	}
+}
+
+void AmbientOcclusionApplication::printFrameLatencyStatistics() const
+{
+	const FrameLatencyStatistics frameLatencyStatistics{ graphicsInstance->getFrameLatencyStatistics() };
+	std::cout << "Frame latency: " << frameLatencyStatistics.frameCount << " frames, " << frameLatencyStatistics.averageFrameMilliseconds << " ms per frame, input to present "
+		<< frameLatencyStatistics.averageInputToPresentMilliseconds << " ms (max " << frameLatencyStatistics.maximumInputToPresentMilliseconds << " ms), submit to GPU completion "
+		<< frameLatencyStatistics.averageSubmitToCompletionMilliseconds << " ms (max " << frameLatencyStatistics.maximumSubmitToCompletionMilliseconds << " ms)" << std::endl;
+}
+
+void AmbientOcclusionApplication::writeGpuProfile() const
+{
+	if (!renderSettings.isGpuProfilingEnabled)
+	{
+		return;
+	}
+	for (const auto& gpuPassStatistics : graphicsInstance->getGpuPassStatistics())
+	{
+		std::cout << "GPU pass " << gpuPassStatistics.name << ": " << gpuPassStatistics.sampleCount << " samples, min " << gpuPassStatistics.minimumMilliseconds << " ms, avg "
+			<< gpuPassStatistics.averageMilliseconds << " ms, p95 " << gpuPassStatistics.percentile95Milliseconds << " ms, max " << gpuPassStatistics.maximumMilliseconds << " ms" << std::endl;
+	}
+	graphicsInstance->writeGpuProfile("gpu_profile.csv", "gpu_profile.json");
+	std::cout << "GPU profile has been written to gpu_profile.csv and gpu_profile.json" << std::endl;
+}
+
+void AmbientOcclusionApplication::writeTraceOnRequest()
+{
+	const bool isTraceKeyPressed{ window->isKeyPressed(GLFW_KEY_T) };
+	if (isTraceKeyPressed && !wasTraceKeyPressed)
+	{
+		writeTrace();
+	}
+	wasTraceKeyPressed = isTraceKeyPressed;
+}
+
+void AmbientOcclusionApplication::writeTrace() const
+{
+#ifdef ENABLE_TRACING
+	Tracer::getInstance().writeChromeTrace("trace.json");
+	std::cout << "Trace has been written to trace.json" << std::endl;
+#endif
+}
+
+void AmbientOcclusionApplication::printStartupStatistics() const
+{
+	const PipelineCacheStatistics pipelineCacheStatistics{ graphicsInstance->getPipelineCacheStatistics() };
+	std::cout << "Startup: " << (pipelineCacheStatistics.isWarm ? "warm" : "cold") << " pipeline cache (" << pipelineCacheStatistics.loadedBytes << " bytes loaded), pipelines created in "
+		<< pipelineCacheStatistics.pipelineCreationMilliseconds << " ms, first frame after " << timeToFirstFrameMilliseconds.value_or(0.0) << " ms" << std::endl;
+	const ShaderCompilerStatistics shaderCompilerStatistics{ shaderCompiler.getStatistics() };
+	std::cout << "Shaders: " << shaderCompilerStatistics.compiledShaderCount << " compiled, " << shaderCompilerStatistics.cachedShaderCount << " loaded from the cache in "
+		<< shaderCompilerStatistics.compilationMilliseconds << " ms" << std::endl;
 }
\ No newline at end of file
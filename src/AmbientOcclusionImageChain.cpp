@@ -0,0 +1,84 @@
+#include "AmbientOcclusionImageChain.h"
+
+AmbientOcclusionImageChain::AmbientOcclusionImageChain(const std::shared_ptr<DeviceMemoryAllocator>& deviceMemoryAllocator, const vk::Extent2D& extent)
+{
+	transientImagePool = std::make_unique<TransientImagePool>(deviceMemoryAllocator);
+	for (const auto& transientImageDescription : describe(deviceMemoryAllocator->getVulkanLogicalDevice(), extent))
+	{
+		transientImagePool->addImage(transientImageDescription);
+	}
+	transientImagePool->allocate();
+}
+
+const std::vector<TransientImageDescription> AmbientOcclusionImageChain::describe(const vk::Device& vulkanLogicalDevice, const vk::Extent2D& extent)
+{
+	const vk::ImageUsageFlags storageUsage{ vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eSampled };
+	const uint32_t hiZMipLevels{ static_cast<uint32_t>(std::bit_width(std::max(extent.width, extent.height))) };
+	return {
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = depthFormat,
+			.usage = vk::ImageUsageFlagBits::eDepthStencilAttachment,
+			.aspectMask = vk::ImageAspectFlagBits::eDepth,
+			.isTransient = true
+		}, AmbientOcclusionPass::eGeometry, AmbientOcclusionPass::eGeometry),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = normalsFormat,
+			.usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eSampled
+		}, AmbientOcclusionPass::eGeometry, AmbientOcclusionPass::eAmbientOcclusion),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = vk::Format::eR32Sfloat,
+			.usage = storageUsage,
+			.mipLevels = hiZMipLevels
+		}, AmbientOcclusionPass::eHiZ, AmbientOcclusionPass::eAmbientOcclusion),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = vk::Format::eR32Sfloat,
+			.usage = storageUsage
+		}, AmbientOcclusionPass::eAmbientOcclusion, AmbientOcclusionPass::eComposite),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = vk::Format::eR8Unorm,
+			.usage = storageUsage
+		}, AmbientOcclusionPass::eHorizontalBlur, AmbientOcclusionPass::eVerticalBlur),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = vk::Format::eR8Unorm,
+			.usage = storageUsage
+		}, AmbientOcclusionPass::eVerticalBlur, AmbientOcclusionPass::eComposite),
+		describeImage(ImageCreateInfo{
+			.vulkanLogicalDevice = vulkanLogicalDevice,
+			.extent = extent,
+			.format = vk::Format::eR16Sfloat,
+			.usage = storageUsage
+		}, AmbientOcclusionPass::eGeometry, AmbientOcclusionPass::eComposite, false)
+	};
+}
+
+const TransientImageDescription AmbientOcclusionImageChain::describeImage(const ImageCreateInfo& imageCreateInfo, const AmbientOcclusionPass firstPass, const AmbientOcclusionPass lastPass, const bool isAliasable)
+{
+	return TransientImageDescription{
+		.imageCreateInfo = imageCreateInfo,
+		.firstPass = static_cast<uint32_t>(firstPass),
+		.lastPass = static_cast<uint32_t>(lastPass),
+		.isAliasable = isAliasable
+	};
+}
+
+const Image& AmbientOcclusionImageChain::getImage(const AmbientOcclusionImage ambientOcclusionImage) const
+{
+	return transientImagePool->getImage(static_cast<uint32_t>(ambientOcclusionImage));
+}
+
+const TransientMemoryStatistics AmbientOcclusionImageChain::getStatistics() const
+{
+	return transientImagePool->getStatistics();
+}
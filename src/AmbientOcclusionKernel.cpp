@@ -0,0 +1,16 @@
+#include "AmbientOcclusionKernel.h"
+
+const std::array<glm::vec4, FrameUniforms::maximumKernelSampleCount> AmbientOcclusionKernel::generate(const uint32_t sampleCount, const uint64_t seed)
+{
+	Random random{ seed };
+	std::array<glm::vec4, FrameUniforms::maximumKernelSampleCount> kernel{};
+	const uint32_t clampedSampleCount{ std::min(sampleCount, FrameUniforms::maximumKernelSampleCount) };
+	for (uint32_t sampleIndex = 0; sampleIndex < clampedSampleCount; ++sampleIndex)
+	{
+		const glm::vec3 direction{ glm::normalize(glm::vec3(random.nextFloat(-1.0f, 1.0f), random.nextFloat(-1.0f, 1.0f), random.nextFloat(0.0f, 1.0f))) };
+		const float progress{ static_cast<float>(sampleIndex) / static_cast<float>(clampedSampleCount) };
+		const float scale{ 0.1f + 0.9f * progress * progress };
+		kernel[sampleIndex] = glm::vec4(direction * random.nextFloat() * scale, 0.0f);
+	}
+	return kernel;
+}
\ No newline at end of file
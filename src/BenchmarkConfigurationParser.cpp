@@ -0,0 +1,122 @@
+#include "BenchmarkConfigurationParser.h"
+
+BenchmarkConfigurationParser::BenchmarkConfigurationParser(const char* benchmarkConfigurationFile)
+{
+	JSONDocument.Parse(benchmarkConfigurationFile);
+	validateJSONBenchmarkConfigurationFile();
+	expandScenarioMatrix();
+	parseQualitySettings();
+}
+
+void BenchmarkConfigurationParser::validateJSONBenchmarkConfigurationFile() const
+{
+	assert(JSONDocument.IsObject());
+	assert(JSONDocument.HasMember("warmupFrameCount") && JSONDocument["warmupFrameCount"].IsUint());
+	assert(JSONDocument.HasMember("measuredFrameCount") && JSONDocument["measuredFrameCount"].IsUint());
+	assert(!JSONDocument.HasMember("regressionThreshold") || JSONDocument["regressionThreshold"].IsNumber());
+	assert(!JSONDocument.HasMember("quality") || JSONDocument["quality"].IsObject());
+	if (JSONDocument.HasMember("quality"))
+	{
+		const auto quality{ JSONDocument["quality"].GetObject() };
+		assert(quality.HasMember("frames") && quality["frames"].IsArray());
+		for (const auto& frame : quality["frames"].GetArray())
+		{
+			assert(frame.IsUint());
+		}
+		assert(!quality.HasMember("referenceDirectory") || quality["referenceDirectory"].IsString());
+		assert(!quality.HasMember("heatmapDirectory") || quality["heatmapDirectory"].IsString());
+		assert(!quality.HasMember("heatmapScale") || quality["heatmapScale"].IsNumber());
+		assert(!quality.HasMember("structuralSimilarityTolerance") || quality["structuralSimilarityTolerance"].IsNumber());
+	}
+	assert(JSONDocument.HasMember("matrix") && JSONDocument["matrix"].IsObject());
+	const auto matrix{ JSONDocument["matrix"].GetObject() };
+	assert(matrix.HasMember("scenes") && matrix["scenes"].IsArray());
+	for (const auto& scene : matrix["scenes"].GetArray())
+	{
+		assert(scene.HasMember("name") && scene["name"].IsString());
+		assert(!scene.HasMember("seed") || scene["seed"].IsUint64());
+	}
+	assert(matrix.HasMember("resolutions") && matrix["resolutions"].IsArray());
+	for (const auto& resolution : matrix["resolutions"].GetArray())
+	{
+		assert(resolution.IsArray() && resolution.Size() == 2 && resolution[0].IsInt() && resolution[1].IsInt());
+	}
+	assert(matrix.HasMember("sampleCounts") && matrix["sampleCounts"].IsArray());
+	for (const auto& sampleCount : matrix["sampleCounts"].GetArray())
+	{
+		assert(sampleCount.IsUint());
+	}
+	assert(matrix.HasMember("cameraPaths") && matrix["cameraPaths"].IsArray());
+	for (const auto& cameraPath : matrix["cameraPaths"].GetArray())
+	{
+		assert(cameraPath.IsString());
+	}
+}
+
+void BenchmarkConfigurationParser::expandScenarioMatrix() noexcept
+{
+	if (JSONDocument.HasMember("regressionThreshold"))
+	{
+		benchmarkConfiguration.regressionThreshold = JSONDocument["regressionThreshold"].GetDouble();
+	}
+	const auto matrix{ JSONDocument["matrix"].GetObject() };
+	for (const auto& scene : matrix["scenes"].GetArray())
+	{
+		for (const auto& resolution : matrix["resolutions"].GetArray())
+		{
+			for (const auto& sampleCount : matrix["sampleCounts"].GetArray())
+			{
+				for (const auto& cameraPath : matrix["cameraPaths"].GetArray())
+				{
+					BenchmarkScenario benchmarkScenario{
+						.scene = scene["name"].GetString(),
+						.sceneSeed = scene.HasMember("seed") ? scene["seed"].GetUint64() : 1,
+						.width = resolution[0].GetInt(),
+						.height = resolution[1].GetInt(),
+						.sampleCount = sampleCount.GetUint(),
+						.cameraPath = cameraPath.GetString(),
+						.warmupFrameCount = JSONDocument["warmupFrameCount"].GetUint(),
+						.measuredFrameCount = JSONDocument["measuredFrameCount"].GetUint()
+					};
+					benchmarkScenario.name = benchmarkScenario.scene + "_" + std::to_string(benchmarkScenario.width) + "x" + std::to_string(benchmarkScenario.height) + "_"
+						+ std::to_string(benchmarkScenario.sampleCount) + "samples_" + std::filesystem::path(benchmarkScenario.cameraPath).stem().string();
+					benchmarkConfiguration.scenarios.push_back(benchmarkScenario);
+				}
+			}
+		}
+	}
+}
+
+void BenchmarkConfigurationParser::parseQualitySettings() noexcept
+{
+	if (!JSONDocument.HasMember("quality"))
+	{
+		return;
+	}
+	const auto quality{ JSONDocument["quality"].GetObject() };
+	for (const auto& frame : quality["frames"].GetArray())
+	{
+		benchmarkConfiguration.qualityFrameIndices.push_back(frame.GetUint());
+	}
+	if (quality.HasMember("referenceDirectory"))
+	{
+		benchmarkConfiguration.referenceDirectory = quality["referenceDirectory"].GetString();
+	}
+	if (quality.HasMember("heatmapDirectory"))
+	{
+		benchmarkConfiguration.heatmapDirectory = quality["heatmapDirectory"].GetString();
+	}
+	if (quality.HasMember("heatmapScale"))
+	{
+		benchmarkConfiguration.heatmapScale = quality["heatmapScale"].GetFloat();
+	}
+	if (quality.HasMember("structuralSimilarityTolerance"))
+	{
+		benchmarkConfiguration.structuralSimilarityTolerance = quality["structuralSimilarityTolerance"].GetDouble();
+	}
+}
+
+const BenchmarkConfiguration BenchmarkConfigurationParser::getBenchmarkConfiguration() const
+{
+	return benchmarkConfiguration;
+}
\ No newline at end of file
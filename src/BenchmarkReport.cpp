@@ -0,0 +1,106 @@
+#include "BenchmarkReport.h"
+
+void BenchmarkReport::write(const std::vector<BenchmarkResult>& benchmarkResults, const std::filesystem::path& filePath)
+{
+	std::ofstream file(filePath, std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in BenchmarkReport! " + filePath.string() + " could not be written");
+	}
+	file << "{" << std::endl << "\t\"scenarios\": [" << std::endl;
+	for (size_t resultIndex = 0; resultIndex < benchmarkResults.size(); ++resultIndex)
+	{
+		const BenchmarkResult& benchmarkResult{ benchmarkResults[resultIndex] };
+		file << "\t\t{" << std::endl << "\t\t\t\"name\": \"" << benchmarkResult.scenarioName << "\"," << std::endl << "\t\t\t\"frames\": " << benchmarkResult.measuredFrameCount << "," << std::endl
+			<< "\t\t\t\"cpuFrame\": { \"p50\": " << benchmarkResult.cpuFramePercentile50Milliseconds << ", \"p95\": " << benchmarkResult.cpuFramePercentile95Milliseconds
+			<< ", \"p99\": " << benchmarkResult.cpuFramePercentile99Milliseconds << " }," << std::endl;
+		if (benchmarkResult.qualityFrameCount > 0)
+		{
+			file << "\t\t\t\"quality\": { \"frames\": " << benchmarkResult.qualityFrameCount << ", \"mse\": " << benchmarkResult.imageQuality.meanSquaredError
+				<< ", \"psnr\": " << benchmarkResult.imageQuality.peakSignalToNoiseRatio << ", \"ssim\": " << benchmarkResult.imageQuality.structuralSimilarity << " }," << std::endl;
+		}
+		file << "\t\t\t\"passes\": [" << std::endl;
+		for (size_t passIndex = 0; passIndex < benchmarkResult.gpuPassStatistics.size(); ++passIndex)
+		{
+			const GpuPassStatistics& gpuPassStatistics{ benchmarkResult.gpuPassStatistics[passIndex] };
+			file << "\t\t\t\t{ \"name\": \"" << gpuPassStatistics.name << "\", \"samples\": " << gpuPassStatistics.sampleCount << ", \"p50\": " << gpuPassStatistics.percentile50Milliseconds
+				<< ", \"p95\": " << gpuPassStatistics.percentile95Milliseconds << ", \"p99\": " << gpuPassStatistics.percentile99Milliseconds << " }"
+				<< (passIndex + 1 < benchmarkResult.gpuPassStatistics.size() ? "," : "") << std::endl;
+		}
+		file << "\t\t\t]" << std::endl << "\t\t}" << (resultIndex + 1 < benchmarkResults.size() ? "," : "") << std::endl;
+	}
+	file << "\t]" << std::endl << "}" << std::endl;
+}
+
+const std::vector<std::string> BenchmarkReport::findRegressions(const std::vector<BenchmarkResult>& benchmarkResults, const std::string& baselineContents, const double regressionThreshold, const double structuralSimilarityTolerance)
+{
+	rapidjson::Document JSONDocument;
+	JSONDocument.Parse(baselineContents.c_str());
+	assert(JSONDocument.IsObject());
+	assert(JSONDocument.HasMember("scenarios") && JSONDocument["scenarios"].IsArray());
+	std::vector<std::string> regressions;
+	for (const auto& benchmarkResult : benchmarkResults)
+	{
+		const rapidjson::Value* baselineScenario{ findMember(JSONDocument["scenarios"], benchmarkResult.scenarioName) };
+		if (!baselineScenario)
+		{
+			continue;
+		}
+		compareMetric(regressions, benchmarkResult.scenarioName + " CPU frame p50", benchmarkResult.cpuFramePercentile50Milliseconds, (*baselineScenario)["cpuFrame"]["p50"], regressionThreshold);
+		compareMetric(regressions, benchmarkResult.scenarioName + " CPU frame p95", benchmarkResult.cpuFramePercentile95Milliseconds, (*baselineScenario)["cpuFrame"]["p95"], regressionThreshold);
+		compareStructuralSimilarity(regressions, benchmarkResult, *baselineScenario, structuralSimilarityTolerance);
+		for (const auto& gpuPassStatistics : benchmarkResult.gpuPassStatistics)
+		{
+			const rapidjson::Value* baselinePass{ findMember((*baselineScenario)["passes"], gpuPassStatistics.name) };
+			if (!baselinePass || gpuPassStatistics.sampleCount == 0)
+			{
+				continue;
+			}
+			compareMetric(regressions, benchmarkResult.scenarioName + " " + gpuPassStatistics.name + " GPU p50", gpuPassStatistics.percentile50Milliseconds, (*baselinePass)["p50"], regressionThreshold);
+			compareMetric(regressions, benchmarkResult.scenarioName + " " + gpuPassStatistics.name + " GPU p95", gpuPassStatistics.percentile95Milliseconds, (*baselinePass)["p95"], regressionThreshold);
+		}
+	}
+	return regressions;
+}
+
+void BenchmarkReport::compareStructuralSimilarity(std::vector<std::string>& regressions, const BenchmarkResult& benchmarkResult, const rapidjson::Value& baselineScenario, const double structuralSimilarityTolerance)
+{
+	if (benchmarkResult.qualityFrameCount == 0 || !baselineScenario.HasMember("quality"))
+	{
+		return;
+	}
+	assert(baselineScenario["quality"].HasMember("ssim") && baselineScenario["quality"]["ssim"].IsNumber());
+	const double baselineStructuralSimilarity{ baselineScenario["quality"]["ssim"].GetDouble() };
+	if (benchmarkResult.imageQuality.structuralSimilarity < baselineStructuralSimilarity - structuralSimilarityTolerance)
+	{
+		std::ostringstream regression;
+		regression << benchmarkResult.scenarioName << " SSIM: " << benchmarkResult.imageQuality.structuralSimilarity << " against a baseline of " << baselineStructuralSimilarity
+			<< " (PSNR " << benchmarkResult.imageQuality.peakSignalToNoiseRatio << " dB)";
+		regressions.push_back(regression.str());
+	}
+}
+
+void BenchmarkReport::compareMetric(std::vector<std::string>& regressions, const std::string& metricName, const double milliseconds, const rapidjson::Value& baselineMetric, const double regressionThreshold)
+{
+	assert(baselineMetric.IsNumber());
+	const double baselineMilliseconds{ baselineMetric.GetDouble() };
+	if (baselineMilliseconds > 0.0 && milliseconds > baselineMilliseconds * (1.0 + regressionThreshold))
+	{
+		std::ostringstream regression;
+		regression << metricName << ": " << milliseconds << " ms against a baseline of " << baselineMilliseconds << " ms (+" << 100.0 * (milliseconds / baselineMilliseconds - 1.0) << "%)";
+		regressions.push_back(regression.str());
+	}
+}
+
+const rapidjson::Value* BenchmarkReport::findMember(const rapidjson::Value& array, const std::string& name)
+{
+	assert(array.IsArray());
+	for (const auto& member : array.GetArray())
+	{
+		if (member.HasMember("name") && name == member["name"].GetString())
+		{
+			return &member;
+		}
+	}
+	return nullptr;
+}
\ No newline at end of file
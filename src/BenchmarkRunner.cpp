@@ -0,0 +1,201 @@
+#include "BenchmarkRunner.h"
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkConfiguration& benchmarkConfiguration) : benchmarkConfiguration(benchmarkConfiguration)
+{
+}
+
+const std::vector<BenchmarkResult> BenchmarkRunner::run()
+{
+	std::vector<BenchmarkResult> benchmarkResults;
+	for (const auto& benchmarkScenario : benchmarkConfiguration.scenarios)
+	{
+		benchmarkResults.push_back(runScenario(benchmarkScenario));
+		const BenchmarkResult& benchmarkResult{ benchmarkResults.back() };
+		std::cout << benchmarkResult.scenarioName << ": CPU frame p50 " << benchmarkResult.cpuFramePercentile50Milliseconds << " ms, p95 " << benchmarkResult.cpuFramePercentile95Milliseconds
+			<< " ms, p99 " << benchmarkResult.cpuFramePercentile99Milliseconds << " ms" << std::endl;
+		for (const auto& gpuPassStatistics : benchmarkResult.gpuPassStatistics)
+		{
+			std::cout << "  " << gpuPassStatistics.name << ": GPU p50 " << gpuPassStatistics.percentile50Milliseconds << " ms, p95 " << gpuPassStatistics.percentile95Milliseconds
+				<< " ms, p99 " << gpuPassStatistics.percentile99Milliseconds << " ms" << std::endl;
+		}
+		if (benchmarkResult.qualityFrameCount > 0)
+		{
+			std::cout << "  Quality over " << benchmarkResult.qualityFrameCount << " frames: MSE " << benchmarkResult.imageQuality.meanSquaredError << ", PSNR "
+				<< benchmarkResult.imageQuality.peakSignalToNoiseRatio << " dB, SSIM " << benchmarkResult.imageQuality.structuralSimilarity << std::endl;
+		}
+	}
+	return benchmarkResults;
+}
+
+const BenchmarkResult BenchmarkRunner::runScenario(const BenchmarkScenario& benchmarkScenario)
+{
+	const Mesh mesh{ buildMesh(benchmarkScenario) };
+	const CameraPath cameraPath{ loadOrRecordCameraPath(benchmarkScenario.cameraPath, mesh) };
+	Window window{ benchmarkScenario.width, benchmarkScenario.height, benchmarkScenario.name, false };
+	GraphicsInstance graphicsInstance{ benchmarkScenario.name };
+	graphicsInstance.createWindowSurface(window.getGLFWWindow());
+	graphicsInstance.selectPhysicalDevice();
+	graphicsInstance.createLogicalDevice(window.getFramebufferSize(), mesh, buildRenderSettings(benchmarkScenario));
+	graphicsInstance.createPipelines(loadShaders(graphicsInstance.getVulkanLogicalDevice()));
+	const std::optional<uint32_t> qualityLevel{ graphicsInstance.findAmbientOcclusionQualityLevel(benchmarkScenario.sampleCount) };
+	if (!qualityLevel)
+	{
+		throw std::runtime_error("Error in BenchmarkRunner! No ambient occlusion quality level uses " + std::to_string(benchmarkScenario.sampleCount) + " samples");
+	}
+	graphicsInstance.setAmbientOcclusionQuality(qualityLevel.value());
+	std::function<WindowSize()> getFramebufferSize = std::bind(&Window::getFramebufferSize, &window);
+	std::function<void()> waitEvents = std::bind(&Window::waitEvents, &window);
+	const std::function<void(const uint32_t)> drawFrame = [&](const uint32_t frameIndex)
+	{
+		window.pollEvents();
+		const CameraPose& cameraPose{ cameraPath.getPose(frameIndex) };
+		graphicsInstance.setCameraPose(cameraPose.position, cameraPose.target);
+		graphicsInstance.drawFrame(getFramebufferSize, waitEvents, std::chrono::steady_clock::now());
+	};
+	for (uint32_t frameIndex = 0; frameIndex < benchmarkScenario.warmupFrameCount; ++frameIndex)
+	{
+		drawFrame(frameIndex);
+	}
+	graphicsInstance.waitIdle();
+	graphicsInstance.resetGpuProfile();
+	std::vector<double> cpuFrameMilliseconds;
+	for (uint32_t frameIndex = 0; frameIndex < benchmarkScenario.measuredFrameCount; ++frameIndex)
+	{
+		const auto frameStart{ std::chrono::steady_clock::now() };
+		drawFrame(frameIndex);
+		cpuFrameMilliseconds.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+	}
+	graphicsInstance.waitIdle();
+	cpuFrameMilliseconds = Percentile::sort(cpuFrameMilliseconds);
+	const std::vector<GpuPassStatistics> gpuPassStatistics{ graphicsInstance.getGpuPassStatistics() };
+	return BenchmarkResult{
+		.scenarioName = benchmarkScenario.name,
+		.measuredFrameCount = benchmarkScenario.measuredFrameCount,
+		.cpuFramePercentile50Milliseconds = Percentile::compute(cpuFrameMilliseconds, 50.0),
+		.cpuFramePercentile95Milliseconds = Percentile::compute(cpuFrameMilliseconds, 95.0),
+		.cpuFramePercentile99Milliseconds = Percentile::compute(cpuFrameMilliseconds, 99.0),
+		.gpuPassStatistics = gpuPassStatistics,
+		.qualityFrameCount = static_cast<uint32_t>(benchmarkConfiguration.qualityFrameIndices.size()),
+		.imageQuality = measureImageQuality(graphicsInstance, benchmarkScenario, qualityLevel.value(), drawFrame)
+	};
+}
+
+const RenderSettings BenchmarkRunner::buildRenderSettings(const BenchmarkScenario& benchmarkScenario) const
+{
+	return RenderSettings{
+		.isCommandBufferCachingEnabled = false,
+		.framesInFlight = 2,
+		.presentMode = vk::PresentModeKHR::eImmediate,
+		.targetFrameRate = std::nullopt,
+		.isGpuProfilingEnabled = true,
+		.gpuProfilerSampleCount = std::max<size_t>(benchmarkScenario.measuredFrameCount, 1),
+		.isFrameCaptureEnabled = !benchmarkConfiguration.qualityFrameIndices.empty()
+	};
+}
+
+const Mesh BenchmarkRunner::buildMesh(const BenchmarkScenario& benchmarkScenario)
+{
+	Mesh mesh;
+	if (benchmarkScenario.scene == "quad")
+	{
+		mesh = Mesh{ .vertices = quadVertices, .indices = quadIndices, .boundsRadius = 0.75f };
+	}
+	else if (benchmarkScenario.scene == "terrain")
+	{
+		SceneGeneratorCreateInfo sceneGeneratorCreateInfo;
+		sceneGeneratorCreateInfo.seed = benchmarkScenario.sceneSeed;
+		mesh = SceneGenerator(sceneGeneratorCreateInfo).generate(threadPool).meshes.front();
+	}
+	else
+	{
+		throw std::runtime_error("Error in BenchmarkRunner! Unknown scene " + benchmarkScenario.scene);
+	}
+	meshLodGenerator.generate(mesh);
+	return mesh;
+}
+
+const CameraPath BenchmarkRunner::loadOrRecordCameraPath(const std::filesystem::path& cameraPathFile, const Mesh& mesh) const
+{
+	if (std::filesystem::exists(cameraPathFile))
+	{
+		std::ifstream file(cameraPathFile);
+		std::stringstream cameraPathStream;
+		cameraPathStream << file.rdbuf();
+		return CameraPath::parse(cameraPathStream.str());
+	}
+	const float radius{ std::max(2.0f * mesh.boundsRadius, 2.0f) };
+	const CameraPath cameraPath{ CameraPath::recordOrbit(mesh.boundsCenter, radius, 0.5f * radius, recordedCameraPoseCount) };
+	cameraPath.save(cameraPathFile);
+	std::cout << "Camera path has been recorded to " << cameraPathFile.string() << std::endl;
+	return cameraPath;
+}
+
+const ImageQualityMetrics BenchmarkRunner::measureImageQuality(GraphicsInstance& graphicsInstance, const BenchmarkScenario& benchmarkScenario, const uint32_t qualityLevel, const std::function<void(const uint32_t)>& drawFrame)
+{
+	ImageQualityMetrics imageQuality{ .meanSquaredError = 0.0, .peakSignalToNoiseRatio = 0.0, .structuralSimilarity = 0.0 };
+	if (benchmarkConfiguration.qualityFrameIndices.empty())
+	{
+		return imageQuality;
+	}
+	std::filesystem::create_directories(benchmarkConfiguration.heatmapDirectory);
+	for (const uint32_t frameIndex : benchmarkConfiguration.qualityFrameIndices)
+	{
+		const LuminanceImage referenceImage{ loadOrCaptureReferenceImage(graphicsInstance, benchmarkScenario, qualityLevel, frameIndex, drawFrame) };
+		const LuminanceImage image{ captureFrame(graphicsInstance, frameIndex, drawFrame) };
+		const ImageQualityMetrics frameImageQuality{ ImageQuality::compare(referenceImage, image, threadPool) };
+		imageQuality.meanSquaredError += frameImageQuality.meanSquaredError;
+		imageQuality.structuralSimilarity += frameImageQuality.structuralSimilarity;
+		const std::filesystem::path heatmapFile{ std::filesystem::path(benchmarkConfiguration.heatmapDirectory) / (benchmarkScenario.name + "_frame" + std::to_string(frameIndex) + ".ppm") };
+		LuminanceImageFile::writeDifferenceHeatmap(referenceImage, image, heatmapFile, benchmarkConfiguration.heatmapScale);
+	}
+	const double qualityFrameCount{ static_cast<double>(benchmarkConfiguration.qualityFrameIndices.size()) };
+	imageQuality.meanSquaredError /= qualityFrameCount;
+	imageQuality.peakSignalToNoiseRatio = ImageQuality::computePeakSignalToNoiseRatio(imageQuality.meanSquaredError);
+	imageQuality.structuralSimilarity /= qualityFrameCount;
+	return imageQuality;
+}
+
+const LuminanceImage BenchmarkRunner::loadOrCaptureReferenceImage(GraphicsInstance& graphicsInstance, const BenchmarkScenario& benchmarkScenario, const uint32_t qualityLevel, const uint32_t frameIndex, const std::function<void(const uint32_t)>& drawFrame) const
+{
+	const std::filesystem::path referenceFile{ std::filesystem::path(benchmarkConfiguration.referenceDirectory) / (benchmarkScenario.scene + "_" + std::to_string(benchmarkScenario.width) + "x"
+		+ std::to_string(benchmarkScenario.height) + "_" + std::filesystem::path(benchmarkScenario.cameraPath).stem().string() + "_frame" + std::to_string(frameIndex) + ".pgm") };
+	if (std::filesystem::exists(referenceFile))
+	{
+		return LuminanceImageFile::read(referenceFile);
+	}
+	graphicsInstance.setAmbientOcclusionQuality(graphicsInstance.getAmbientOcclusionQualityLevelCount() - 1);
+	const LuminanceImage referenceImage{ captureFrame(graphicsInstance, frameIndex, drawFrame) };
+	graphicsInstance.setAmbientOcclusionQuality(qualityLevel);
+	std::filesystem::create_directories(benchmarkConfiguration.referenceDirectory);
+	LuminanceImageFile::write(referenceImage, referenceFile);
+	std::cout << "Reference image has been captured to " << referenceFile.string() << std::endl;
+	return referenceImage;
+}
+
+const LuminanceImage BenchmarkRunner::captureFrame(GraphicsInstance& graphicsInstance, const uint32_t frameIndex, const std::function<void(const uint32_t)>& drawFrame) const
+{
+	graphicsInstance.requestFrameCapture();
+	drawFrame(frameIndex);
+	const std::optional<LuminanceImage> image{ graphicsInstance.readFrameCapture() };
+	if (!image)
+	{
+		throw std::runtime_error("Error in BenchmarkRunner! Frame " + std::to_string(frameIndex) + " could not be captured");
+	}
+	return image.value();
+}
+
+const PipelineShaders BenchmarkRunner::loadShaders(const vk::Device& vulkanLogicalDevice)
+{
+	const std::shared_ptr<Shader> vertexShader{ loadShader(vulkanLogicalDevice, vertexShaderSource) };
+	return PipelineShaders{
+		.geometryShaders = { vertexShader, loadShader(vulkanLogicalDevice, geometryShaderSource) },
+		.ambientOcclusionShader = loadShader(vulkanLogicalDevice, ambientOcclusionShaderSource),
+		.forwardShaders = { vertexShader, loadShader(vulkanLogicalDevice, forwardShaderSource) }
+	};
+}
+
+const std::shared_ptr<Shader> BenchmarkRunner::loadShader(const vk::Device& vulkanLogicalDevice, const ShaderSourceDescription& shaderSourceDescription)
+{
+	const CompiledShader compiledShader{ shaderCompiler.compile(shaderSourceDescription) };
+	return std::make_shared<Shader>(compiledShader.spirv, vulkanLogicalDevice, shaderSourceDescription.stage);
+}
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include "BindlessDescriptorHeap.h"
+
+BindlessDescriptorHeap::BindlessDescriptorHeap(const BindlessDescriptorHeapCreateInfo& bindlessDescriptorHeapCreateInfo) : vulkanLogicalDevice(bindlessDescriptorHeapCreateInfo.vulkanLogicalDevice),
+	descriptorIndexingEnabled(bindlessDescriptorHeapCreateInfo.isDescriptorIndexingEnabled)
+{
+	if (bindlessDescriptorHeapCreateInfo.frameCount > 32)
+	{
+		throw std::runtime_error("Error in BindlessDescriptorHeap! At most 32 frames in flight are supported");
+	}
+	computeCapacities(bindlessDescriptorHeapCreateInfo);
+	for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < resourceTypeCount; ++resourceTypeIndex)
+	{
+		for (uint32_t slot = capacities[resourceTypeIndex]; slot > 0; --slot)
+		{
+			freeSlots[resourceTypeIndex].push_back(slot - 1);
+		}
+	}
+	createDescriptorSetLayout(bindlessDescriptorHeapCreateInfo.shaderStages);
+	createDescriptorSets(bindlessDescriptorHeapCreateInfo.frameCount);
+}
+
+const bool BindlessDescriptorHeap::isDescriptorIndexingSupported(const vk::PhysicalDeviceVulkan12Features& physicalDeviceVulkan12Features)
+{
+	return physicalDeviceVulkan12Features.runtimeDescriptorArray && physicalDeviceVulkan12Features.descriptorBindingPartiallyBound
+		&& physicalDeviceVulkan12Features.shaderSampledImageArrayNonUniformIndexing && physicalDeviceVulkan12Features.shaderStorageImageArrayNonUniformIndexing
+		&& physicalDeviceVulkan12Features.shaderStorageBufferArrayNonUniformIndexing && physicalDeviceVulkan12Features.descriptorBindingSampledImageUpdateAfterBind
+		&& physicalDeviceVulkan12Features.descriptorBindingStorageImageUpdateAfterBind && physicalDeviceVulkan12Features.descriptorBindingStorageBufferUpdateAfterBind;
+}
+
+void BindlessDescriptorHeap::enableDescriptorIndexing(vk::PhysicalDeviceVulkan12Features& physicalDeviceVulkan12Features)
+{
+	physicalDeviceVulkan12Features.runtimeDescriptorArray = true;
+	physicalDeviceVulkan12Features.descriptorBindingPartiallyBound = true;
+	physicalDeviceVulkan12Features.shaderSampledImageArrayNonUniformIndexing = true;
+	physicalDeviceVulkan12Features.shaderStorageImageArrayNonUniformIndexing = true;
+	physicalDeviceVulkan12Features.shaderStorageBufferArrayNonUniformIndexing = true;
+	physicalDeviceVulkan12Features.descriptorBindingSampledImageUpdateAfterBind = true;
+	physicalDeviceVulkan12Features.descriptorBindingStorageImageUpdateAfterBind = true;
+	physicalDeviceVulkan12Features.descriptorBindingStorageBufferUpdateAfterBind = true;
+}
+
+void BindlessDescriptorHeap::computeCapacities(const BindlessDescriptorHeapCreateInfo& bindlessDescriptorHeapCreateInfo)
+{
+	const auto physicalDeviceProperties{ bindlessDescriptorHeapCreateInfo.vulkanPhysicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceVulkan12Properties>() };
+	const vk::PhysicalDeviceLimits& limits{ physicalDeviceProperties.get<vk::PhysicalDeviceProperties2>().properties.limits };
+	const vk::PhysicalDeviceVulkan12Properties& physicalDeviceVulkan12Properties{ physicalDeviceProperties.get<vk::PhysicalDeviceVulkan12Properties>() };
+	std::array<uint32_t, resourceTypeCount> requestedCapacities;
+	std::array<uint32_t, resourceTypeCount> limitCapacities;
+	uint32_t maxPerStageResources;
+	if (descriptorIndexingEnabled)
+	{
+		requestedCapacities = { bindlessDescriptorHeapCreateInfo.sampledImageCapacity, bindlessDescriptorHeapCreateInfo.storageImageCapacity, bindlessDescriptorHeapCreateInfo.storageBufferCapacity };
+		limitCapacities = {
+			std::min({ physicalDeviceVulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages, physicalDeviceVulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers,
+				physicalDeviceVulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages, physicalDeviceVulkan12Properties.maxDescriptorSetUpdateAfterBindSamplers }),
+			std::min(physicalDeviceVulkan12Properties.maxPerStageDescriptorUpdateAfterBindStorageImages, physicalDeviceVulkan12Properties.maxDescriptorSetUpdateAfterBindStorageImages),
+			std::min(physicalDeviceVulkan12Properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers, physicalDeviceVulkan12Properties.maxDescriptorSetUpdateAfterBindStorageBuffers)
+		};
+		maxPerStageResources = physicalDeviceVulkan12Properties.maxPerStageUpdateAfterBindResources;
+	}
+	else
+	{
+		const uint32_t fallbackCapacity{ bindlessDescriptorHeapCreateInfo.fallbackCapacity };
+		requestedCapacities = { fallbackCapacity, fallbackCapacity, fallbackCapacity };
+		limitCapacities = {
+			std::min({ limits.maxPerStageDescriptorSampledImages, limits.maxPerStageDescriptorSamplers, limits.maxDescriptorSetSampledImages, limits.maxDescriptorSetSamplers }),
+			std::min(limits.maxPerStageDescriptorStorageImages, limits.maxDescriptorSetStorageImages),
+			std::min(limits.maxPerStageDescriptorStorageBuffers, limits.maxDescriptorSetStorageBuffers)
+		};
+		maxPerStageResources = limits.maxPerStageResources;
+	}
+	uint64_t totalCapacity{ 0 };
+	for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < resourceTypeCount; ++resourceTypeIndex)
+	{
+		capacities[resourceTypeIndex] = std::min(requestedCapacities[resourceTypeIndex], limitCapacities[resourceTypeIndex]);
+		totalCapacity += capacities[resourceTypeIndex];
+	}
+	const uint64_t availableResourceCount{ maxPerStageResources > bindlessDescriptorHeapCreateInfo.reservedResourceCount ? maxPerStageResources - bindlessDescriptorHeapCreateInfo.reservedResourceCount : 0 };
+	if (totalCapacity > availableResourceCount)
+	{
+		for (auto& capacity : capacities)
+		{
+			capacity = static_cast<uint32_t>(capacity * availableResourceCount / totalCapacity);
+		}
+	}
+}
+
+const vk::DescriptorType BindlessDescriptorHeap::toDescriptorType(const BindlessResourceType resourceType)
+{
+	switch (resourceType)
+	{
+	case BindlessResourceType::eSampledImage:
+		return vk::DescriptorType::eCombinedImageSampler;
+	case BindlessResourceType::eStorageImage:
+		return vk::DescriptorType::eStorageImage;
+	default:
+		return vk::DescriptorType::eStorageBuffer;
+	}
+}
+
+void BindlessDescriptorHeap::createDescriptorSetLayout(const vk::ShaderStageFlags& shaderStages)
+{
+	std::vector<vk::DescriptorSetLayoutBinding> descriptorSetLayoutBindings;
+	std::vector<vk::DescriptorBindingFlags> descriptorBindingFlags;
+	for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < resourceTypeCount; ++resourceTypeIndex)
+	{
+		descriptorSetLayoutBindings.push_back(vk::DescriptorSetLayoutBinding{
+			.binding = resourceTypeIndex,
+			.descriptorType = toDescriptorType(static_cast<BindlessResourceType>(resourceTypeIndex)),
+			.descriptorCount = capacities[resourceTypeIndex],
+			.stageFlags = shaderStages
+		});
+		if (descriptorIndexingEnabled)
+		{
+			descriptorBindingFlags.push_back(vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind);
+		}
+	}
+	const vk::DescriptorSetLayoutCreateFlags descriptorSetLayoutCreateFlags{ descriptorIndexingEnabled ? vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool : vk::DescriptorSetLayoutCreateFlags{} };
+	descriptorSetLayout = std::make_unique<DescriptorSetLayout>(vulkanLogicalDevice, descriptorSetLayoutBindings, descriptorSetLayoutCreateFlags, descriptorBindingFlags);
+}
+
+void BindlessDescriptorHeap::createDescriptorSets(const uint32_t frameCount)
+{
+	std::vector<vk::DescriptorPoolSize> descriptorPoolSizes;
+	for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < resourceTypeCount; ++resourceTypeIndex)
+	{
+		descriptorPoolSizes.push_back(vk::DescriptorPoolSize{
+			.type = toDescriptorType(static_cast<BindlessResourceType>(resourceTypeIndex)),
+			.descriptorCount = capacities[resourceTypeIndex] * frameCount
+		});
+	}
+	const vk::DescriptorPoolCreateFlags descriptorPoolCreateFlags{ descriptorIndexingEnabled ? vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind : vk::DescriptorPoolCreateFlags{} };
+	descriptorPool = std::make_unique<DescriptorPool>(vulkanLogicalDevice, descriptorPoolSizes, frameCount, descriptorPoolCreateFlags);
+	for (uint32_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+	{
+		vulkanDescriptorSets.push_back(descriptorPool->allocate(descriptorSetLayout->getVulkanDescriptorSetLayout()));
+	}
+}
+
+void BindlessDescriptorHeap::beginFrame(const uint32_t frameIndex, const uint64_t frameNumber, const uint64_t completedFrameCount)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(frameIndex, vulkanDescriptorSets.size(), "Error in BindlessDescriptorHeap! Frame index is out of bounds");
+	currentFrame = frameIndex;
+	this->frameNumber = frameNumber;
+	recycleReleasedSlots(completedFrameCount);
+	applyPendingWrites();
+}
+
+const uint32_t BindlessDescriptorHeap::registerSampledImage(const vk::ImageView& vulkanImageView, const vk::Sampler& vulkanSampler, const vk::ImageLayout imageLayout)
+{
+	return registerDescriptor(BindlessDescriptorWrite{
+		.resourceType = BindlessResourceType::eSampledImage,
+		.slot = acquireSlot(BindlessResourceType::eSampledImage),
+		.descriptorImageInfo = vk::DescriptorImageInfo{
+			.sampler = vulkanSampler,
+			.imageView = vulkanImageView,
+			.imageLayout = imageLayout
+		}
+	});
+}
+
+const uint32_t BindlessDescriptorHeap::registerStorageImage(const vk::ImageView& vulkanImageView)
+{
+	return registerDescriptor(BindlessDescriptorWrite{
+		.resourceType = BindlessResourceType::eStorageImage,
+		.slot = acquireSlot(BindlessResourceType::eStorageImage),
+		.descriptorImageInfo = vk::DescriptorImageInfo{
+			.imageView = vulkanImageView,
+			.imageLayout = vk::ImageLayout::eGeneral
+		}
+	});
+}
+
+const uint32_t BindlessDescriptorHeap::registerStorageBuffer(const vk::Buffer& vulkanBuffer, const vk::DeviceSize offset, const vk::DeviceSize range)
+{
+	return registerDescriptor(BindlessDescriptorWrite{
+		.resourceType = BindlessResourceType::eStorageBuffer,
+		.slot = acquireSlot(BindlessResourceType::eStorageBuffer),
+		.descriptorBufferInfo = vk::DescriptorBufferInfo{
+			.buffer = vulkanBuffer,
+			.offset = offset,
+			.range = range
+		}
+	});
+}
+
+const uint32_t BindlessDescriptorHeap::acquireSlot(const BindlessResourceType resourceType)
+{
+	std::vector<uint32_t>& resourceFreeSlots{ freeSlots[static_cast<uint32_t>(resourceType)] };
+	if (resourceFreeSlots.empty())
+	{
+		throw std::runtime_error("Error in BindlessDescriptorHeap! Descriptor heap is full");
+	}
+	const uint32_t slot{ resourceFreeSlots.back() };
+	resourceFreeSlots.pop_back();
+	return slot;
+}
+
+const uint32_t BindlessDescriptorHeap::registerDescriptor(const BindlessDescriptorWrite& bindlessDescriptorWrite)
+{
+	const uint32_t allFramesMask{ static_cast<uint32_t>((1ull << vulkanDescriptorSets.size()) - 1) };
+	const uint32_t pendingFrameMask{ allFramesMask & ~(1u << currentFrame) };
+	writeDescriptor(bindlessDescriptorWrite, vulkanDescriptorSets[currentFrame]);
+	if (pendingFrameMask != 0)
+	{
+		pendingWrites.push_back(bindlessDescriptorWrite);
+		pendingWrites.back().pendingFrameMask = pendingFrameMask;
+	}
+	return bindlessDescriptorWrite.slot;
+}
+
+void BindlessDescriptorHeap::applyPendingWrites()
+{
+	const uint32_t frameMask{ 1u << currentFrame };
+	for (auto& pendingWrite : pendingWrites)
+	{
+		if (pendingWrite.pendingFrameMask & frameMask)
+		{
+			writeDescriptor(pendingWrite, vulkanDescriptorSets[currentFrame]);
+			pendingWrite.pendingFrameMask &= ~frameMask;
+		}
+	}
+	std::erase_if(pendingWrites, [](const BindlessDescriptorWrite& pendingWrite) { return pendingWrite.pendingFrameMask == 0; });
+}
+
+void BindlessDescriptorHeap::writeDescriptor(const BindlessDescriptorWrite& bindlessDescriptorWrite, const vk::DescriptorSet& vulkanDescriptorSet) const
+{
+	const bool isBuffer{ bindlessDescriptorWrite.resourceType == BindlessResourceType::eStorageBuffer };
+	const vk::WriteDescriptorSet writeDescriptorSet{
+		.dstSet = vulkanDescriptorSet,
+		.dstBinding = static_cast<uint32_t>(bindlessDescriptorWrite.resourceType),
+		.dstArrayElement = bindlessDescriptorWrite.slot,
+		.descriptorCount = 1,
+		.descriptorType = toDescriptorType(bindlessDescriptorWrite.resourceType),
+		.pImageInfo = isBuffer ? nullptr : &bindlessDescriptorWrite.descriptorImageInfo,
+		.pBufferInfo = isBuffer ? &bindlessDescriptorWrite.descriptorBufferInfo : nullptr
+	};
+	vulkanLogicalDevice.updateDescriptorSets(writeDescriptorSet, nullptr);
+}
+
+void BindlessDescriptorHeap::release(const BindlessResourceType resourceType, const uint32_t handle)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(handle, capacities[static_cast<uint32_t>(resourceType)], "Error in BindlessDescriptorHeap! Resource handle is out of bounds");
+	std::erase_if(pendingWrites, [&](const BindlessDescriptorWrite& pendingWrite) { return pendingWrite.resourceType == resourceType && pendingWrite.slot == handle; });
+	pendingSlotReleases.push_back(PendingSlotRelease{
+		.resourceType = resourceType,
+		.slot = handle,
+		.frameNumber = frameNumber
+	});
+}
+
+void BindlessDescriptorHeap::recycleReleasedSlots(const uint64_t completedFrameCount)
+{
+	std::erase_if(pendingSlotReleases, [&](const PendingSlotRelease& pendingSlotRelease)
+	{
+		if (pendingSlotRelease.frameNumber >= completedFrameCount)
+		{
+			return false;
+		}
+		freeSlots[static_cast<uint32_t>(pendingSlotRelease.resourceType)].push_back(pendingSlotRelease.slot);
+		return true;
+	});
+}
+
+const vk::DescriptorSetLayout BindlessDescriptorHeap::getVulkanDescriptorSetLayout() const
+{
+	return descriptorSetLayout->getVulkanDescriptorSetLayout();
+}
+
+const vk::DescriptorSet BindlessDescriptorHeap::getVulkanDescriptorSet() const
+{
+	return vulkanDescriptorSets[currentFrame];
+}
+
+const uint32_t BindlessDescriptorHeap::getCapacity(const BindlessResourceType resourceType) const
+{
+	return capacities[static_cast<uint32_t>(resourceType)];
+}
+
+const bool BindlessDescriptorHeap::isDescriptorIndexingEnabled() const
+{
+	return descriptorIndexingEnabled;
+}
\ No newline at end of file
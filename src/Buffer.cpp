@@ -1,55 +1,195 @@
 #include "Buffer.h"
 
-Buffer::Buffer(const vk::Device& vulkanLogicalDevice) : vulkanLogicalDevice(vulkanLogicalDevice)
+Buffer::Buffer(const BufferCreateInfo& bufferCreateInfo, const vk::DeviceSize elementSize, const vk::BufferUsageFlags& bufferUsage) : elementSize(elementSize),
+	bufferUsage(bufferUsage | vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst), deviceMemoryAllocator(bufferCreateInfo.deviceMemoryAllocator),
+	uploadManager(bufferCreateInfo.uploadManager), vulkanLogicalDevice(bufferCreateInfo.deviceMemoryAllocator->getVulkanLogicalDevice())
 {
+	createVulkanBuffer(bufferCreateInfo.initialElementCount);
+	tlsfAllocator = std::make_unique<TlsfAllocator>(elementCapacity);
 }
 
 Buffer::~Buffer()
 {
+	for (const auto& retiredBuffer : retiredBuffers)
+	{
+		vulkanLogicalDevice.destroyBuffer(retiredBuffer.vulkanBuffer);
+		deviceMemoryAllocator->free(retiredBuffer.memoryAllocation);
+	}
 	vulkanLogicalDevice.destroyBuffer(vulkanBuffer);
-	vulkanLogicalDevice.destroyBuffer(vulkanStagingBuffer);
-	vulkanLogicalDevice.freeMemory(vulkanBufferMemory);
-	vulkanLogicalDevice.freeMemory(vulkanStagingBufferMemory);
+	deviceMemoryAllocator->free(bufferMemoryAllocation);
 }
 
-vk::DeviceMemory Buffer::createVulkanBufferMemory(const vk::PhysicalDevice& vulkanPhysicalDevice, const vk::MemoryPropertyFlags& memoryPropertyFlags)
+void Buffer::createVulkanBuffer(const uint64_t elementCapacity)
 {
-	const vk::MemoryRequirements memoryRequirements{ vulkanLogicalDevice.getBufferMemoryRequirements(vulkanBuffer) };
-	const uint32_t memoryTypeIndex{ MemoryProperties::findMemoryType(vulkanPhysicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags) };
-	const vk::MemoryAllocateInfo memoryAllocateInfo{ buildMemoryAllocateInfo(memoryRequirements, memoryTypeIndex) };
-	return vulkanLogicalDevice.allocateMemory(memoryAllocateInfo);
+	this->elementCapacity = elementCapacity;
+	vulkanBuffer = vulkanLogicalDevice.createBuffer(buildBufferCreateInfo(elementCapacity));
+	const vk::MemoryPropertyFlags memoryPropertyFlags{ vk::MemoryPropertyFlagBits::eDeviceLocal };
+	const vk::MemoryPropertyFlags zeroCopyMemoryPropertyFlags{ vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent };
+	bufferMemoryAllocation = deviceMemoryAllocator->allocateBufferMemory(vulkanBuffer, memoryPropertyFlags, zeroCopyMemoryPropertyFlags);
 }
 
-const vk::MemoryAllocateInfo Buffer::buildMemoryAllocateInfo(const vk::MemoryRequirements& memoryRequirements, const uint32_t memoryTypeIndex) const
+const vk::BufferCreateInfo Buffer::buildBufferCreateInfo(const uint64_t elementCapacity) const
 {
-	return vk::MemoryAllocateInfo{
-		.allocationSize = memoryRequirements.size,
-		.memoryTypeIndex = memoryTypeIndex
+	const std::vector<uint32_t>& sharingQueueFamilyIndices{ uploadManager->getSharingQueueFamilyIndices() };
+	const bool isShared{ sharingQueueFamilyIndices.size() > 1 };
+	return vk::BufferCreateInfo{
+		.size = elementCapacity * elementSize,
+		.usage = bufferUsage,
+		.sharingMode = isShared ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+		.queueFamilyIndexCount = isShared ? static_cast<uint32_t>(sharingQueueFamilyIndices.size()) : 0,
+		.pQueueFamilyIndices = isShared ? sharingQueueFamilyIndices.data() : nullptr
 	};
 }
 
-void Buffer::bindBufferMemory(vk::Buffer& buffer, vk::DeviceMemory& memory)
+const uint32_t Buffer::reserveRange(const uint32_t elementCount)
 {
-	const vk::DeviceSize memoryOffset{ 0 };
-	vulkanLogicalDevice.bindBufferMemory(buffer, memory, memoryOffset);
+	std::optional<TlsfAllocation> tlsfAllocation{ tlsfAllocator->allocate(elementCount, 1) };
+	if (!tlsfAllocation)
+	{
+		uint64_t grownElementCapacity{ elementCapacity * 2 };
+		while (grownElementCapacity < tlsfAllocator->getUsedSize() + elementCount + TlsfAllocator::minimumAlignment)
+		{
+			grownElementCapacity *= 2;
+		}
+		relocate(grownElementCapacity);
+		tlsfAllocation = tlsfAllocator->allocate(elementCount, 1);
+	}
+	const BufferRange range{
+		.firstElement = static_cast<uint32_t>(tlsfAllocation->offset),
+		.elementCount = elementCount,
+		.handle = tlsfAllocation->handle,
+		.isAllocated = true
+	};
+	if (unusedRangeHandles.empty())
+	{
+		ranges.push_back(range);
+		return static_cast<uint32_t>(ranges.size() - 1);
+	}
+	const uint32_t rangeHandle{ unusedRangeHandles.back() };
+	unusedRangeHandles.pop_back();
+	ranges[rangeHandle] = range;
+	return rangeHandle;
 }
 
-void Buffer::copyFromStagingToDeviceMemory(const vk::CommandPool& vulkanCommandPool, const std::shared_ptr<GraphicsQueue>& graphicsQueue)
+void Buffer::upload(const BufferRange& range, const void* data)
 {
-	int commandBufferCount = 1;
-	CommandBuffer commandBuffer(vulkanLogicalDevice, vulkanCommandPool, commandBufferCount);
-	const CommandBufferCopyInfo commandBufferCopyInfo{
-		.frameIndex = 0,
-		.srcBuffer = vulkanStagingBuffer,
-		.dstBuffer = vulkanBuffer,
-		.bufferSize = vulkanBufferCreateInfo.size
-	};
-	commandBuffer.copy(commandBufferCopyInfo);
-	graphicsQueue->submit(commandBuffer.getVulkanCommandBuffer(0));
-	graphicsQueue->waitIdle();
+	const uint64_t timelineValue{ uploadManager->upload(vulkanBuffer, bufferMemoryAllocation, range.firstElement * elementSize, data, range.elementCount * elementSize) };
+	uploadTimelineValue = std::max(uploadTimelineValue, timelineValue);
+}
+
+void Buffer::relocate(const uint64_t elementCapacity)
+{
+	const vk::Buffer vulkanOldBuffer{ vulkanBuffer };
+	const MemoryAllocation oldMemoryAllocation{ bufferMemoryAllocation };
+	createVulkanBuffer(elementCapacity);
+	tlsfAllocator = std::make_unique<TlsfAllocator>(elementCapacity);
+	for (const auto& pendingRangeRelease : pendingRangeReleases)
+	{
+		ranges[pendingRangeRelease.rangeHandle].isAllocated = false;
+	}
+	std::vector<vk::BufferCopy> bufferCopyRegions;
+	for (auto& range : ranges)
+	{
+		if (!range.isAllocated)
+		{
+			continue;
+		}
+		const TlsfAllocation tlsfAllocation{ tlsfAllocator->allocate(range.elementCount, 1).value() };
+		bufferCopyRegions.push_back(vk::BufferCopy{
+			.srcOffset = range.firstElement * elementSize,
+			.dstOffset = tlsfAllocation.offset * elementSize,
+			.size = range.elementCount * elementSize
+		});
+		range.firstElement = static_cast<uint32_t>(tlsfAllocation.offset);
+		range.handle = tlsfAllocation.handle;
+	}
+	const uint64_t copyTimelineValue{ bufferCopyRegions.empty() ? 0 : uploadManager->copy(vulkanOldBuffer, vulkanBuffer, bufferCopyRegions) };
+	uploadTimelineValue = std::max(uploadTimelineValue, copyTimelineValue);
+	retiredBuffers.push_back(RetiredBuffer{
+		.vulkanBuffer = vulkanOldBuffer,
+		.memoryAllocation = oldMemoryAllocation,
+		.frameNumber = frameNumber,
+		.copyTimelineValue = copyTimelineValue
+	});
+}
+
+void Buffer::beginFrame(const uint64_t frameNumber, const uint64_t completedFrameCount)
+{
+	this->frameNumber = frameNumber;
+	releasePendingRanges(completedFrameCount);
+	destroyRetiredBuffers(completedFrameCount);
+	if (isFragmented())
+	{
+		relocate(elementCapacity);
+	}
+}
+
+void Buffer::release(const uint32_t rangeHandle)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(rangeHandle, ranges.size(), "Error in Buffer! Range handle is out of bounds");
+	pendingRangeReleases.push_back(PendingRangeRelease{
+		.rangeHandle = rangeHandle,
+		.frameNumber = frameNumber
+	});
+}
+
+void Buffer::releasePendingRanges(const uint64_t completedFrameCount)
+{
+	std::erase_if(pendingRangeReleases, [&](const PendingRangeRelease& pendingRangeRelease)
+	{
+		if (pendingRangeRelease.frameNumber >= completedFrameCount)
+		{
+			return false;
+		}
+		BufferRange& range{ ranges[pendingRangeRelease.rangeHandle] };
+		if (range.isAllocated)
+		{
+			tlsfAllocator->free(range.handle);
+			range.isAllocated = false;
+		}
+		unusedRangeHandles.push_back(pendingRangeRelease.rangeHandle);
+		return true;
+	});
+}
+
+void Buffer::destroyRetiredBuffers(const uint64_t completedFrameCount)
+{
+	const uint64_t completedTimelineValue{ uploadManager->getCompletedTimelineValue() };
+	std::erase_if(retiredBuffers, [&](const RetiredBuffer& retiredBuffer)
+	{
+		if (retiredBuffer.frameNumber >= completedFrameCount || retiredBuffer.copyTimelineValue > completedTimelineValue)
+		{
+			return false;
+		}
+		vulkanLogicalDevice.destroyBuffer(retiredBuffer.vulkanBuffer);
+		deviceMemoryAllocator->free(retiredBuffer.memoryAllocation);
+		return true;
+	});
+}
+
+const bool Buffer::isFragmented() const
+{
+	const uint64_t freeSize{ tlsfAllocator->getSize() - tlsfAllocator->getUsedSize() };
+	return tlsfAllocator->getAllocationCount() > 1 && freeSize >= elementCapacity / 4 && tlsfAllocator->getLargestFreeRange() < freeSize / 2;
+}
+
+const BufferRange& Buffer::getRange(const uint32_t rangeHandle) const
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(rangeHandle, ranges.size(), "Error in Buffer! Range handle is out of bounds");
+	return ranges[rangeHandle];
 }
 
 const vk::Buffer Buffer::getVulkanBuffer() const
 {
 	return vulkanBuffer;
+}
+
+const uint64_t Buffer::getUploadTimelineValue() const
+{
+	return uploadTimelineValue;
+}
+
+const uint64_t Buffer::getElementCapacity() const
+{
+	return elementCapacity;
 }
\ No newline at end of file
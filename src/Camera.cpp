@@ -0,0 +1,31 @@
+#include "Camera.h"
+
+Camera::Camera(const glm::vec3& position, const glm::vec3& target, const float verticalFieldOfView) : position(position), target(target), verticalFieldOfView(verticalFieldOfView)
+{
+}
+
+const glm::mat4 Camera::getViewMatrix() const
+{
+	return glm::lookAt(position, target, up);
+}
+
+const glm::mat4 Camera::getProjectionMatrix(const float aspectRatio) const
+{
+	return glm::perspective(verticalFieldOfView, aspectRatio, nearPlane, farPlane);
+}
+
+void Camera::lookAt(const glm::vec3& position, const glm::vec3& target)
+{
+	this->position = position;
+	this->target = target;
+}
+
+const glm::vec3 Camera::getPosition() const
+{
+	return position;
+}
+
+const float Camera::getVerticalFieldOfView() const
+{
+	return verticalFieldOfView;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "CameraPath.h"
+
+const CameraPath CameraPath::parse(const std::string& cameraPathFile)
+{
+	rapidjson::Document JSONDocument;
+	JSONDocument.Parse(cameraPathFile.c_str());
+	assert(JSONDocument.IsObject());
+	assert(JSONDocument.HasMember("poses"));
+	assert(JSONDocument["poses"].IsArray());
+	CameraPath cameraPath;
+	for (const auto& pose : JSONDocument["poses"].GetArray())
+	{
+		assert(pose.HasMember("position"));
+		assert(pose.HasMember("target"));
+		cameraPath.addPose(CameraPose{
+			.position = parseVector(pose["position"]),
+			.target = parseVector(pose["target"])
+		});
+	}
+	return cameraPath;
+}
+
+const glm::vec3 CameraPath::parseVector(const rapidjson::Value& value)
+{
+	assert(value.IsArray());
+	assert(value.Size() == 3);
+	return glm::vec3(value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat());
+}
+
+const CameraPath CameraPath::recordOrbit(const glm::vec3& center, const float radius, const float height, const uint32_t poseCount)
+{
+	CameraPath cameraPath;
+	for (uint32_t poseIndex = 0; poseIndex < poseCount; ++poseIndex)
+	{
+		const float angle{ glm::two_pi<float>() * static_cast<float>(poseIndex) / static_cast<float>(poseCount) };
+		cameraPath.addPose(CameraPose{
+			.position = center + glm::vec3(radius * std::cos(angle), height, radius * std::sin(angle)),
+			.target = center
+		});
+	}
+	return cameraPath;
+}
+
+void CameraPath::addPose(const CameraPose& cameraPose)
+{
+	cameraPoses.push_back(cameraPose);
+}
+
+void CameraPath::save(const std::filesystem::path& filePath) const
+{
+	std::ofstream file(filePath, std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in CameraPath! " + filePath.string() + " could not be written");
+	}
+	file << std::setprecision(std::numeric_limits<float>::max_digits10) << "{" << std::endl << "\t\"poses\": [" << std::endl;
+	for (size_t poseIndex = 0; poseIndex < cameraPoses.size(); ++poseIndex)
+	{
+		const CameraPose& cameraPose{ cameraPoses[poseIndex] };
+		file << "\t\t{ \"position\": [" << cameraPose.position.x << ", " << cameraPose.position.y << ", " << cameraPose.position.z << "], \"target\": ["
+			<< cameraPose.target.x << ", " << cameraPose.target.y << ", " << cameraPose.target.z << "] }" << (poseIndex + 1 < cameraPoses.size() ? "," : "") << std::endl;
+	}
+	file << "\t]" << std::endl << "}" << std::endl;
+}
+
+const CameraPose& CameraPath::getPose(const uint32_t frameIndex) const
+{
+	if (cameraPoses.empty())
+	{
+		throw std::runtime_error("Error in CameraPath! The camera path has no poses");
+	}
+	return cameraPoses[frameIndex % cameraPoses.size()];
+}
+
+const uint32_t CameraPath::getPoseCount() const
+{
+	return static_cast<uint32_t>(cameraPoses.size());
+}
\ No newline at end of file
@@ -16,29 +16,68 @@ const vk::CommandBufferAllocateInfo CommandBuffer::buildCommandBufferAllocateInf
 	};
 }
 
-void CommandBuffer::copy(const CommandBufferCopyInfo& commandBufferCopyInfo)
+const vk::Viewport CommandBuffer::buildViewport(const vk::Extent2D& extent)
 {
-	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(commandBufferCopyInfo.frameIndex, vulkanCommandBuffers.size(), "Error in CommandBuffer! Index is out of bounds");
-	const vk::CommandBufferBeginInfo commandBufferBeginInfo{ .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit };
-	const vk::BufferCopy bufferCopyRegion{ .size = commandBufferCopyInfo.bufferSize };
-	vulkanCommandBuffers[commandBufferCopyInfo.frameIndex].begin(commandBufferBeginInfo);
-	vulkanCommandBuffers[commandBufferCopyInfo.frameIndex].copyBuffer(commandBufferCopyInfo.srcBuffer, commandBufferCopyInfo.dstBuffer, 1, &bufferCopyRegion);
-	vulkanCommandBuffers[commandBufferCopyInfo.frameIndex].end();
+	return vk::Viewport{
+		.x = 0.0f,
+		.y = 0.0f,
+		.width = static_cast<float>(extent.width),
+		.height = static_cast<float>(extent.height),
+		.minDepth = 0.0f,
+		.maxDepth = 1.0f
+	};
+}
+
+void CommandBuffer::recordGeometryPass(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo)
+{
+	vulkanCommandBuffer.beginRenderPass(commandBufferRecordInfo.renderPassBeginInfo, vk::SubpassContents::eInline);
+	recordForwardDraws(vulkanCommandBuffer, commandBufferRecordInfo, 0, commandBufferRecordInfo.draws.size());
+	vulkanCommandBuffer.endRenderPass();
+}
+
+void CommandBuffer::recordAmbientOcclusionPass(const vk::CommandBuffer& vulkanCommandBuffer, const AmbientOcclusionPassRecordInfo& ambientOcclusionPassRecordInfo)
+{
+	const uint32_t workgroupSize{ ambientOcclusionPassRecordInfo.workgroupSize };
+	vulkanCommandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, ambientOcclusionPassRecordInfo.computePipeline);
+	vulkanCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, ambientOcclusionPassRecordInfo.computePipelineLayout, 0, ambientOcclusionPassRecordInfo.vulkanUniformDescriptorSet, ambientOcclusionPassRecordInfo.uniformDynamicOffset);
+	vulkanCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, ambientOcclusionPassRecordInfo.computePipelineLayout, 1, ambientOcclusionPassRecordInfo.vulkanBindlessDescriptorSet, nullptr);
+	vulkanCommandBuffer.pushConstants<BindlessPushConstants>(ambientOcclusionPassRecordInfo.computePipelineLayout, vk::ShaderStageFlagBits::eCompute, 0, ambientOcclusionPassRecordInfo.bindlessPushConstants);
+	vulkanCommandBuffer.dispatch((ambientOcclusionPassRecordInfo.extent.width + workgroupSize - 1) / workgroupSize, (ambientOcclusionPassRecordInfo.extent.height + workgroupSize - 1) / workgroupSize, 1);
+}
+
+void CommandBuffer::recordForwardPass(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo, ParallelCommandRecorder& parallelCommandRecorder, ThreadPool& threadPool)
+{
+	const vk::CommandBufferInheritanceInfo commandBufferInheritanceInfo{
+		.renderPass = commandBufferRecordInfo.renderPassBeginInfo.renderPass,
+		.subpass = 0,
+		.framebuffer = commandBufferRecordInfo.renderPassBeginInfo.framebuffer,
+		.pipelineStatistics = commandBufferRecordInfo.pipelineStatistics
+	};
+	vulkanCommandBuffer.beginRenderPass(commandBufferRecordInfo.renderPassBeginInfo, vk::SubpassContents::eSecondaryCommandBuffers);
+	parallelCommandRecorder.recordSecondaryCommandBuffers(vulkanCommandBuffer, commandBufferInheritanceInfo, commandBufferRecordInfo.draws.size(), [&](const vk::CommandBuffer& vulkanSecondaryCommandBuffer, const size_t firstDraw, const size_t lastDraw)
+	{
+		recordForwardDraws(vulkanSecondaryCommandBuffer, commandBufferRecordInfo, firstDraw, lastDraw);
+	}, threadPool);
+	vulkanCommandBuffer.endRenderPass();
 }
 
-void CommandBuffer::record(const CommandBufferRecordInfo& commandBufferRecordInfo)
+void CommandBuffer::recordForwardDraws(const vk::CommandBuffer& vulkanCommandBuffer, const CommandBufferRecordInfo& commandBufferRecordInfo, const size_t firstDraw, const size_t lastDraw)
 {
-	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(commandBufferRecordInfo.frameIndex, vulkanCommandBuffers.size(), "Error in CommandBuffer! Index is out of bounds");
 	vk::Buffer vulkanVertexBuffers[] = { commandBufferRecordInfo.vulkanVertexBuffer };
 	vk::DeviceSize offsets[] = { commandBufferRecordInfo.offset };
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].begin(vk::CommandBufferBeginInfo{});
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].beginRenderPass(commandBufferRecordInfo.renderPassBeginInfo, vk::SubpassContents::eInline);
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].bindPipeline(vk::PipelineBindPoint::eGraphics, commandBufferRecordInfo.graphicsPipeline);
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].bindVertexBuffers(commandBufferRecordInfo.firstBinding, commandBufferRecordInfo.bindingCount, vulkanVertexBuffers, offsets);
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].bindIndexBuffer(commandBufferRecordInfo.vulkanIndexBuffer, commandBufferRecordInfo.offset, commandBufferRecordInfo.indexType);
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].drawIndexed(static_cast<uint32_t>(commandBufferRecordInfo.indexCount), commandBufferRecordInfo.instanceCount, commandBufferRecordInfo.firstIndex, commandBufferRecordInfo.vertexOffset, commandBufferRecordInfo.firstInstance);
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].endRenderPass();
-	vulkanCommandBuffers[commandBufferRecordInfo.frameIndex].end();
+	vulkanCommandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, commandBufferRecordInfo.graphicsPipeline);
+	vulkanCommandBuffer.setViewport(0, buildViewport(commandBufferRecordInfo.renderPassBeginInfo.renderArea.extent));
+	vulkanCommandBuffer.setScissor(0, commandBufferRecordInfo.renderPassBeginInfo.renderArea);
+	vulkanCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, commandBufferRecordInfo.graphicsPipelineLayout, 0, commandBufferRecordInfo.vulkanUniformDescriptorSet, commandBufferRecordInfo.uniformDynamicOffset);
+	vulkanCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, commandBufferRecordInfo.graphicsPipelineLayout, 1, commandBufferRecordInfo.vulkanBindlessDescriptorSet, nullptr);
+	vulkanCommandBuffer.pushConstants<BindlessPushConstants>(commandBufferRecordInfo.graphicsPipelineLayout, vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment, 0, commandBufferRecordInfo.bindlessPushConstants);
+	vulkanCommandBuffer.bindVertexBuffers(commandBufferRecordInfo.firstBinding, commandBufferRecordInfo.bindingCount, vulkanVertexBuffers, offsets);
+	vulkanCommandBuffer.bindIndexBuffer(commandBufferRecordInfo.vulkanIndexBuffer, commandBufferRecordInfo.offset, commandBufferRecordInfo.indexType);
+	for (size_t drawIndex = firstDraw; drawIndex < lastDraw; ++drawIndex)
+	{
+		const IndexedDraw& draw{ commandBufferRecordInfo.draws[drawIndex] };
+		vulkanCommandBuffer.drawIndexed(draw.indexCount, draw.instanceCount, draw.firstIndex, draw.vertexOffset, draw.firstInstance);
+	}
 }
 
 void CommandBuffer::reset(const int frameIndex)
@@ -0,0 +1,51 @@
+#include "CommandBufferCache.h"
+
+CommandBufferCache::CommandBufferCache(const uint32_t slotCount) : slots(slotCount)
+{
+}
+
+void CommandBufferCache::resize(const uint32_t slotCount)
+{
+	invalidate();
+	slots.resize(slotCount);
+}
+
+void CommandBufferCache::invalidate()
+{
+	for (auto& slot : slots)
+	{
+		slot.reset();
+	}
+	++statistics.invalidationCount;
+}
+
+const std::optional<std::vector<vk::CommandBuffer>> CommandBufferCache::find(const uint32_t slotIndex, const CommandBufferCacheKey& key)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(slotIndex, slots.size(), "Error in CommandBufferCache! Slot index is out of bounds");
+	if (!slots[slotIndex] || slots[slotIndex]->key != key)
+	{
+		return std::nullopt;
+	}
+	++statistics.reusedFrameCount;
+	return slots[slotIndex]->vulkanCommandBuffers;
+}
+
+void CommandBufferCache::store(const uint32_t slotIndex, const CommandBufferCacheKey& key, const std::vector<vk::CommandBuffer>& vulkanCommandBuffers)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(slotIndex, slots.size(), "Error in CommandBufferCache! Slot index is out of bounds");
+	slots[slotIndex] = CommandBufferCacheEntry{
+		.key = key,
+		.vulkanCommandBuffers = vulkanCommandBuffers
+	};
+	++statistics.recordedFrameCount;
+}
+
+const uint32_t CommandBufferCache::getSlotCount() const
+{
+	return static_cast<uint32_t>(slots.size());
+}
+
+const CommandBufferCacheStatistics CommandBufferCache::getStatistics() const
+{
+	return statistics;
+}
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "CommandPool.h"
 
-CommandPool::CommandPool(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t> graphicsFamilyIndex) : vulkanLogicalDevice(vulkanLogicalDevice)
+CommandPool::CommandPool(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t> graphicsFamilyIndex, const vk::CommandPoolCreateFlags flags) : vulkanLogicalDevice(vulkanLogicalDevice)
 {
-	const vk::CommandPoolCreateInfo commandPoolCreateInfo{ buildCommandPoolCreateInfo(graphicsFamilyIndex) };
+	const vk::CommandPoolCreateInfo commandPoolCreateInfo{ buildCommandPoolCreateInfo(graphicsFamilyIndex, flags) };
 	vulkanCommandPool = vulkanLogicalDevice.createCommandPool(commandPoolCreateInfo);
 }
 
@@ -11,10 +11,15 @@ CommandPool::~CommandPool()
 	vulkanLogicalDevice.destroyCommandPool(vulkanCommandPool);
 }
 
-const vk::CommandPoolCreateInfo CommandPool::buildCommandPoolCreateInfo(const std::optional<uint32_t> graphicsFamilyIndex) const
+void CommandPool::reset()
+{
+	vulkanLogicalDevice.resetCommandPool(vulkanCommandPool);
+}
+
+const vk::CommandPoolCreateInfo CommandPool::buildCommandPoolCreateInfo(const std::optional<uint32_t> graphicsFamilyIndex, const vk::CommandPoolCreateFlags flags) const
 {
 	return vk::CommandPoolCreateInfo{
-		.flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+		.flags = flags,
 		.queueFamilyIndex = graphicsFamilyIndex.value()
 	};
 }
@@ -0,0 +1,42 @@
+#include "ComputePipeline.h"
+
+ComputePipeline::ComputePipeline(const ComputePipelineCreateInfo& computePipelineCreateInfo) : vulkanLogicalDevice(computePipelineCreateInfo.vulkanLogicalDevice)
+{
+	const vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo{ buildPipelineLayoutCreateInfo(computePipelineCreateInfo.descriptorSetLayouts, computePipelineCreateInfo.pushConstantRanges) };
+	pipelineLayout = vulkanLogicalDevice.createPipelineLayout(pipelineLayoutCreateInfo);
+	const vk::ComputePipelineCreateInfo vulkanComputePipelineCreateInfo{
+		.stage = computePipelineCreateInfo.shaderStage,
+		.layout = pipelineLayout,
+		.basePipelineHandle = nullptr,
+		.basePipelineIndex = -1
+	};
+	const vk::ResultValue<vk::Pipeline> computePipeline = vulkanLogicalDevice.createComputePipeline(computePipelineCreateInfo.vulkanPipelineCache, vulkanComputePipelineCreateInfo);
+	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(computePipeline.result, "Unable to create the compute pipeline!");
+	pipeline = computePipeline.value;
+}
+
+ComputePipeline::~ComputePipeline()
+{
+	vulkanLogicalDevice.destroyPipeline(pipeline);
+	vulkanLogicalDevice.destroyPipelineLayout(pipelineLayout);
+}
+
+const vk::PipelineLayoutCreateInfo ComputePipeline::buildPipelineLayoutCreateInfo(const std::vector<vk::DescriptorSetLayout>& descriptorSetLayouts, const std::vector<vk::PushConstantRange>& pushConstantRanges) const
+{
+	return vk::PipelineLayoutCreateInfo{
+		.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size()),
+		.pSetLayouts = descriptorSetLayouts.data(),
+		.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size()),
+		.pPushConstantRanges = pushConstantRanges.data()
+	};
+}
+
+const vk::Pipeline ComputePipeline::getVulkanPipeline() const
+{
+	return pipeline;
+}
+
+const vk::PipelineLayout ComputePipeline::getVulkanPipelineLayout() const
+{
+	return pipelineLayout;
+}
\ No newline at end of file
@@ -0,0 +1,5 @@
+#include "ComputeQueue.h"
+
+ComputeQueue::ComputeQueue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex) : Queue(vulkanLogicalDevice, queueFamilyIndex)
+{
+}
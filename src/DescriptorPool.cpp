@@ -0,0 +1,37 @@
+#include "DescriptorPool.h"
+
+DescriptorPool::DescriptorPool(const vk::Device& vulkanLogicalDevice, const std::vector<vk::DescriptorPoolSize>& descriptorPoolSizes, const uint32_t maxSets, const vk::DescriptorPoolCreateFlags& descriptorPoolCreateFlags) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	const vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo{ buildDescriptorPoolCreateInfo(descriptorPoolSizes, maxSets, descriptorPoolCreateFlags) };
+	vulkanDescriptorPool = vulkanLogicalDevice.createDescriptorPool(descriptorPoolCreateInfo);
+}
+
+DescriptorPool::~DescriptorPool()
+{
+	vulkanLogicalDevice.destroyDescriptorPool(vulkanDescriptorPool);
+}
+
+const vk::DescriptorPoolCreateInfo DescriptorPool::buildDescriptorPoolCreateInfo(const std::vector<vk::DescriptorPoolSize>& descriptorPoolSizes, const uint32_t maxSets, const vk::DescriptorPoolCreateFlags& descriptorPoolCreateFlags) const
+{
+	return vk::DescriptorPoolCreateInfo{
+		.flags = descriptorPoolCreateFlags,
+		.maxSets = maxSets,
+		.poolSizeCount = static_cast<uint32_t>(descriptorPoolSizes.size()),
+		.pPoolSizes = descriptorPoolSizes.data()
+	};
+}
+
+const vk::DescriptorSet DescriptorPool::allocate(const vk::DescriptorSetLayout& vulkanDescriptorSetLayout) const
+{
+	const vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo{
+		.descriptorPool = vulkanDescriptorPool,
+		.descriptorSetCount = 1,
+		.pSetLayouts = &vulkanDescriptorSetLayout
+	};
+	return vulkanLogicalDevice.allocateDescriptorSets(descriptorSetAllocateInfo).front();
+}
+
+const vk::DescriptorPool DescriptorPool::getVulkanDescriptorPool() const
+{
+	return vulkanDescriptorPool;
+}
\ No newline at end of file
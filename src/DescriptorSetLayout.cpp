@@ -0,0 +1,34 @@
+#include "DescriptorSetLayout.h"
+
+DescriptorSetLayout::DescriptorSetLayout(const vk::Device& vulkanLogicalDevice, const std::vector<vk::DescriptorSetLayoutBinding>& descriptorSetLayoutBindings, const vk::DescriptorSetLayoutCreateFlags& descriptorSetLayoutCreateFlags,
+	const std::vector<vk::DescriptorBindingFlags>& descriptorBindingFlags) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	const vk::DescriptorSetLayoutBindingFlagsCreateInfo descriptorSetLayoutBindingFlagsCreateInfo{
+		.bindingCount = static_cast<uint32_t>(descriptorBindingFlags.size()),
+		.pBindingFlags = descriptorBindingFlags.data()
+	};
+	const vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{ buildDescriptorSetLayoutCreateInfo(descriptorSetLayoutBindings, descriptorSetLayoutCreateFlags,
+		descriptorBindingFlags.empty() ? nullptr : &descriptorSetLayoutBindingFlagsCreateInfo) };
+	vulkanDescriptorSetLayout = vulkanLogicalDevice.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+}
+
+DescriptorSetLayout::~DescriptorSetLayout()
+{
+	vulkanLogicalDevice.destroyDescriptorSetLayout(vulkanDescriptorSetLayout);
+}
+
+const vk::DescriptorSetLayoutCreateInfo DescriptorSetLayout::buildDescriptorSetLayoutCreateInfo(const std::vector<vk::DescriptorSetLayoutBinding>& descriptorSetLayoutBindings, const vk::DescriptorSetLayoutCreateFlags& descriptorSetLayoutCreateFlags,
+	const vk::DescriptorSetLayoutBindingFlagsCreateInfo* descriptorSetLayoutBindingFlagsCreateInfo) const
+{
+	return vk::DescriptorSetLayoutCreateInfo{
+		.pNext = descriptorSetLayoutBindingFlagsCreateInfo,
+		.flags = descriptorSetLayoutCreateFlags,
+		.bindingCount = static_cast<uint32_t>(descriptorSetLayoutBindings.size()),
+		.pBindings = descriptorSetLayoutBindings.data()
+	};
+}
+
+const vk::DescriptorSetLayout DescriptorSetLayout::getVulkanDescriptorSetLayout() const
+{
+	return vulkanDescriptorSetLayout;
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include "DeviceMemoryAllocator.h"
+
+DeviceMemoryAllocator::DeviceMemoryAllocator(const DeviceMemoryAllocatorCreateInfo& deviceMemoryAllocatorCreateInfo) : vulkanLogicalDevice(deviceMemoryAllocatorCreateInfo.vulkanLogicalDevice),
+	vulkanPhysicalDevice(deviceMemoryAllocatorCreateInfo.vulkanPhysicalDevice), preferredBlockSize(deviceMemoryAllocatorCreateInfo.preferredBlockSize)
+{
+	physicalDeviceMemoryProperties = vulkanPhysicalDevice.getMemoryProperties();
+	maxMemoryAllocationCount = vulkanPhysicalDevice.getProperties().limits.maxMemoryAllocationCount;
+	memoryHeapUsages.resize(physicalDeviceMemoryProperties.memoryHeapCount, 0);
+}
+
+const MemoryAllocation DeviceMemoryAllocator::allocate(const vk::MemoryRequirements& memoryRequirements, const vk::MemoryPropertyFlags& memoryPropertyFlags, const MemoryResourceType memoryResourceType, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags)
+{
+	const std::vector<uint32_t> memoryTypeIndices{ MemoryProperties::rankMemoryTypes(physicalDeviceMemoryProperties, memoryRequirements.memoryTypeBits, memoryPropertyFlags, preferredMemoryPropertyFlags) };
+	std::lock_guard<std::mutex> lock(memoryBlocksMutex);
+	for (const uint32_t memoryTypeIndex : memoryTypeIndices)
+	{
+		const std::optional<MemoryAllocation> memoryAllocation{ allocateFromMemoryType(memoryTypeIndex, memoryRequirements, memoryResourceType) };
+		if (memoryAllocation)
+		{
+			return memoryAllocation.value();
+		}
+	}
+	throw std::runtime_error("Failed to find suitable memory type!");
+}
+
+std::optional<MemoryAllocation> DeviceMemoryAllocator::allocateFromMemoryType(const uint32_t memoryTypeIndex, const vk::MemoryRequirements& memoryRequirements, const MemoryResourceType memoryResourceType)
+{
+	const vk::DeviceSize blockSize{ computeBlockSize(memoryTypeIndex) };
+	if (memoryRequirements.size > blockSize / 2)
+	{
+		const vk::DeviceSize dedicatedBlockSize{ (memoryRequirements.size + TlsfAllocator::minimumAlignment - 1) & ~(TlsfAllocator::minimumAlignment - 1) };
+		if (!fitsInMemoryHeap(memoryTypeIndex, dedicatedBlockSize))
+		{
+			return std::nullopt;
+		}
+		const std::optional<uint32_t> memoryBlockIndex{ tryCreateMemoryBlock(memoryTypeIndex, memoryResourceType, dedicatedBlockSize, true) };
+		if (!memoryBlockIndex)
+		{
+			return std::nullopt;
+		}
+		return allocateFromMemoryBlock(memoryBlockIndex.value(), memoryRequirements, memoryBlocks[memoryBlockIndex.value()]->allocate(memoryRequirements.size, memoryRequirements.alignment).value());
+	}
+	for (uint32_t memoryBlockIndex = 0; memoryBlockIndex < memoryBlocks.size(); ++memoryBlockIndex)
+	{
+		const auto& memoryBlock{ memoryBlocks[memoryBlockIndex] };
+		if (!memoryBlock || memoryBlock->isDedicated() || memoryBlock->getMemoryTypeIndex() != memoryTypeIndex || memoryBlock->getMemoryResourceType() != memoryResourceType)
+		{
+			continue;
+		}
+		const std::optional<TlsfAllocation> tlsfAllocation{ memoryBlock->allocate(memoryRequirements.size, memoryRequirements.alignment) };
+		if (tlsfAllocation)
+		{
+			return allocateFromMemoryBlock(memoryBlockIndex, memoryRequirements, tlsfAllocation.value());
+		}
+	}
+	if (!fitsInMemoryHeap(memoryTypeIndex, blockSize))
+	{
+		return std::nullopt;
+	}
+	const std::optional<uint32_t> memoryBlockIndex{ tryCreateMemoryBlock(memoryTypeIndex, memoryResourceType, blockSize, false) };
+	if (!memoryBlockIndex)
+	{
+		return std::nullopt;
+	}
+	return allocateFromMemoryBlock(memoryBlockIndex.value(), memoryRequirements, memoryBlocks[memoryBlockIndex.value()]->allocate(memoryRequirements.size, memoryRequirements.alignment).value());
+}
+
+const MemoryAllocation DeviceMemoryAllocator::allocateBufferMemory(const vk::Buffer& vulkanBuffer, const vk::MemoryPropertyFlags& memoryPropertyFlags, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags)
+{
+	const vk::MemoryRequirements memoryRequirements{ vulkanLogicalDevice.getBufferMemoryRequirements(vulkanBuffer) };
+	const MemoryAllocation memoryAllocation{ allocate(memoryRequirements, memoryPropertyFlags, MemoryResourceType::eBuffer, preferredMemoryPropertyFlags) };
+	vulkanLogicalDevice.bindBufferMemory(vulkanBuffer, memoryAllocation.vulkanDeviceMemory, memoryAllocation.offset);
+	return memoryAllocation;
+}
+
+const MemoryAllocation DeviceMemoryAllocator::allocateImageMemory(const vk::Image& vulkanImage, const vk::MemoryPropertyFlags& memoryPropertyFlags, const vk::MemoryPropertyFlags& preferredMemoryPropertyFlags)
+{
+	const vk::MemoryRequirements memoryRequirements{ vulkanLogicalDevice.getImageMemoryRequirements(vulkanImage) };
+	const MemoryAllocation memoryAllocation{ allocate(memoryRequirements, memoryPropertyFlags, MemoryResourceType::eImage, preferredMemoryPropertyFlags) };
+	vulkanLogicalDevice.bindImageMemory(vulkanImage, memoryAllocation.vulkanDeviceMemory, memoryAllocation.offset);
+	return memoryAllocation;
+}
+
+const MemoryAllocation DeviceMemoryAllocator::allocateFromMemoryBlock(const uint32_t memoryBlockIndex, const vk::MemoryRequirements& memoryRequirements, const TlsfAllocation& tlsfAllocation) const
+{
+	const auto& memoryBlock{ memoryBlocks[memoryBlockIndex] };
+	return MemoryAllocation{
+		.vulkanDeviceMemory = memoryBlock->getVulkanDeviceMemory(),
+		.offset = tlsfAllocation.offset,
+		.size = memoryRequirements.size,
+		.mappedData = memoryBlock->getMappedData(tlsfAllocation.offset),
+		.memoryTypeIndex = memoryBlock->getMemoryTypeIndex(),
+		.memoryBlockIndex = memoryBlockIndex,
+		.handle = tlsfAllocation.handle
+	};
+}
+
+const uint32_t DeviceMemoryAllocator::createMemoryBlock(const uint32_t memoryTypeIndex, const MemoryResourceType memoryResourceType, const vk::DeviceSize size, const bool isDedicated)
+{
+	if (activeMemoryBlockCount >= maxMemoryAllocationCount)
+	{
+		throw std::runtime_error("Error in DeviceMemoryAllocator! Device memory allocation count limit has been reached");
+	}
+	const vk::MemoryPropertyFlags memoryPropertyFlags{ physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags };
+	const MemoryBlockCreateInfo memoryBlockCreateInfo{
+		.vulkanLogicalDevice = vulkanLogicalDevice,
+		.size = size,
+		.memoryTypeIndex = memoryTypeIndex,
+		.memoryResourceType = memoryResourceType,
+		.isHostVisible = static_cast<bool>(memoryPropertyFlags & vk::MemoryPropertyFlagBits::eHostVisible),
+		.isDedicated = isDedicated
+	};
+	auto memoryBlock{ std::make_unique<MemoryBlock>(memoryBlockCreateInfo) };
+	++activeMemoryBlockCount;
+	memoryHeapUsages[physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex] += size;
+	const auto unusedSlot{ std::find(memoryBlocks.begin(), memoryBlocks.end(), nullptr) };
+	if (unusedSlot != memoryBlocks.end())
+	{
+		*unusedSlot = std::move(memoryBlock);
+		return static_cast<uint32_t>(unusedSlot - memoryBlocks.begin());
+	}
+	memoryBlocks.push_back(std::move(memoryBlock));
+	return static_cast<uint32_t>(memoryBlocks.size() - 1);
+}
+
+std::optional<uint32_t> DeviceMemoryAllocator::tryCreateMemoryBlock(const uint32_t memoryTypeIndex, const MemoryResourceType memoryResourceType, const vk::DeviceSize size, const bool isDedicated)
+{
+	try
+	{
+		return createMemoryBlock(memoryTypeIndex, memoryResourceType, size, isDedicated);
+	}
+	catch (const vk::OutOfDeviceMemoryError&)
+	{
+		return std::nullopt;
+	}
+}
+
+void DeviceMemoryAllocator::free(const MemoryAllocation& memoryAllocation)
+{
+	std::lock_guard<std::mutex> lock(memoryBlocksMutex);
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(memoryAllocation.memoryBlockIndex, memoryBlocks.size(), "Error in DeviceMemoryAllocator! Memory block index is out of bounds");
+	auto& memoryBlock{ memoryBlocks[memoryAllocation.memoryBlockIndex] };
+	memoryBlock->free(memoryAllocation.handle);
+	if (memoryBlock->getTlsfAllocator().isEmpty() && (memoryBlock->isDedicated() || hasOtherEmptyMemoryBlock(memoryAllocation.memoryBlockIndex)))
+	{
+		memoryHeapUsages[physicalDeviceMemoryProperties.memoryTypes[memoryBlock->getMemoryTypeIndex()].heapIndex] -= memoryBlock->getTlsfAllocator().getSize();
+		memoryBlock.reset();
+		--activeMemoryBlockCount;
+	}
+}
+
+const bool DeviceMemoryAllocator::hasOtherEmptyMemoryBlock(const uint32_t memoryBlockIndex) const
+{
+	const auto& emptyMemoryBlock{ memoryBlocks[memoryBlockIndex] };
+	for (uint32_t otherMemoryBlockIndex = 0; otherMemoryBlockIndex < memoryBlocks.size(); ++otherMemoryBlockIndex)
+	{
+		const auto& memoryBlock{ memoryBlocks[otherMemoryBlockIndex] };
+		if (otherMemoryBlockIndex != memoryBlockIndex && memoryBlock && !memoryBlock->isDedicated() && memoryBlock->getTlsfAllocator().isEmpty()
+			&& memoryBlock->getMemoryTypeIndex() == emptyMemoryBlock->getMemoryTypeIndex() && memoryBlock->getMemoryResourceType() == emptyMemoryBlock->getMemoryResourceType())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const vk::DeviceSize DeviceMemoryAllocator::computeBlockSize(const uint32_t memoryTypeIndex) const
+{
+	const uint32_t heapIndex{ physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex };
+	const vk::DeviceSize heapSize{ physicalDeviceMemoryProperties.memoryHeaps[heapIndex].size };
+	return std::min(preferredBlockSize, heapSize / 8);
+}
+
+const bool DeviceMemoryAllocator::fitsInMemoryHeap(const uint32_t memoryTypeIndex, const vk::DeviceSize size) const
+{
+	const uint32_t heapIndex{ physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex };
+	return memoryHeapUsages[heapIndex] + size <= physicalDeviceMemoryProperties.memoryHeaps[heapIndex].size;
+}
+
+const MemoryStatistics DeviceMemoryAllocator::getStatistics() const
+{
+	std::lock_guard<std::mutex> lock(memoryBlocksMutex);
+	MemoryStatistics memoryStatistics{};
+	vk::DeviceSize freeBytes{ 0 };
+	vk::DeviceSize largestFreeRangeSum{ 0 };
+	for (const auto& memoryBlock : memoryBlocks)
+	{
+		if (!memoryBlock)
+		{
+			continue;
+		}
+		const TlsfAllocator& tlsfAllocator{ memoryBlock->getTlsfAllocator() };
+		const vk::DeviceSize largestFreeRange{ tlsfAllocator.getLargestFreeRange() };
+		++memoryStatistics.memoryBlockCount;
+		memoryStatistics.allocationCount += tlsfAllocator.getAllocationCount();
+		memoryStatistics.reservedBytes += tlsfAllocator.getSize();
+		memoryStatistics.usedBytes += tlsfAllocator.getUsedSize();
+		memoryStatistics.largestFreeRange = std::max(memoryStatistics.largestFreeRange, largestFreeRange);
+		freeBytes += tlsfAllocator.getSize() - tlsfAllocator.getUsedSize();
+		largestFreeRangeSum += largestFreeRange;
+	}
+	memoryStatistics.fragmentation = freeBytes > 0 ? 1.0f - static_cast<float>(largestFreeRangeSum) / static_cast<float>(freeBytes) : 0.0f;
+	return memoryStatistics;
+}
+
+const vk::MemoryPropertyFlags DeviceMemoryAllocator::getMemoryPropertyFlags(const uint32_t memoryTypeIndex) const
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(memoryTypeIndex, physicalDeviceMemoryProperties.memoryTypeCount, "Error in DeviceMemoryAllocator! Memory type index is out of bounds");
+	return physicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+}
+
+const vk::Device DeviceMemoryAllocator::getVulkanLogicalDevice() const
+{
+	return vulkanLogicalDevice;
+}
@@ -0,0 +1,119 @@
+#include "FrameCapture.h"
+
+FrameCapture::FrameCapture(const FrameCaptureCreateInfo& frameCaptureCreateInfo) : deviceMemoryAllocator(frameCaptureCreateInfo.deviceMemoryAllocator), format(frameCaptureCreateInfo.format)
+{
+	if (format != vk::Format::eB8G8R8A8Srgb && format != vk::Format::eB8G8R8A8Unorm && format != vk::Format::eR8G8B8A8Srgb && format != vk::Format::eR8G8B8A8Unorm)
+	{
+		throw std::runtime_error("Error in FrameCapture! Only 8-bit RGBA and BGRA swap chain formats can be captured");
+	}
+}
+
+FrameCapture::~FrameCapture()
+{
+	destroyVulkanBuffer();
+}
+
+void FrameCapture::request(const vk::Extent2D& extent)
+{
+	if (isCaptureRecorded)
+	{
+		throw std::runtime_error("Error in FrameCapture! The previous capture has not been read yet");
+	}
+	if (extent != bufferExtent)
+	{
+		destroyVulkanBuffer();
+		createVulkanBuffer(extent);
+	}
+	isCaptureRequested = true;
+}
+
+void FrameCapture::createVulkanBuffer(const vk::Extent2D& extent)
+{
+	const vk::BufferCreateInfo bufferCreateInfo{
+		.size = static_cast<vk::DeviceSize>(extent.width) * extent.height * bytesPerPixel,
+		.usage = vk::BufferUsageFlagBits::eTransferDst,
+		.sharingMode = vk::SharingMode::eExclusive
+	};
+	vulkanBuffer = deviceMemoryAllocator->getVulkanLogicalDevice().createBuffer(bufferCreateInfo);
+	memoryAllocation = deviceMemoryAllocator->allocateBufferMemory(vulkanBuffer, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, vk::MemoryPropertyFlagBits::eHostCached);
+	bufferExtent = extent;
+}
+
+void FrameCapture::destroyVulkanBuffer()
+{
+	if (!vulkanBuffer)
+	{
+		return;
+	}
+	deviceMemoryAllocator->getVulkanLogicalDevice().destroyBuffer(vulkanBuffer);
+	deviceMemoryAllocator->free(memoryAllocation);
+	vulkanBuffer = nullptr;
+	bufferExtent = vk::Extent2D{ 0, 0 };
+}
+
+void FrameCapture::record(const vk::CommandBuffer& vulkanCommandBuffer, const vk::Image& vulkanImage, const vk::Extent2D& extent)
+{
+	if (!isCaptureRequested || extent != bufferExtent)
+	{
+		return;
+	}
+	const vk::BufferImageCopy bufferImageCopy{ buildBufferImageCopy() };
+	vulkanCommandBuffer.copyImageToBuffer(vulkanImage, vk::ImageLayout::eTransferSrcOptimal, vulkanBuffer, 1, &bufferImageCopy);
+	const vk::MemoryBarrier memoryBarrier{
+		.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+		.dstAccessMask = vk::AccessFlagBits::eHostRead
+	};
+	vulkanCommandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost, vk::DependencyFlags{}, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+	isCaptureRequested = false;
+	isCaptureRecorded = true;
+}
+
+const vk::BufferImageCopy FrameCapture::buildBufferImageCopy() const
+{
+	return vk::BufferImageCopy{
+		.bufferOffset = 0,
+		.bufferRowLength = 0,
+		.bufferImageHeight = 0,
+		.imageSubresource = vk::ImageSubresourceLayers{
+			.aspectMask = vk::ImageAspectFlagBits::eColor,
+			.mipLevel = 0,
+			.baseArrayLayer = 0,
+			.layerCount = 1
+		},
+		.imageOffset = vk::Offset3D{ 0, 0, 0 },
+		.imageExtent = vk::Extent3D{ bufferExtent.width, bufferExtent.height, 1 }
+	};
+}
+
+const std::optional<LuminanceImage> FrameCapture::read()
+{
+	if (!isCaptureRecorded)
+	{
+		return std::nullopt;
+	}
+	const uint8_t* capturedPixels{ static_cast<const uint8_t*>(memoryAllocation.mappedData) };
+	const uint32_t redOffset{ isBlueFirst() ? 2u : 0u };
+	const uint32_t blueOffset{ isBlueFirst() ? 0u : 2u };
+	LuminanceImage luminanceImage{
+		.width = bufferExtent.width,
+		.height = bufferExtent.height,
+		.pixels = std::vector<float>(static_cast<size_t>(bufferExtent.width) * bufferExtent.height)
+	};
+	for (size_t pixelIndex = 0; pixelIndex < luminanceImage.pixels.size(); ++pixelIndex)
+	{
+		const uint8_t* capturedPixel{ capturedPixels + pixelIndex * bytesPerPixel };
+		luminanceImage.pixels[pixelIndex] = std::round(0.299f * capturedPixel[redOffset] + 0.587f * capturedPixel[1] + 0.114f * capturedPixel[blueOffset]) / 255.0f;
+	}
+	isCaptureRecorded = false;
+	return luminanceImage;
+}
+
+const bool FrameCapture::isBlueFirst() const
+{
+	return format == vk::Format::eB8G8R8A8Srgb || format == vk::Format::eB8G8R8A8Unorm;
+}
+
+const bool FrameCapture::isRequested() const
+{
+	return isCaptureRequested;
+}
\ No newline at end of file
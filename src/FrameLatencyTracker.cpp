@@ -0,0 +1,76 @@
+#include "FrameLatencyTracker.h"
+
+FrameLatencyTracker::FrameLatencyTracker(const TimelineSemaphore& timelineSemaphore) : timelineSemaphore(timelineSemaphore)
+{
+	completionWaiter = std::thread(&FrameLatencyTracker::runCompletionWaiter, this);
+}
+
+FrameLatencyTracker::~FrameLatencyTracker()
+{
+	isStopping = true;
+	pendingFramesCondition.notify_all();
+	completionWaiter.join();
+}
+
+void FrameLatencyTracker::addFrame(const FrameTimestamps& frameTimestamps)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		const double frameInputToPresentMilliseconds{ std::chrono::duration<double, std::milli>(frameTimestamps.presentTime - frameTimestamps.inputTime).count() };
+		inputToPresentMilliseconds += frameInputToPresentMilliseconds;
+		maximumInputToPresentMilliseconds = std::max(maximumInputToPresentMilliseconds, frameInputToPresentMilliseconds);
+		firstPresentTime = firstPresentTime.value_or(frameTimestamps.presentTime);
+		lastPresentTime = frameTimestamps.presentTime;
+		++presentedFrameCount;
+		pendingFrames.push(frameTimestamps);
+	}
+	pendingFramesCondition.notify_one();
+}
+
+void FrameLatencyTracker::runCompletionWaiter()
+{
+	while (true)
+	{
+		FrameTimestamps frameTimestamps;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			pendingFramesCondition.wait(lock, [this]() { return isStopping || !pendingFrames.empty(); });
+			if (isStopping)
+			{
+				return;
+			}
+			frameTimestamps = pendingFrames.front();
+			pendingFrames.pop();
+		}
+		while (!timelineSemaphore.waitFor(frameTimestamps.completionValue, completionPollTimeout))
+		{
+			if (isStopping)
+			{
+				return;
+			}
+		}
+		addCompletion(frameTimestamps, std::chrono::steady_clock::now());
+	}
+}
+
+void FrameLatencyTracker::addCompletion(const FrameTimestamps& frameTimestamps, const std::chrono::steady_clock::time_point completionTime)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	const double frameSubmitToCompletionMilliseconds{ std::chrono::duration<double, std::milli>(completionTime - frameTimestamps.submitTime).count() };
+	submitToCompletionMilliseconds += frameSubmitToCompletionMilliseconds;
+	maximumSubmitToCompletionMilliseconds = std::max(maximumSubmitToCompletionMilliseconds, frameSubmitToCompletionMilliseconds);
+	++completedFrameCount;
+}
+
+const FrameLatencyStatistics FrameLatencyTracker::getStatistics() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return FrameLatencyStatistics{
+		.frameCount = presentedFrameCount,
+		.averageFrameMilliseconds = presentedFrameCount > 1 ? std::chrono::duration<double, std::milli>(lastPresentTime - firstPresentTime.value()).count() / (presentedFrameCount - 1) : 0.0,
+		.averageInputToPresentMilliseconds = presentedFrameCount > 0 ? inputToPresentMilliseconds / presentedFrameCount : 0.0,
+		.maximumInputToPresentMilliseconds = maximumInputToPresentMilliseconds,
+		.averageSubmitToCompletionMilliseconds = completedFrameCount > 0 ? submitToCompletionMilliseconds / completedFrameCount : 0.0,
+		.maximumSubmitToCompletionMilliseconds = maximumSubmitToCompletionMilliseconds
+	};
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#include "FramePacer.h"
+
+FramePacer::FramePacer(const std::optional<double>& targetFrameRate) : framePeriod(targetFrameRate && *targetFrameRate > 0.0
+	? std::optional<std::chrono::steady_clock::duration>(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / *targetFrameRate)))
+	: std::nullopt)
+{
+}
+
+void FramePacer::waitForNextFrame()
+{
+	if (!framePeriod)
+	{
+		return;
+	}
+	TRACE_ZONE("WaitForNextFrame");
+	const std::chrono::steady_clock::time_point now{ std::chrono::steady_clock::now() };
+	deadline = deadline ? *deadline + *framePeriod : now;
+	if (*deadline + *framePeriod < now)
+	{
+		deadline = now;
+		return;
+	}
+	if (*deadline - now > spinDuration)
+	{
+		std::this_thread::sleep_until(*deadline - spinDuration);
+	}
+	while (std::chrono::steady_clock::now() < *deadline)
+	{
+		std::this_thread::yield();
+	}
+}
\ No newline at end of file
@@ -1,8 +1,13 @@
 #include "Framebuffer.h"
 
-Framebuffer::Framebuffer(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass, const vk::ImageView& vulkanSwapChainImageView, const vk::Extent2D& swapChainExtent) : vulkanLogicalDevice(vulkanLogicalDevice)
+Framebuffer::Framebuffer(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass, const vk::ImageView& vulkanSwapChainImageView, const vk::Extent2D& swapChainExtent)
+	: Framebuffer(vulkanLogicalDevice, vulkanRenderPass, std::vector<vk::ImageView>{ vulkanSwapChainImageView }, swapChainExtent)
 {
-	const vk::FramebufferCreateInfo framebufferCreateInfo{ buildFramebufferCreateInfo(vulkanRenderPass, vulkanSwapChainImageView, swapChainExtent) };
+}
+
+Framebuffer::Framebuffer(const vk::Device& vulkanLogicalDevice, const vk::RenderPass& vulkanRenderPass, const std::vector<vk::ImageView>& vulkanImageViews, const vk::Extent2D& extent) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	const vk::FramebufferCreateInfo framebufferCreateInfo{ buildFramebufferCreateInfo(vulkanRenderPass, vulkanImageViews, extent) };
 	vulkanFramebuffer = vulkanLogicalDevice.createFramebuffer(framebufferCreateInfo);
 }
 
@@ -11,14 +16,14 @@ Framebuffer::~Framebuffer()
 	vulkanLogicalDevice.destroyFramebuffer(vulkanFramebuffer);
 }
 
-const vk::FramebufferCreateInfo Framebuffer::buildFramebufferCreateInfo(const vk::RenderPass& vulkanRenderPass, const vk::ImageView& vulkanSwapChainImageView, const vk::Extent2D& swapChainExtent) const
+const vk::FramebufferCreateInfo Framebuffer::buildFramebufferCreateInfo(const vk::RenderPass& vulkanRenderPass, const std::vector<vk::ImageView>& vulkanImageViews, const vk::Extent2D& extent) const
 {
 	return vk::FramebufferCreateInfo{
 		.renderPass = vulkanRenderPass,
-		.attachmentCount = 1,
-		.pAttachments = &vulkanSwapChainImageView,
-		.width = swapChainExtent.width,
-		.height = swapChainExtent.height,
+		.attachmentCount = static_cast<uint32_t>(vulkanImageViews.size()),
+		.pAttachments = vulkanImageViews.data(),
+		.width = extent.width,
+		.height = extent.height,
 		.layers = 1
 	};
 }
@@ -0,0 +1,38 @@
+#include "Frustum.h"
+
+Frustum::Frustum(const glm::mat4& viewProjection)
+{
+	const glm::vec4 row0{ viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0] };
+	const glm::vec4 row1{ viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1] };
+	const glm::vec4 row2{ viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2] };
+	const glm::vec4 row3{ viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3] };
+	planes[0] = normalizePlane(row3 + row0);
+	planes[1] = normalizePlane(row3 - row0);
+	planes[2] = normalizePlane(row3 + row1);
+	planes[3] = normalizePlane(row3 - row1);
+	planes[4] = normalizePlane(row2);
+	planes[5] = normalizePlane(row3 - row2);
+}
+
+const glm::vec4 Frustum::normalizePlane(const glm::vec4& plane) const
+{
+	const float normalLength{ glm::length(glm::vec3(plane.x, plane.y, plane.z)) };
+	return plane / normalLength;
+}
+
+const bool Frustum::intersectsSphere(const glm::vec3& center, const float radius) const
+{
+	for (const auto& plane : planes)
+	{
+		if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+const std::array<glm::vec4, 6>& Frustum::getPlanes() const
+{
+	return planes;
+}
@@ -0,0 +1,83 @@
+#include "GeometryRenderPass.h"
+
+GeometryRenderPass::GeometryRenderPass(const vk::Device& vulkanLogicalDevice, const vk::Format normalsFormat, const vk::Format depthFormat) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	const std::array<vk::AttachmentDescription, 2> attachmentDescriptions{
+		createAttachmentDescription(normalsFormat, vk::ImageLayout::eColorAttachmentOptimal),
+		createAttachmentDescription(depthFormat, vk::ImageLayout::eDepthStencilAttachmentOptimal)
+	};
+	const vk::AttachmentReference normalsAttachmentReference{
+		.attachment = 0,
+		.layout = vk::ImageLayout::eColorAttachmentOptimal
+	};
+	const vk::AttachmentReference depthAttachmentReference{
+		.attachment = 1,
+		.layout = vk::ImageLayout::eDepthStencilAttachmentOptimal
+	};
+	const vk::SubpassDescription subpassDescription{
+		.pipelineBindPoint = vk::PipelineBindPoint::eGraphics,
+		.colorAttachmentCount = 1,
+		.pColorAttachments = &normalsAttachmentReference,
+		.pDepthStencilAttachment = &depthAttachmentReference
+	};
+	const vk::SubpassDependency subpassDependency{ createSubpassDependency() };
+	vulkanRenderPass = vulkanLogicalDevice.createRenderPass(vk::RenderPassCreateInfo{
+		.attachmentCount = static_cast<uint32_t>(attachmentDescriptions.size()),
+		.pAttachments = attachmentDescriptions.data(),
+		.subpassCount = 1,
+		.pSubpasses = &subpassDescription,
+		.dependencyCount = 1,
+		.pDependencies = &subpassDependency
+	});
+}
+
+GeometryRenderPass::~GeometryRenderPass()
+{
+	vulkanLogicalDevice.destroyRenderPass(vulkanRenderPass);
+}
+
+const vk::AttachmentDescription GeometryRenderPass::createAttachmentDescription(const vk::Format format, const vk::ImageLayout layout) const
+{
+	const bool isDepth{ layout == vk::ImageLayout::eDepthStencilAttachmentOptimal };
+	return vk::AttachmentDescription{
+		.format = format,
+		.samples = vk::SampleCountFlagBits::e1,
+		.loadOp = vk::AttachmentLoadOp::eClear,
+		.storeOp = isDepth ? vk::AttachmentStoreOp::eDontCare : vk::AttachmentStoreOp::eStore,
+		.stencilLoadOp = vk::AttachmentLoadOp::eDontCare,
+		.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
+		.initialLayout = layout,
+		.finalLayout = layout
+	};
+}
+
+const vk::SubpassDependency GeometryRenderPass::createSubpassDependency() const
+{
+	const vk::PipelineStageFlags attachmentStageMask{ vk::PipelineStageFlagBits::eColorAttachmentOutput | vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests };
+	return vk::SubpassDependency{
+		.srcSubpass = VK_SUBPASS_EXTERNAL,
+		.dstSubpass = 0,
+		.srcStageMask = attachmentStageMask,
+		.dstStageMask = attachmentStageMask,
+		.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite
+	};
+}
+
+const vk::RenderPassBeginInfo GeometryRenderPass::createRenderPassBeginInfo(const vk::Framebuffer& vulkanFramebuffer, const vk::Extent2D& extent) const
+{
+	return vk::RenderPassBeginInfo{
+		.renderPass = vulkanRenderPass,
+		.framebuffer = vulkanFramebuffer,
+		.renderArea = vk::Rect2D{
+			.offset = { 0, 0 },
+			.extent = extent
+		},
+		.clearValueCount = static_cast<uint32_t>(clearValues.size()),
+		.pClearValues = clearValues.data()
+	};
+}
+
+const vk::RenderPass GeometryRenderPass::getVulkanRenderPass() const
+{
+	return vulkanRenderPass;
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "GpuProfiler.h"
+
+GpuProfiler::GpuProfiler(const GpuProfilerCreateInfo& gpuProfilerCreateInfo) : vulkanLogicalDevice(gpuProfilerCreateInfo.vulkanLogicalDevice),
+	maximumPassCount(gpuProfilerCreateInfo.maximumPassCount), sampleCount(gpuProfilerCreateInfo.sampleCount), isPipelineStatisticsQueryEnabled(gpuProfilerCreateInfo.isPipelineStatisticsEnabled)
+{
+	const std::vector<vk::QueueFamilyProperties> queueFamilies{ gpuProfilerCreateInfo.vulkanPhysicalDevice.getQueueFamilyProperties() };
+	timestampPeriod = gpuProfilerCreateInfo.vulkanPhysicalDevice.getProperties().limits.timestampPeriod;
+	graphicsTimestampMask = buildTimestampMask(queueFamilies[gpuProfilerCreateInfo.graphicsFamilyIndex].timestampValidBits);
+	computeTimestampMask = gpuProfilerCreateInfo.computeFamilyIndex ? buildTimestampMask(queueFamilies[gpuProfilerCreateInfo.computeFamilyIndex.value()].timestampValidBits) : 0;
+	frameQueryPools.resize(gpuProfilerCreateInfo.frameCount);
+	for (auto& frameQueryPool : frameQueryPools)
+	{
+		frameQueryPool.timestampQueryPool = createQueryPool(vk::QueryType::eTimestamp, vk::QueryPipelineStatisticFlags{});
+		if (isPipelineStatisticsQueryEnabled)
+		{
+			frameQueryPool.graphicsStatisticsQueryPool = createQueryPool(vk::QueryType::ePipelineStatistics, graphicsPipelineStatistics);
+			frameQueryPool.computeStatisticsQueryPool = createQueryPool(vk::QueryType::ePipelineStatistics, vk::QueryPipelineStatisticFlagBits::eComputeShaderInvocations);
+		}
+		frameQueryPool.isPending = false;
+		frameQueryPool.beginCpuNanoseconds = 0;
+	}
+}
+
+GpuProfiler::~GpuProfiler()
+{
+	for (const auto& frameQueryPool : frameQueryPools)
+	{
+		vulkanLogicalDevice.destroyQueryPool(frameQueryPool.timestampQueryPool);
+		vulkanLogicalDevice.destroyQueryPool(frameQueryPool.graphicsStatisticsQueryPool);
+		vulkanLogicalDevice.destroyQueryPool(frameQueryPool.computeStatisticsQueryPool);
+	}
+}
+
+const uint64_t GpuProfiler::buildTimestampMask(const uint32_t timestampValidBits) const
+{
+	return timestampValidBits >= 64 ? ~0ull : (1ull << timestampValidBits) - 1;
+}
+
+const vk::QueryPool GpuProfiler::createQueryPool(const vk::QueryType queryType, const vk::QueryPipelineStatisticFlags pipelineStatistics) const
+{
+	const vk::QueryPoolCreateInfo queryPoolCreateInfo{
+		.queryType = queryType,
+		.queryCount = queryType == vk::QueryType::eTimestamp ? 2 * maximumPassCount : maximumPassCount,
+		.pipelineStatistics = pipelineStatistics
+	};
+	return vulkanLogicalDevice.createQueryPool(queryPoolCreateInfo);
+}
+
+const uint32_t GpuProfiler::addPass(const std::string& name, const RenderGraphQueue queue)
+{
+	if (profiledPasses.size() >= maximumPassCount)
+	{
+		throw std::runtime_error("Error in GpuProfiler! Too many profiled passes");
+	}
+	profiledPasses.push_back(ProfiledPass{
+		.name = name,
+		.queue = queue,
+		.isTimestampSupported = (queue == RenderGraphQueue::eCompute ? computeTimestampMask : graphicsTimestampMask) != 0,
+		.isRecorded = false
+	});
+	return static_cast<uint32_t>(profiledPasses.size() - 1);
+}
+
+void GpuProfiler::beginFrame(const uint32_t frameIndex)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(frameIndex, frameQueryPools.size(), "Error in GpuProfiler! Frame index is out of bounds");
+	readFrame(frameIndex);
+	frameQueryPools[frameIndex].isPending = true;
+#ifdef ENABLE_TRACING
+	frameQueryPools[frameIndex].beginCpuNanoseconds = Tracer::getInstance().getNanoseconds();
+#endif
+	currentFrameIndex = frameIndex;
+}
+
+void GpuProfiler::readAllFrames()
+{
+	for (uint32_t frameIndex = 0; frameIndex < frameQueryPools.size(); ++frameIndex)
+	{
+		readFrame(frameIndex);
+	}
+}
+
+void GpuProfiler::resetStatistics()
+{
+	for (auto& profiledPass : profiledPasses)
+	{
+		profiledPass.samples.clear();
+	}
+}
+
+void GpuProfiler::readFrame(const uint32_t frameIndex)
+{
+	FrameQueryPools& frameQueryPool{ frameQueryPools[frameIndex] };
+	if (!frameQueryPool.isPending)
+	{
+		return;
+	}
+	int64_t firstStartNanoseconds{ std::numeric_limits<int64_t>::max() };
+	for (uint32_t passIndex = 0; passIndex < profiledPasses.size(); ++passIndex)
+	{
+		Sample sample{};
+		int64_t startNanoseconds, endNanoseconds;
+		if (!readTimestamps(frameQueryPool, passIndex, startNanoseconds, endNanoseconds))
+		{
+			continue;
+		}
+		sample.milliseconds = (endNanoseconds - startNanoseconds) / 1000000.0;
+		firstStartNanoseconds = std::min(firstStartNanoseconds, startNanoseconds);
+#ifdef ENABLE_TRACING
+		Tracer::getInstance().addGpuZone(GpuTraceEvent{
+			.lane = getQueueName(profiledPasses[passIndex].queue),
+			.name = profiledPasses[passIndex].name,
+			.startNanoseconds = startNanoseconds,
+			.endNanoseconds = endNanoseconds
+		});
+#endif
+		readPipelineStatistics(frameQueryPool, passIndex, sample);
+		std::deque<Sample>& samples{ profiledPasses[passIndex].samples };
+		samples.push_back(sample);
+		if (samples.size() > sampleCount)
+		{
+			samples.pop_front();
+		}
+	}
+#ifdef ENABLE_TRACING
+	if (firstStartNanoseconds != std::numeric_limits<int64_t>::max())
+	{
+		Tracer::getInstance().calibrateGpuClock(frameQueryPool.beginCpuNanoseconds, firstStartNanoseconds);
+	}
+#endif
+	frameQueryPool.isPending = false;
+}
+
+const bool GpuProfiler::readTimestamps(const FrameQueryPools& frameQueryPool, const uint32_t passIndex, int64_t& startNanoseconds, int64_t& endNanoseconds) const
+{
+	if (!profiledPasses[passIndex].isTimestampSupported || !profiledPasses[passIndex].isRecorded)
+	{
+		return false;
+	}
+	std::array<uint64_t, 4> timestamps{};
+	const vk::Result result{ vulkanLogicalDevice.getQueryPoolResults(frameQueryPool.timestampQueryPool, 2 * passIndex, 2, sizeof(timestamps), timestamps.data(), 2 * sizeof(uint64_t),
+		vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability) };
+	if (result != vk::Result::eSuccess || timestamps[1] == 0 || timestamps[3] == 0)
+	{
+		return false;
+	}
+	const uint64_t timestampMask{ profiledPasses[passIndex].queue == RenderGraphQueue::eCompute ? computeTimestampMask : graphicsTimestampMask };
+	startNanoseconds = static_cast<int64_t>(static_cast<double>(timestamps[0] & timestampMask) * timestampPeriod);
+	endNanoseconds = startNanoseconds + static_cast<int64_t>(static_cast<double>((timestamps[2] - timestamps[0]) & timestampMask) * timestampPeriod);
+	return true;
+}
+
+void GpuProfiler::readPipelineStatistics(const FrameQueryPools& frameQueryPool, const uint32_t passIndex, Sample& sample) const
+{
+	if (!isPipelineStatisticsQueryEnabled)
+	{
+		return;
+	}
+	std::array<uint64_t, 3> pipelineStatistics{};
+	if (profiledPasses[passIndex].queue == RenderGraphQueue::eCompute)
+	{
+		const vk::Result result{ vulkanLogicalDevice.getQueryPoolResults(frameQueryPool.computeStatisticsQueryPool, passIndex, 1, 2 * sizeof(uint64_t), pipelineStatistics.data(), 2 * sizeof(uint64_t),
+			vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability) };
+		if (result == vk::Result::eSuccess && pipelineStatistics[1] != 0)
+		{
+			sample.computeShaderInvocations = pipelineStatistics[0];
+		}
+		return;
+	}
+	const vk::Result result{ vulkanLogicalDevice.getQueryPoolResults(frameQueryPool.graphicsStatisticsQueryPool, passIndex, 1, sizeof(pipelineStatistics), pipelineStatistics.data(), sizeof(pipelineStatistics),
+		vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability) };
+	if (result == vk::Result::eSuccess && pipelineStatistics[2] != 0)
+	{
+		sample.fragmentShaderInvocations = pipelineStatistics[0];
+		sample.computeShaderInvocations = pipelineStatistics[1];
+	}
+}
+
+void GpuProfiler::beginPass(const vk::CommandBuffer& vulkanCommandBuffer, const uint32_t passIndex)
+{
+	profiledPasses[passIndex].isRecorded = true;
+	const FrameQueryPools& frameQueryPool{ frameQueryPools[currentFrameIndex] };
+	if (profiledPasses[passIndex].isTimestampSupported)
+	{
+		vulkanCommandBuffer.resetQueryPool(frameQueryPool.timestampQueryPool, 2 * passIndex, 2);
+		vulkanCommandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, frameQueryPool.timestampQueryPool, 2 * passIndex);
+	}
+	if (isPipelineStatisticsQueryEnabled)
+	{
+		const vk::QueryPool statisticsQueryPool{ getStatisticsQueryPool(frameQueryPool, profiledPasses[passIndex].queue) };
+		vulkanCommandBuffer.resetQueryPool(statisticsQueryPool, passIndex, 1);
+		vulkanCommandBuffer.beginQuery(statisticsQueryPool, passIndex, vk::QueryControlFlags{});
+	}
+}
+
+void GpuProfiler::endPass(const vk::CommandBuffer& vulkanCommandBuffer, const uint32_t passIndex) const
+{
+	const FrameQueryPools& frameQueryPool{ frameQueryPools[currentFrameIndex] };
+	if (isPipelineStatisticsQueryEnabled)
+	{
+		vulkanCommandBuffer.endQuery(getStatisticsQueryPool(frameQueryPool, profiledPasses[passIndex].queue), passIndex);
+	}
+	if (profiledPasses[passIndex].isTimestampSupported)
+	{
+		vulkanCommandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, frameQueryPool.timestampQueryPool, 2 * passIndex + 1);
+	}
+}
+
+const vk::QueryPool GpuProfiler::getStatisticsQueryPool(const FrameQueryPools& frameQueryPool, const RenderGraphQueue queue) const
+{
+	return queue == RenderGraphQueue::eCompute ? frameQueryPool.computeStatisticsQueryPool : frameQueryPool.graphicsStatisticsQueryPool;
+}
+
+const std::vector<GpuPassStatistics> GpuProfiler::getStatistics() const
+{
+	std::vector<GpuPassStatistics> statistics;
+	for (const auto& profiledPass : profiledPasses)
+	{
+		statistics.push_back(buildStatistics(profiledPass));
+	}
+	return statistics;
+}
+
+const GpuPassStatistics GpuProfiler::buildStatistics(const ProfiledPass& profiledPass) const
+{
+	GpuPassStatistics gpuPassStatistics{
+		.name = profiledPass.name,
+		.queue = profiledPass.queue,
+		.sampleCount = profiledPass.samples.size()
+	};
+	if (profiledPass.samples.empty())
+	{
+		return gpuPassStatistics;
+	}
+	std::vector<double> milliseconds;
+	for (const auto& sample : profiledPass.samples)
+	{
+		milliseconds.push_back(sample.milliseconds);
+		gpuPassStatistics.averageMilliseconds += sample.milliseconds;
+		gpuPassStatistics.averageFragmentShaderInvocations += static_cast<double>(sample.fragmentShaderInvocations);
+		gpuPassStatistics.averageComputeShaderInvocations += static_cast<double>(sample.computeShaderInvocations);
+	}
+	milliseconds = Percentile::sort(milliseconds);
+	const double measuredSampleCount{ static_cast<double>(milliseconds.size()) };
+	gpuPassStatistics.minimumMilliseconds = milliseconds.front();
+	gpuPassStatistics.maximumMilliseconds = milliseconds.back();
+	gpuPassStatistics.percentile50Milliseconds = Percentile::compute(milliseconds, 50.0);
+	gpuPassStatistics.percentile95Milliseconds = Percentile::compute(milliseconds, 95.0);
+	gpuPassStatistics.percentile99Milliseconds = Percentile::compute(milliseconds, 99.0);
+	gpuPassStatistics.averageMilliseconds /= measuredSampleCount;
+	gpuPassStatistics.averageFragmentShaderInvocations /= measuredSampleCount;
+	gpuPassStatistics.averageComputeShaderInvocations /= measuredSampleCount;
+	return gpuPassStatistics;
+}
+
+void GpuProfiler::writeCsv(const std::filesystem::path& filePath) const
+{
+	std::ofstream file(filePath, std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in GpuProfiler! " + filePath.string() + " could not be written");
+	}
+	file << "pass,queue,samples,min_ms,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,fragment_invocations,compute_invocations" << std::endl;
+	for (const auto& gpuPassStatistics : getStatistics())
+	{
+		file << gpuPassStatistics.name << "," << getQueueName(gpuPassStatistics.queue) << "," << gpuPassStatistics.sampleCount << "," << gpuPassStatistics.minimumMilliseconds << ","
+			<< gpuPassStatistics.averageMilliseconds << "," << gpuPassStatistics.percentile50Milliseconds << "," << gpuPassStatistics.percentile95Milliseconds << ","
+			<< gpuPassStatistics.percentile99Milliseconds << "," << gpuPassStatistics.maximumMilliseconds << ","
+			<< gpuPassStatistics.averageFragmentShaderInvocations << "," << gpuPassStatistics.averageComputeShaderInvocations << std::endl;
+	}
+}
+
+void GpuProfiler::writeJson(const std::filesystem::path& filePath) const
+{
+	std::ofstream file(filePath, std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in GpuProfiler! " + filePath.string() + " could not be written");
+	}
+	const std::vector<GpuPassStatistics> statistics{ getStatistics() };
+	file << "{" << std::endl << "\t\"passes\": [" << std::endl;
+	for (size_t passIndex = 0; passIndex < statistics.size(); ++passIndex)
+	{
+		const GpuPassStatistics& gpuPassStatistics{ statistics[passIndex] };
+		file << "\t\t{ \"name\": \"" << gpuPassStatistics.name << "\", \"queue\": \"" << getQueueName(gpuPassStatistics.queue) << "\", \"samples\": " << gpuPassStatistics.sampleCount
+			<< ", \"minMilliseconds\": " << gpuPassStatistics.minimumMilliseconds << ", \"averageMilliseconds\": " << gpuPassStatistics.averageMilliseconds
+			<< ", \"p50Milliseconds\": " << gpuPassStatistics.percentile50Milliseconds << ", \"p95Milliseconds\": " << gpuPassStatistics.percentile95Milliseconds
+			<< ", \"p99Milliseconds\": " << gpuPassStatistics.percentile99Milliseconds << ", \"maxMilliseconds\": " << gpuPassStatistics.maximumMilliseconds
+			<< ", \"fragmentShaderInvocations\": " << gpuPassStatistics.averageFragmentShaderInvocations << ", \"computeShaderInvocations\": " << gpuPassStatistics.averageComputeShaderInvocations << " }"
+			<< (passIndex + 1 < statistics.size() ? "," : "") << std::endl;
+	}
+	file << "\t]" << std::endl << "}" << std::endl;
+}
+
+const std::string GpuProfiler::getQueueName(const RenderGraphQueue queue) const
+{
+	return queue == RenderGraphQueue::eCompute ? "compute" : "graphics";
+}
+
+const bool GpuProfiler::isPipelineStatisticsEnabled() const
+{
+	return isPipelineStatisticsQueryEnabled;
+}
+
+const vk::QueryPipelineStatisticFlags GpuProfiler::getGraphicsPipelineStatistics() const
+{
+	return isPipelineStatisticsQueryEnabled ? graphicsPipelineStatistics : vk::QueryPipelineStatisticFlags{};
+}
\ No newline at end of file
@@ -26,7 +26,7 @@ const vk::ApplicationInfo GraphicsInstance::createApplicationInfo(const std::str
 		.applicationVersion = 1,
 		.pEngineName = "No Engine",
 		.engineVersion = 1,
-		.apiVersion = VK_API_VERSION_1_0
+		.apiVersion = VK_API_VERSION_1_2
 	};
 }
 
@@ -55,27 +55,28 @@ void GraphicsInstance::selectPhysicalDevice()
 	physicalDevice.pick(vulkanPhysicalDevices, windowSurface->getVulkanWindowSurface());
 }
 
-void GraphicsInstance::createLogicalDevice(const WindowSize& framebufferSize, const std::vector<Vertex>& vertices, const std::vector<uint16_t>& indices)
+void GraphicsInstance::createLogicalDevice(const WindowSize& framebufferSize, const Mesh& mesh, const RenderSettings& renderSettings)
 {
 	const LogicalDevicePartialCreateInfo logicalDevicePartialCreateInfo{
 		.vulkanWindowSurface = windowSurface->getVulkanWindowSurface(),
 		.framebufferSize = framebufferSize,
 		.enabledLayerCount = validationLayer.getEnabledLayerCount(),
 		.enabledLayerNames = validationLayer.getEnabledLayerNames(),
-		.vertices = vertices,
-		.indices = indices
+		.mesh = mesh,
+		.renderSettings = renderSettings
 	};
 	logicalDevice = physicalDevice.createLogicalDevice(logicalDevicePartialCreateInfo);
 }
 
-void GraphicsInstance::createGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders)
+void GraphicsInstance::createPipelines(const PipelineShaders& pipelineShaders)
 {
-	logicalDevice->createGraphicsPipeline(shaders);
+	logicalDevice->createPipelines(pipelineShaders);
 }
 
-void GraphicsInstance::drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
+void GraphicsInstance::drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const std::chrono::steady_clock::time_point inputTime)
 {
-	logicalDevice->drawFrame(getFramebufferSize, waitEvents);
+	TRACE_ZONE("GraphicsInstance::drawFrame");
+	logicalDevice->drawFrame(getFramebufferSize, waitEvents, inputTime);
 }
 
 void GraphicsInstance::waitIdle()
@@ -83,7 +84,97 @@ void GraphicsInstance::waitIdle()
 	logicalDevice->waitIdle();
 }
 
+void GraphicsInstance::setAmbientOcclusionQuality(const uint32_t qualityLevel)
+{
+	logicalDevice->setAmbientOcclusionQuality(qualityLevel);
+}
+
+void GraphicsInstance::setCameraPose(const glm::vec3& position, const glm::vec3& target)
+{
+	logicalDevice->setCameraPose(position, target);
+}
+
+void GraphicsInstance::resetGpuProfile()
+{
+	logicalDevice->resetGpuProfile();
+}
+
+void GraphicsInstance::requestFrameCapture()
+{
+	logicalDevice->requestFrameCapture();
+}
+
+const std::optional<LuminanceImage> GraphicsInstance::readFrameCapture()
+{
+	return logicalDevice->readFrameCapture();
+}
+
 const vk::Device GraphicsInstance::getVulkanLogicalDevice() const
 {
 	return logicalDevice->getVulkanLogicalDevice();
+}
+
+const MemoryStatistics GraphicsInstance::getMemoryStatistics() const
+{
+	return logicalDevice->getMemoryStatistics();
+}
+
+const UploadStatistics GraphicsInstance::getUploadStatistics() const
+{
+	return logicalDevice->getUploadStatistics();
+}
+
+const TransientMemoryStatistics GraphicsInstance::getTransientMemoryStatistics() const
+{
+	return logicalDevice->getTransientMemoryStatistics();
+}
+
+const std::string GraphicsInstance::getRenderGraphSchedule() const
+{
+	return logicalDevice->getRenderGraphSchedule();
+}
+
+const CommandRecordingStatistics GraphicsInstance::getCommandRecordingStatistics() const
+{
+	return logicalDevice->getCommandRecordingStatistics();
+}
+
+const CommandBufferCacheStatistics GraphicsInstance::getCommandBufferCacheStatistics() const
+{
+	return logicalDevice->getCommandBufferCacheStatistics();
+}
+
+const PipelineCacheStatistics GraphicsInstance::getPipelineCacheStatistics() const
+{
+	return logicalDevice->getPipelineCacheStatistics();
+}
+
+const FrameLatencyStatistics GraphicsInstance::getFrameLatencyStatistics() const
+{
+	return logicalDevice->getFrameLatencyStatistics();
+}
+
+const std::vector<GpuPassStatistics> GraphicsInstance::getGpuPassStatistics() const
+{
+	return logicalDevice->getGpuPassStatistics();
+}
+
+void GraphicsInstance::writeGpuProfile(const std::filesystem::path& csvFilePath, const std::filesystem::path& jsonFilePath) const
+{
+	logicalDevice->writeGpuProfile(csvFilePath, jsonFilePath);
+}
+
+const vk::PresentModeKHR GraphicsInstance::getPresentMode() const
+{
+	return logicalDevice->getPresentMode();
+}
+
+const uint32_t GraphicsInstance::getAmbientOcclusionQualityLevelCount() const
+{
+	return logicalDevice->getAmbientOcclusionQualityLevelCount();
+}
+
+const std::optional<uint32_t> GraphicsInstance::findAmbientOcclusionQualityLevel(const uint32_t sampleCount) const
+{
+	return logicalDevice->findAmbientOcclusionQualityLevel(sampleCount);
 }
\ No newline at end of file
@@ -3,18 +3,18 @@
 GraphicsPipeline::GraphicsPipeline(const GraphicsPipelineCreateInfo& graphicsPipelineCreateInfo) : vulkanLogicalDevice(graphicsPipelineCreateInfo.vulkanLogicalDevice)
 {
 	const vk::VertexInputBindingDescription vertexBindingDescription{ Vertex::getBindingDescription() };
-	const std::array<vk::VertexInputAttributeDescription, 2> vertexAttributeDescriptions{ Vertex::getAttributeDescriptions() };
+	const std::array<vk::VertexInputAttributeDescription, 3> vertexAttributeDescriptions{ Vertex::getAttributeDescriptions() };
 	const vk::PipelineVertexInputStateCreateInfo vertexInputState{ buildPipelineVertexInputStateCreateInfo(vertexBindingDescription, vertexAttributeDescriptions) };
 	const vk::PipelineInputAssemblyStateCreateInfo inputAssemblyState{ buildPipelineInputAssemblyStateCreateInfo() };
-	const vk::Viewport viewport{ buildViewport(graphicsPipelineCreateInfo.swapChainExtent) };
-	const vk::Rect2D scissor{ buildScissor(graphicsPipelineCreateInfo.swapChainExtent) };
-	const vk::PipelineViewportStateCreateInfo viewportState{ buildPipelineViewportStateCreateInfo(viewport, scissor) };
+	const vk::PipelineViewportStateCreateInfo viewportState{ buildPipelineViewportStateCreateInfo() };
 	const vk::PipelineRasterizationStateCreateInfo rasterizationState{ buildPipelineRasterizationStateCreateInfo() };
 	const vk::PipelineMultisampleStateCreateInfo multisampleState{ buildPipelineMultisampleStateCreateInfo() };
+	const vk::PipelineDepthStencilStateCreateInfo depthStencilState{ buildPipelineDepthStencilStateCreateInfo() };
 	const vk::PipelineColorBlendAttachmentState colorBlendAttachmentState{ buildPipelineColorBlendAttachmentState() };
 	const vk::PipelineColorBlendStateCreateInfo  colorBlendState{ buildPipelineColorBlendStateCreateInfo(colorBlendAttachmentState) };
-	const vk::PipelineDynamicStateCreateInfo  dynamicState{ buildPipelineDynamicStateCreateInfo() };
-	const vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo{ buildPipelineLayoutCreateInfo() };
+	const std::vector<vk::DynamicState> dynamicStates{ vk::DynamicState::eViewport, vk::DynamicState::eScissor };
+	const vk::PipelineDynamicStateCreateInfo dynamicState{ buildPipelineDynamicStateCreateInfo(dynamicStates) };
+	const vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo{ buildPipelineLayoutCreateInfo(graphicsPipelineCreateInfo.descriptorSetLayouts, graphicsPipelineCreateInfo.pushConstantRanges) };
 	pipelineLayout = vulkanLogicalDevice.createPipelineLayout(pipelineLayoutCreateInfo);
 	const vk::GraphicsPipelineCreateInfo vulkanGraphicsPipelineCreateInfo{
 		.stageCount = 2,
@@ -24,14 +24,16 @@ GraphicsPipeline::GraphicsPipeline(const GraphicsPipelineCreateInfo& graphicsPip
 		.pViewportState = &viewportState,
 		.pRasterizationState = &rasterizationState,
 		.pMultisampleState = &multisampleState,
+		.pDepthStencilState = graphicsPipelineCreateInfo.isDepthTestEnabled ? &depthStencilState : nullptr,
 		.pColorBlendState = &colorBlendState,
+		.pDynamicState = &dynamicState,
 		.layout = pipelineLayout,
 		.renderPass = graphicsPipelineCreateInfo.vulkanRenderPass,
 		.subpass = 0,
 		.basePipelineHandle = nullptr,
 		.basePipelineIndex = -1
 	};
-	const vk::ResultValue<vk::Pipeline> graphicsPipeline = vulkanLogicalDevice.createGraphicsPipeline({}, vulkanGraphicsPipelineCreateInfo);
+	const vk::ResultValue<vk::Pipeline> graphicsPipeline = vulkanLogicalDevice.createGraphicsPipeline(graphicsPipelineCreateInfo.vulkanPipelineCache, vulkanGraphicsPipelineCreateInfo);
 	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(graphicsPipeline.result, "Unable to create the graphics pipeline!");
 	pipeline = graphicsPipeline.value;
 }
@@ -42,7 +44,7 @@ GraphicsPipeline::~GraphicsPipeline()
 	vulkanLogicalDevice.destroyPipelineLayout(pipelineLayout);
 }
 
-const vk::PipelineVertexInputStateCreateInfo GraphicsPipeline::buildPipelineVertexInputStateCreateInfo(const vk::VertexInputBindingDescription& vertexBindingDescription, const std::array<vk::VertexInputAttributeDescription, 2>& vertexAttributeDescriptions) const
+const vk::PipelineVertexInputStateCreateInfo GraphicsPipeline::buildPipelineVertexInputStateCreateInfo(const vk::VertexInputBindingDescription& vertexBindingDescription, const std::array<vk::VertexInputAttributeDescription, 3>& vertexAttributeDescriptions) const
 {	
 	return vk::PipelineVertexInputStateCreateInfo{
 		.vertexBindingDescriptionCount = 1,
@@ -60,33 +62,13 @@ const vk::PipelineInputAssemblyStateCreateInfo GraphicsPipeline::buildPipelineIn
 	};
 }
 
-const vk::Viewport GraphicsPipeline::buildViewport(const vk::Extent2D& swapChainExtent) const
-{
-	return vk::Viewport{
-		.x = 0.0f,
-		.y = 0.0f,
-		.width = static_cast<float>(swapChainExtent.width),
-		.height = static_cast<float>(swapChainExtent.height),
-		.minDepth = 0.0f,
-		.maxDepth = 1.0f
-	};
-}
-
-const vk::Rect2D GraphicsPipeline::buildScissor(const vk::Extent2D& swapChainExtent) const
-{
-	return vk::Rect2D{
-		.offset = {0, 0},
-		.extent = swapChainExtent
-	};
-}
-
-const vk::PipelineViewportStateCreateInfo GraphicsPipeline::buildPipelineViewportStateCreateInfo(const vk::Viewport& viewport, const vk::Rect2D& scissor) const
+const vk::PipelineViewportStateCreateInfo GraphicsPipeline::buildPipelineViewportStateCreateInfo() const
 {
 	return vk::PipelineViewportStateCreateInfo{
 		.viewportCount = 1,
-		.pViewports = &viewport,
+		.pViewports = nullptr,
 		.scissorCount = 1,
-		.pScissors = &scissor
+		.pScissors = nullptr
 	};
 }
 
@@ -118,6 +100,19 @@ const vk::PipelineMultisampleStateCreateInfo GraphicsPipeline::buildPipelineMult
 	};
 }
 
+const vk::PipelineDepthStencilStateCreateInfo GraphicsPipeline::buildPipelineDepthStencilStateCreateInfo() const
+{
+	return vk::PipelineDepthStencilStateCreateInfo{
+		.depthTestEnable = vk::Bool32(1),
+		.depthWriteEnable = vk::Bool32(1),
+		.depthCompareOp = vk::CompareOp::eLess,
+		.depthBoundsTestEnable = vk::Bool32(0),
+		.stencilTestEnable = vk::Bool32(0),
+		.minDepthBounds = 0.0f,
+		.maxDepthBounds = 1.0f
+	};
+}
+
 const vk::PipelineColorBlendAttachmentState GraphicsPipeline::buildPipelineColorBlendAttachmentState() const
 {
 	return vk::PipelineColorBlendAttachmentState{
@@ -145,22 +140,21 @@ const vk::PipelineColorBlendStateCreateInfo GraphicsPipeline::buildPipelineColor
 	};
 }
 
-const vk::PipelineDynamicStateCreateInfo GraphicsPipeline::buildPipelineDynamicStateCreateInfo() const
+const vk::PipelineDynamicStateCreateInfo GraphicsPipeline::buildPipelineDynamicStateCreateInfo(const std::vector<vk::DynamicState>& dynamicStates) const
 {
-	const std::vector<vk::DynamicState> dynamicStates = { vk::DynamicState::eViewport, vk::DynamicState::eLineWidth };
 	return vk::PipelineDynamicStateCreateInfo{
 		.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size()),
 		.pDynamicStates = dynamicStates.data()
 	};
 }
 
-const vk::PipelineLayoutCreateInfo GraphicsPipeline::buildPipelineLayoutCreateInfo() const
+const vk::PipelineLayoutCreateInfo GraphicsPipeline::buildPipelineLayoutCreateInfo(const std::vector<vk::DescriptorSetLayout>& descriptorSetLayouts, const std::vector<vk::PushConstantRange>& pushConstantRanges) const
 {
 	return vk::PipelineLayoutCreateInfo{
-		.setLayoutCount = 0,
-		.pSetLayouts = nullptr,
-		.pushConstantRangeCount = 0,
-		.pPushConstantRanges = nullptr
+		.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size()),
+		.pSetLayouts = descriptorSetLayouts.data(),
+		.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size()),
+		.pPushConstantRanges = pushConstantRanges.data()
 	};
 }
 
@@ -169,3 +163,8 @@ const vk::Pipeline GraphicsPipeline::getVulkanPipeline() const
 	return pipeline;
 }
 
+const vk::PipelineLayout GraphicsPipeline::getVulkanPipelineLayout() const
+{
+	return pipelineLayout;
+}
+
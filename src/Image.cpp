@@ -0,0 +1,87 @@
+#include "Image.h"
+
+Image::Image(const ImageCreateInfo& imageCreateInfo) : vulkanLogicalDevice(imageCreateInfo.vulkanLogicalDevice), format(imageCreateInfo.format), extent(imageCreateInfo.extent),
+	aspectMask(imageCreateInfo.aspectMask), mipLevels(imageCreateInfo.mipLevels), transient(imageCreateInfo.isTransient)
+{
+	const vk::ImageUsageFlags attachmentUsage{ vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eDepthStencilAttachment | vk::ImageUsageFlagBits::eInputAttachment };
+	if (transient && (imageCreateInfo.usage & ~attachmentUsage))
+	{
+		throw std::runtime_error("Error in Image! Transient images can only be used as attachments");
+	}
+	vulkanImage = vulkanLogicalDevice.createImage(buildImageCreateInfo(imageCreateInfo));
+}
+
+Image::~Image()
+{
+	imageView.reset();
+	vulkanLogicalDevice.destroyImage(vulkanImage);
+}
+
+const vk::ImageCreateInfo Image::buildImageCreateInfo(const ImageCreateInfo& imageCreateInfo) const
+{
+	return vk::ImageCreateInfo{
+		.imageType = vk::ImageType::e2D,
+		.format = imageCreateInfo.format,
+		.extent = vk::Extent3D{
+			.width = imageCreateInfo.extent.width,
+			.height = imageCreateInfo.extent.height,
+			.depth = 1
+		},
+		.mipLevels = imageCreateInfo.mipLevels,
+		.arrayLayers = 1,
+		.samples = vk::SampleCountFlagBits::e1,
+		.tiling = vk::ImageTiling::eOptimal,
+		.usage = transient ? imageCreateInfo.usage | vk::ImageUsageFlagBits::eTransientAttachment : imageCreateInfo.usage,
+		.sharingMode = vk::SharingMode::eExclusive,
+		.initialLayout = vk::ImageLayout::eUndefined
+	};
+}
+
+void Image::bindMemory(const vk::DeviceMemory& vulkanDeviceMemory, const vk::DeviceSize offset)
+{
+	if (imageView)
+	{
+		throw std::runtime_error("Error in Image! Image memory has already been bound");
+	}
+	vulkanLogicalDevice.bindImageMemory(vulkanImage, vulkanDeviceMemory, offset);
+	imageView = std::make_unique<ImageView>(vulkanLogicalDevice, vulkanImage, format, aspectMask, mipLevels);
+}
+
+const vk::MemoryRequirements Image::getMemoryRequirements() const
+{
+	return vulkanLogicalDevice.getImageMemoryRequirements(vulkanImage);
+}
+
+const vk::Image Image::getVulkanImage() const
+{
+	return vulkanImage;
+}
+
+const vk::ImageView Image::getVulkanImageView() const
+{
+	if (!imageView)
+	{
+		throw std::runtime_error("Error in Image! Image memory has not been bound");
+	}
+	return imageView->getVulkanImageView();
+}
+
+const vk::Format Image::getFormat() const
+{
+	return format;
+}
+
+const vk::Extent2D Image::getExtent() const
+{
+	return extent;
+}
+
+const uint32_t Image::getMipLevels() const
+{
+	return mipLevels;
+}
+
+const bool Image::isTransient() const
+{
+	return transient;
+}
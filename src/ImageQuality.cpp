@@ -0,0 +1,249 @@
+#include "ImageQuality.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_QUALITY_USE_SSE2
+#endif
+
+const ImageQualityMetrics ImageQuality::compare(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool)
+{
+	const double meanSquaredError{ computeMeanSquaredError(referenceImage, image, threadPool) };
+	return ImageQualityMetrics{
+		.meanSquaredError = meanSquaredError,
+		.peakSignalToNoiseRatio = computePeakSignalToNoiseRatio(meanSquaredError),
+		.structuralSimilarity = computeStructuralSimilarity(referenceImage, image, threadPool)
+	};
+}
+
+const double ImageQuality::computeMeanSquaredError(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool)
+{
+	throwExceptionIfSizesDiffer(referenceImage, image);
+	std::vector<double> rowSquaredErrors(referenceImage.height, 0.0);
+	threadPool.parallelFor(referenceImage.height, rowChunkSize, [&](const size_t, const size_t begin, const size_t end)
+	{
+		for (size_t row = begin; row < end; ++row)
+		{
+			const size_t rowOffset{ row * referenceImage.width };
+			rowSquaredErrors[row] = accumulateSquaredError(&referenceImage.pixels[rowOffset], &image.pixels[rowOffset], referenceImage.width);
+		}
+	});
+	return std::accumulate(rowSquaredErrors.begin(), rowSquaredErrors.end(), 0.0) / static_cast<double>(referenceImage.pixels.size());
+}
+
+const double ImageQuality::computePeakSignalToNoiseRatio(const double meanSquaredError)
+{
+	if (meanSquaredError <= 0.0)
+	{
+		return maximumPeakSignalToNoiseRatio;
+	}
+	return std::min(-10.0 * std::log10(meanSquaredError), maximumPeakSignalToNoiseRatio);
+}
+
+const double ImageQuality::computeStructuralSimilarity(const LuminanceImage& referenceImage, const LuminanceImage& image, ThreadPool& threadPool)
+{
+	throwExceptionIfSizesDiffer(referenceImage, image);
+	const uint32_t blockCountX{ referenceImage.width / blockSize };
+	const uint32_t blockCountY{ referenceImage.height / blockSize };
+	if (blockCountX < 2 || blockCountY < 2)
+	{
+		throw std::runtime_error("Error in ImageQuality! Images must be at least " + std::to_string(2 * blockSize) + " pixels wide and high to compute SSIM");
+	}
+	const size_t blockCount{ static_cast<size_t>(blockCountX) * blockCountY };
+	BlockSums blockSums{
+		.countX = blockCountX,
+		.countY = blockCountY,
+		.reference = std::vector<float>(blockCount),
+		.image = std::vector<float>(blockCount),
+		.referenceSquared = std::vector<float>(blockCount),
+		.imageSquared = std::vector<float>(blockCount),
+		.product = std::vector<float>(blockCount)
+	};
+	threadPool.parallelFor(blockSums.countY, rowChunkSize, [&](const size_t, const size_t begin, const size_t end)
+	{
+		for (size_t blockRow = begin; blockRow < end; ++blockRow)
+		{
+			sumBlockRow(referenceImage, image, static_cast<uint32_t>(blockRow), blockSums);
+		}
+	});
+	std::vector<double> windowRowSimilarities(blockSums.countY - 1, 0.0);
+	threadPool.parallelFor(windowRowSimilarities.size(), rowChunkSize, [&](const size_t, const size_t begin, const size_t end)
+	{
+		for (size_t blockRow = begin; blockRow < end; ++blockRow)
+		{
+			windowRowSimilarities[blockRow] = accumulateWindowRowSimilarity(blockSums, static_cast<uint32_t>(blockRow));
+		}
+	});
+	const double windowCount{ static_cast<double>(blockSums.countX - 1) * (blockSums.countY - 1) };
+	return std::accumulate(windowRowSimilarities.begin(), windowRowSimilarities.end(), 0.0) / windowCount;
+}
+
+void ImageQuality::throwExceptionIfSizesDiffer(const LuminanceImage& referenceImage, const LuminanceImage& image)
+{
+	if (referenceImage.width != image.width || referenceImage.height != image.height)
+	{
+		throw std::runtime_error("Error in ImageQuality! The reference image is " + std::to_string(referenceImage.width) + "x" + std::to_string(referenceImage.height)
+			+ " but the compared image is " + std::to_string(image.width) + "x" + std::to_string(image.height));
+	}
+}
+
+const float ImageQuality::accumulateSquaredError(const float* referencePixels, const float* pixels, const size_t pixelCount)
+{
+	float squaredError{ 0.0f };
+	for (size_t pixelIndex = accumulateSquaredErrorSIMD(referencePixels, pixels, pixelCount, squaredError); pixelIndex < pixelCount; ++pixelIndex)
+	{
+		const float difference{ referencePixels[pixelIndex] - pixels[pixelIndex] };
+		squaredError += difference * difference;
+	}
+	return squaredError;
+}
+
+const size_t ImageQuality::accumulateSquaredErrorSIMD(const float* referencePixels, const float* pixels, const size_t pixelCount, float& squaredError)
+{
+#ifdef IMAGE_QUALITY_USE_SSE2
+	__m128 squaredErrors{ _mm_setzero_ps() };
+	size_t pixelIndex{ 0 };
+	for (; pixelIndex + 4 <= pixelCount; pixelIndex += 4)
+	{
+		const __m128 difference{ _mm_sub_ps(_mm_loadu_ps(referencePixels + pixelIndex), _mm_loadu_ps(pixels + pixelIndex)) };
+		squaredErrors = _mm_add_ps(squaredErrors, _mm_mul_ps(difference, difference));
+	}
+	alignas(16) float lanes[4];
+	_mm_store_ps(lanes, squaredErrors);
+	squaredError += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	return pixelIndex;
+#else
+	return 0;
+#endif
+}
+
+void ImageQuality::sumBlockRow(const LuminanceImage& referenceImage, const LuminanceImage& image, const uint32_t blockRow, BlockSums& blockSums)
+{
+	for (uint32_t blockX = sumBlockRowSIMD(referenceImage, image, blockRow, blockSums); blockX < blockSums.countX; ++blockX)
+	{
+		const size_t blockIndex{ static_cast<size_t>(blockRow) * blockSums.countX + blockX };
+		float sumReference{ 0.0f }, sumImage{ 0.0f }, sumReferenceSquared{ 0.0f }, sumImageSquared{ 0.0f }, sumProduct{ 0.0f };
+		for (uint32_t row = 0; row < blockSize; ++row)
+		{
+			const size_t rowOffset{ (static_cast<size_t>(blockRow) * blockSize + row) * referenceImage.width + static_cast<size_t>(blockX) * blockSize };
+			for (uint32_t column = 0; column < blockSize; ++column)
+			{
+				const float referencePixel{ referenceImage.pixels[rowOffset + column] };
+				const float pixel{ image.pixels[rowOffset + column] };
+				sumReference += referencePixel;
+				sumImage += pixel;
+				sumReferenceSquared += referencePixel * referencePixel;
+				sumImageSquared += pixel * pixel;
+				sumProduct += referencePixel * pixel;
+			}
+		}
+		blockSums.reference[blockIndex] = sumReference;
+		blockSums.image[blockIndex] = sumImage;
+		blockSums.referenceSquared[blockIndex] = sumReferenceSquared;
+		blockSums.imageSquared[blockIndex] = sumImageSquared;
+		blockSums.product[blockIndex] = sumProduct;
+	}
+}
+
+const uint32_t ImageQuality::sumBlockRowSIMD(const LuminanceImage& referenceImage, const LuminanceImage& image, const uint32_t blockRow, BlockSums& blockSums)
+{
+#ifdef IMAGE_QUALITY_USE_SSE2
+	static_assert(blockSize == 4, "The SSE2 block sums load one block row per register");
+	for (uint32_t blockX = 0; blockX < blockSums.countX; ++blockX)
+	{
+		__m128 sumReference{ _mm_setzero_ps() }, sumImage{ _mm_setzero_ps() }, sumReferenceSquared{ _mm_setzero_ps() }, sumImageSquared{ _mm_setzero_ps() }, sumProduct{ _mm_setzero_ps() };
+		for (uint32_t row = 0; row < blockSize; ++row)
+		{
+			const size_t rowOffset{ (static_cast<size_t>(blockRow) * blockSize + row) * referenceImage.width + static_cast<size_t>(blockX) * blockSize };
+			const __m128 referencePixels{ _mm_loadu_ps(&referenceImage.pixels[rowOffset]) };
+			const __m128 pixels{ _mm_loadu_ps(&image.pixels[rowOffset]) };
+			sumReference = _mm_add_ps(sumReference, referencePixels);
+			sumImage = _mm_add_ps(sumImage, pixels);
+			sumReferenceSquared = _mm_add_ps(sumReferenceSquared, _mm_mul_ps(referencePixels, referencePixels));
+			sumImageSquared = _mm_add_ps(sumImageSquared, _mm_mul_ps(pixels, pixels));
+			sumProduct = _mm_add_ps(sumProduct, _mm_mul_ps(referencePixels, pixels));
+		}
+		_MM_TRANSPOSE4_PS(sumReference, sumImage, sumReferenceSquared, sumImageSquared);
+		alignas(16) float sums[4];
+		_mm_store_ps(sums, _mm_add_ps(_mm_add_ps(sumReference, sumImage), _mm_add_ps(sumReferenceSquared, sumImageSquared)));
+		alignas(16) float products[4];
+		_mm_store_ps(products, sumProduct);
+		const size_t blockIndex{ static_cast<size_t>(blockRow) * blockSums.countX + blockX };
+		blockSums.reference[blockIndex] = sums[0];
+		blockSums.image[blockIndex] = sums[1];
+		blockSums.referenceSquared[blockIndex] = sums[2];
+		blockSums.imageSquared[blockIndex] = sums[3];
+		blockSums.product[blockIndex] = products[0] + products[1] + products[2] + products[3];
+	}
+	return blockSums.countX;
+#else
+	return 0;
+#endif
+}
+
+const double ImageQuality::accumulateWindowRowSimilarity(const BlockSums& blockSums, const uint32_t blockRow)
+{
+	double similarity{ 0.0 };
+	const uint32_t windowCountX{ blockSums.countX - 1 };
+	for (uint32_t windowX = accumulateWindowRowSimilaritySIMD(blockSums, blockRow, similarity); windowX < windowCountX; ++windowX)
+	{
+		const size_t topBlockIndex{ static_cast<size_t>(blockRow) * blockSums.countX + windowX };
+		const size_t bottomBlockIndex{ topBlockIndex + blockSums.countX };
+		const auto sumWindow = [&](const std::vector<float>& sums)
+		{
+			return sums[topBlockIndex] + sums[topBlockIndex + 1] + sums[bottomBlockIndex] + sums[bottomBlockIndex + 1];
+		};
+		similarity += computeWindowSimilarity(sumWindow(blockSums.reference), sumWindow(blockSums.image), sumWindow(blockSums.referenceSquared), sumWindow(blockSums.imageSquared), sumWindow(blockSums.product));
+	}
+	return similarity;
+}
+
+const uint32_t ImageQuality::accumulateWindowRowSimilaritySIMD(const BlockSums& blockSums, const uint32_t blockRow, double& similarity)
+{
+#ifdef IMAGE_QUALITY_USE_SSE2
+	const uint32_t windowCountX{ blockSums.countX - 1 };
+	const __m128 inverseWindowPixelCount{ _mm_set1_ps(1.0f / windowPixelCount) };
+	const __m128 two{ _mm_set1_ps(2.0f) };
+	const __m128 luminanceStabilizers{ _mm_set1_ps(luminanceStabilizer) };
+	const __m128 contrastStabilizers{ _mm_set1_ps(contrastStabilizer) };
+	__m128 similarities{ _mm_setzero_ps() };
+	uint32_t windowX{ 0 };
+	for (; windowX + 4 <= windowCountX; windowX += 4)
+	{
+		const size_t topBlockIndex{ static_cast<size_t>(blockRow) * blockSums.countX + windowX };
+		const size_t bottomBlockIndex{ topBlockIndex + blockSums.countX };
+		const auto meanWindow = [&](const std::vector<float>& sums)
+		{
+			const __m128 topSums{ _mm_add_ps(_mm_loadu_ps(&sums[topBlockIndex]), _mm_loadu_ps(&sums[topBlockIndex + 1])) };
+			const __m128 bottomSums{ _mm_add_ps(_mm_loadu_ps(&sums[bottomBlockIndex]), _mm_loadu_ps(&sums[bottomBlockIndex + 1])) };
+			return _mm_mul_ps(_mm_add_ps(topSums, bottomSums), inverseWindowPixelCount);
+		};
+		const __m128 meanReference{ meanWindow(blockSums.reference) };
+		const __m128 meanImage{ meanWindow(blockSums.image) };
+		const __m128 meanReferenceSquared{ _mm_mul_ps(meanReference, meanReference) };
+		const __m128 meanImageSquared{ _mm_mul_ps(meanImage, meanImage) };
+		const __m128 meanProduct{ _mm_mul_ps(meanReference, meanImage) };
+		const __m128 varianceSum{ _mm_sub_ps(_mm_add_ps(meanWindow(blockSums.referenceSquared), meanWindow(blockSums.imageSquared)), _mm_add_ps(meanReferenceSquared, meanImageSquared)) };
+		const __m128 covariance{ _mm_sub_ps(meanWindow(blockSums.product), meanProduct) };
+		const __m128 numerator{ _mm_mul_ps(_mm_add_ps(_mm_mul_ps(two, meanProduct), luminanceStabilizers), _mm_add_ps(_mm_mul_ps(two, covariance), contrastStabilizers)) };
+		const __m128 denominator{ _mm_mul_ps(_mm_add_ps(_mm_add_ps(meanReferenceSquared, meanImageSquared), luminanceStabilizers), _mm_add_ps(varianceSum, contrastStabilizers)) };
+		similarities = _mm_add_ps(similarities, _mm_div_ps(numerator, denominator));
+	}
+	alignas(16) float lanes[4];
+	_mm_store_ps(lanes, similarities);
+	similarity += static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+	return windowX;
+#else
+	return 0;
+#endif
+}
+
+const float ImageQuality::computeWindowSimilarity(const float sumReference, const float sumImage, const float sumReferenceSquared, const float sumImageSquared, const float sumProduct)
+{
+	const float meanReference{ sumReference / windowPixelCount };
+	const float meanImage{ sumImage / windowPixelCount };
+	const float varianceReference{ sumReferenceSquared / windowPixelCount - meanReference * meanReference };
+	const float varianceImage{ sumImageSquared / windowPixelCount - meanImage * meanImage };
+	const float covariance{ sumProduct / windowPixelCount - meanReference * meanImage };
+	return ((2.0f * meanReference * meanImage + luminanceStabilizer) * (2.0f * covariance + contrastStabilizer))
+		/ ((meanReference * meanReference + meanImage * meanImage + luminanceStabilizer) * (varianceReference + varianceImage + contrastStabilizer));
+}
\ No newline at end of file
@@ -1,8 +1,12 @@
 #include "ImageView.h"
 
-ImageView::ImageView(const vk::Device& vulkanLogicalDevice, const vk::Image& image, const vk::SurfaceFormatKHR& surfaceFormat) : vulkanLogicalDevice(vulkanLogicalDevice)
+ImageView::ImageView(const vk::Device& vulkanLogicalDevice, const vk::Image& image, const vk::SurfaceFormatKHR& surfaceFormat) : ImageView(vulkanLogicalDevice, image, surfaceFormat.format, vk::ImageAspectFlagBits::eColor, 1)
 {
-    vk::ImageViewCreateInfo imageViewCreateInfo{ buildImageViewCreateInfo(image, surfaceFormat) };
+}
+
+ImageView::ImageView(const vk::Device& vulkanLogicalDevice, const vk::Image& image, const vk::Format format, const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+    vk::ImageViewCreateInfo imageViewCreateInfo{ buildImageViewCreateInfo(image, format, aspectMask, mipLevels) };
     vulkanImageView = vulkanLogicalDevice.createImageView(imageViewCreateInfo);
 }
 
@@ -11,23 +15,23 @@ ImageView::~ImageView()
     vulkanLogicalDevice.destroyImageView(vulkanImageView);
 }
 
-const vk::ImageViewCreateInfo ImageView::buildImageViewCreateInfo(const vk::Image& image, const vk::SurfaceFormatKHR& surfaceFormat) const
+const vk::ImageViewCreateInfo ImageView::buildImageViewCreateInfo(const vk::Image& image, const vk::Format format, const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels) const
 {
     return vk::ImageViewCreateInfo{
         .image = image,
         .viewType = vk::ImageViewType::e2D,
-        .format = surfaceFormat.format,
+        .format = format,
         .components = vk::ComponentSwizzle::eIdentity,
-        .subresourceRange = createImageSubresourceRange()
+        .subresourceRange = createImageSubresourceRange(aspectMask, mipLevels)
     };
 }
 
-const vk::ImageSubresourceRange ImageView::createImageSubresourceRange() const
+const vk::ImageSubresourceRange ImageView::createImageSubresourceRange(const vk::ImageAspectFlags& aspectMask, const uint32_t mipLevels) const
 {
     return vk::ImageSubresourceRange{
-        .aspectMask = vk::ImageAspectFlagBits::eColor,
+        .aspectMask = aspectMask,
         .baseMipLevel = 0,
-        .levelCount = 1,
+        .levelCount = mipLevels,
         .baseArrayLayer = 0,
         .layerCount = 1
     };
@@ -15,12 +15,38 @@ void JSONConfigurationFileParser::validateJSONConfigurationFile() const
 	assert(JSONDocument["window"].HasMember("height"));
 	assert(JSONDocument["window"].GetObject()["width"].IsInt());
 	assert(JSONDocument["window"].GetObject()["height"].IsInt());
+	assert(!JSONDocument.HasMember("rendering") || JSONDocument["rendering"].IsObject());
+	assert(!JSONDocument.HasMember("rendering") || !JSONDocument["rendering"].HasMember("cacheCommandBuffers") || JSONDocument["rendering"].GetObject()["cacheCommandBuffers"].IsBool());
+	assert(!JSONDocument.HasMember("rendering") || !JSONDocument["rendering"].HasMember("framesInFlight") || JSONDocument["rendering"].GetObject()["framesInFlight"].IsInt());
+	assert(!JSONDocument.HasMember("rendering") || !JSONDocument["rendering"].HasMember("presentMode") || JSONDocument["rendering"].GetObject()["presentMode"].IsString());
+	assert(!JSONDocument.HasMember("rendering") || !JSONDocument["rendering"].HasMember("targetFrameRate") || JSONDocument["rendering"].GetObject()["targetFrameRate"].IsNumber());
+	assert(!JSONDocument.HasMember("rendering") || !JSONDocument["rendering"].HasMember("profileGpu") || JSONDocument["rendering"].GetObject()["profileGpu"].IsBool());
 }
 
 void JSONConfigurationFileParser::convertJSONDocumentToConfigurationFileModel() noexcept
 {
 	configurationFileModel.window.width = JSONDocument["window"].GetObject()["width"].GetInt();
 	configurationFileModel.window.height = JSONDocument["window"].GetObject()["height"].GetInt();
+	if (JSONDocument.HasMember("rendering") && JSONDocument["rendering"].HasMember("cacheCommandBuffers"))
+	{
+		configurationFileModel.rendering.cacheCommandBuffers = JSONDocument["rendering"].GetObject()["cacheCommandBuffers"].GetBool();
+	}
+	if (JSONDocument.HasMember("rendering") && JSONDocument["rendering"].HasMember("framesInFlight"))
+	{
+		configurationFileModel.rendering.framesInFlight = JSONDocument["rendering"].GetObject()["framesInFlight"].GetInt();
+	}
+	if (JSONDocument.HasMember("rendering") && JSONDocument["rendering"].HasMember("presentMode"))
+	{
+		configurationFileModel.rendering.presentMode = JSONDocument["rendering"].GetObject()["presentMode"].GetString();
+	}
+	if (JSONDocument.HasMember("rendering") && JSONDocument["rendering"].HasMember("targetFrameRate"))
+	{
+		configurationFileModel.rendering.targetFrameRate = JSONDocument["rendering"].GetObject()["targetFrameRate"].GetDouble();
+	}
+	if (JSONDocument.HasMember("rendering") && JSONDocument["rendering"].HasMember("profileGpu"))
+	{
+		configurationFileModel.rendering.profileGpu = JSONDocument["rendering"].GetObject()["profileGpu"].GetBool();
+	}
 }
 
 const ConfigurationFileModel JSONConfigurationFileParser::getConfigurationFileModel() const
@@ -0,0 +1,38 @@
+#include "LinearAllocator.h"
+
+LinearAllocator::LinearAllocator(const uint64_t size) : size(size)
+{
+}
+
+std::optional<uint64_t> LinearAllocator::allocate(const uint64_t size, const uint64_t alignment)
+{
+	const uint64_t offset{ alignment > 1 ? (usedSize + alignment - 1) / alignment * alignment : usedSize };
+	if (offset + size > this->size)
+	{
+		return std::nullopt;
+	}
+	usedSize = offset + size;
+	++allocationCount;
+	return offset;
+}
+
+void LinearAllocator::reset()
+{
+	usedSize = 0;
+	allocationCount = 0;
+}
+
+const uint64_t LinearAllocator::getSize() const
+{
+	return size;
+}
+
+const uint64_t LinearAllocator::getUsedSize() const
+{
+	return usedSize;
+}
+
+const uint32_t LinearAllocator::getAllocationCount() const
+{
+	return allocationCount;
+}
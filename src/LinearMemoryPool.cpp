@@ -0,0 +1,65 @@
+#include "LinearMemoryPool.h"
+
+LinearMemoryPool::LinearMemoryPool(const LinearMemoryPoolCreateInfo& linearMemoryPoolCreateInfo) : deviceMemoryAllocator(linearMemoryPoolCreateInfo.deviceMemoryAllocator)
+{
+	frameSize = (linearMemoryPoolCreateInfo.frameSize + frameAlignment - 1) / frameAlignment * frameAlignment;
+	frameAllocators.assign(linearMemoryPoolCreateInfo.frameCount, LinearAllocator(frameSize));
+	vulkanBuffer = deviceMemoryAllocator->getVulkanLogicalDevice().createBuffer(buildBufferCreateInfo(linearMemoryPoolCreateInfo));
+	memoryAllocation = deviceMemoryAllocator->allocateBufferMemory(vulkanBuffer, linearMemoryPoolCreateInfo.memoryPropertyFlags);
+}
+
+LinearMemoryPool::~LinearMemoryPool()
+{
+	deviceMemoryAllocator->getVulkanLogicalDevice().destroyBuffer(vulkanBuffer);
+	deviceMemoryAllocator->free(memoryAllocation);
+}
+
+const vk::BufferCreateInfo LinearMemoryPool::buildBufferCreateInfo(const LinearMemoryPoolCreateInfo& linearMemoryPoolCreateInfo) const
+{
+	const std::vector<uint32_t>& sharingQueueFamilyIndices{ linearMemoryPoolCreateInfo.sharingQueueFamilyIndices };
+	const bool isShared{ sharingQueueFamilyIndices.size() > 1 };
+	return vk::BufferCreateInfo{
+		.size = frameSize * linearMemoryPoolCreateInfo.frameCount,
+		.usage = linearMemoryPoolCreateInfo.bufferUsage,
+		.sharingMode = isShared ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+		.queueFamilyIndexCount = isShared ? static_cast<uint32_t>(sharingQueueFamilyIndices.size()) : 0,
+		.pQueueFamilyIndices = isShared ? sharingQueueFamilyIndices.data() : nullptr
+	};
+}
+
+void LinearMemoryPool::beginFrame(const uint32_t frameIndex)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(frameIndex, frameAllocators.size(), "Error in LinearMemoryPool! Frame index is out of bounds");
+	currentFrame = frameIndex;
+	frameAllocators[currentFrame].reset();
+}
+
+const LinearMemoryAllocation LinearMemoryPool::allocate(const vk::DeviceSize size, const vk::DeviceSize alignment)
+{
+	const std::optional<uint64_t> frameOffset{ frameAllocators[currentFrame].allocate(size, alignment) };
+	if (!frameOffset)
+	{
+		throw std::runtime_error("Error in LinearMemoryPool! Frame memory is exhausted");
+	}
+	const vk::DeviceSize offset{ currentFrame * frameSize + frameOffset.value() };
+	return LinearMemoryAllocation{
+		.vulkanBuffer = vulkanBuffer,
+		.offset = offset,
+		.mappedData = memoryAllocation.mappedData ? static_cast<char*>(memoryAllocation.mappedData) + offset : nullptr
+	};
+}
+
+const vk::Buffer LinearMemoryPool::getVulkanBuffer() const
+{
+	return vulkanBuffer;
+}
+
+const vk::DeviceSize LinearMemoryPool::getFrameSize() const
+{
+	return frameSize;
+}
+
+const vk::DeviceSize LinearMemoryPool::getUsedSize() const
+{
+	return frameAllocators[currentFrame].getUsedSize();
+}
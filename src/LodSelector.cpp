@@ -0,0 +1,26 @@
+#include "LodSelector.h"
+
+LodSelector::LodSelector(const float viewportHeight, const float verticalFieldOfView, const float maximumPixelError) : maximumPixelError(maximumPixelError)
+{
+	pixelsPerUnitAtUnitDistance = viewportHeight / (2.0f * std::tan(verticalFieldOfView * 0.5f));
+}
+
+const uint32_t LodSelector::select(const Mesh& mesh, const float distance, const float scale) const
+{
+	return select(mesh.lods, distance, scale);
+}
+
+const uint32_t LodSelector::select(const std::vector<MeshLod>& lods, const float distance, const float scale) const
+{
+	const float pixelsPerUnit{ pixelsPerUnitAtUnitDistance * scale / std::max(distance, 1e-4f) };
+	uint32_t selectedLod{ 0 };
+	for (uint32_t lod = 1; lod < lods.size(); ++lod)
+	{
+		if (lods[lod].error * pixelsPerUnit > maximumPixelError)
+		{
+			break;
+		}
+		selectedLod = lod;
+	}
+	return selectedLod;
+}
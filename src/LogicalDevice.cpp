@@ -1,34 +1,69 @@
 #include "LogicalDevice.h"
 
-LogicalDevice::LogicalDevice(const LogicalDeviceCreateInfo& logicalDeviceCreateInfo)
+LogicalDevice::LogicalDevice(const LogicalDeviceCreateInfo& logicalDeviceCreateInfo) : renderSettings(logicalDeviceCreateInfo.renderSettings), MAX_FRAMES_IN_FLIGHT(logicalDeviceCreateInfo.renderSettings.framesInFlight)
 {
+	enableDescriptorIndexingIfSupported(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	enablePipelineStatisticsQueryIfSupported(logicalDeviceCreateInfo.vulkanPhysicalDevice);
 	const std::set<uint32_t> uniqueQueueFamilies = createUniqueQueueFamilies(logicalDeviceCreateInfo.queueFamilyIndices);
 	const std::vector<vk::DeviceQueueCreateInfo> deviceQueueCreateInfos{ buildDeviceQueueCreateInfos(uniqueQueueFamilies) };
 	const vk::DeviceCreateInfo vulkanLogicalDeviceCreateInfo{ buildVulkanLogicalDeviceCreateInfo(deviceQueueCreateInfos, logicalDeviceCreateInfo) };
 	vulkanLogicalDevice = logicalDeviceCreateInfo.vulkanPhysicalDevice.createDevice(vulkanLogicalDeviceCreateInfo);
 	createSwapChain(logicalDeviceCreateInfo);
 	createRenderPass();
+	createPipelineCache(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	threadPool = std::make_unique<ThreadPool>();
+	pipelineVariantManager = std::make_unique<PipelineVariantManager>();
 	createFramebuffers();
-	createCommandPool(logicalDeviceCreateInfo.queueFamilyIndices.getGraphicsFamilyIndex());
-	createCommandBuffers();
 	createSynchronizationObjects();
 	createQueues(logicalDeviceCreateInfo.queueFamilyIndices);
-	createVertexBuffer(logicalDeviceCreateInfo.vertices, logicalDeviceCreateInfo.vulkanPhysicalDevice);
-	createIndexBuffer(logicalDeviceCreateInfo.indices, logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	createCommandRecorders();
+	createDeviceMemoryAllocator(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	createUploadManager(logicalDeviceCreateInfo.queueFamilyIndices);
+	createUniformRing(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	createBindlessDescriptorHeap(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	createAmbientOcclusionImageChains();
+	createGpuProfiler(logicalDeviceCreateInfo.vulkanPhysicalDevice);
+	createFrameCapture();
+	createRenderGraph();
+	generateAmbientOcclusionKernel();
+	const auto uploadStart{ std::chrono::steady_clock::now() };
+	createGeometryBuffers();
+	meshGeometryRange = addMesh(logicalDeviceCreateInfo.mesh);
+	uploadManager->waitForUploads();
+	initialUploadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - uploadStart).count();
 }
 
 LogicalDevice::~LogicalDevice()
 {
+	frameLatencyTracker.reset();
 	for (auto& synchronizationObject : synchronizationObjects)
 	{
 		synchronizationObject.reset();
 	}
 	swapChain.reset();
-	commandPool.reset();
-	graphicsPipeline.reset();
+	commandBufferCache.reset();
+	graphicsCommandRecorder.reset();
+	computeCommandRecorder.reset();
+	graphicsRenderGraphSemaphore.reset();
+	computeRenderGraphSemaphore.reset();
+	geometryPipeline.reset();
+	forwardPipeline.reset();
+	pipelineVariantManager.reset();
+	pipelineCache.reset();
 	renderPass.reset();
+	geometryRenderPass.reset();
+	uploadManager.reset();
+	uniformRing.reset();
+	geometryFramebuffers.clear();
+	ambientOcclusionImageChains.clear();
+	nearestSampler.reset();
+	bindlessDescriptorHeap.reset();
+	renderGraph.reset();
+	gpuProfiler.reset();
+	frameCapture.reset();
 	vertexBuffer.reset();
 	indexBuffer.reset();
+	deviceMemoryAllocator.reset();
 	vulkanLogicalDevice.destroy();
 }
 
@@ -38,6 +73,14 @@ const std::set<uint32_t> LogicalDevice::createUniqueQueueFamilies(const QueueFam
 		queueFamilyIndices.getGraphicsFamilyIndex().value(),
 		queueFamilyIndices.getPresentFamilyIndex().value()
 	};
+	if (queueFamilyIndices.getTransferFamilyIndex().has_value())
+	{
+		uniqueQueueFamilies.insert(queueFamilyIndices.getTransferFamilyIndex().value());
+	}
+	if (queueFamilyIndices.getComputeFamilyIndex().has_value())
+	{
+		uniqueQueueFamilies.insert(queueFamilyIndices.getComputeFamilyIndex().value());
+	}
 	return uniqueQueueFamilies;
 }
 
@@ -64,6 +107,7 @@ const vk::DeviceQueueCreateInfo LogicalDevice::buildDeviceQueueCreateInfo(uint32
 const vk::DeviceCreateInfo LogicalDevice::buildVulkanLogicalDeviceCreateInfo(const std::vector<vk::DeviceQueueCreateInfo>& deviceQueueCreateInfos, const LogicalDeviceCreateInfo& logicalDeviceCreateInfo) const
 {
 	return vk::DeviceCreateInfo{
+		.pNext = &physicalDeviceVulkan12Features,
 		.queueCreateInfoCount = static_cast<uint32_t>(deviceQueueCreateInfos.size()),
 		.pQueueCreateInfos = deviceQueueCreateInfos.data(),
 		.enabledLayerCount = logicalDeviceCreateInfo.enabledLayerCount,
@@ -81,7 +125,9 @@ void LogicalDevice::createSwapChain(const LogicalDeviceCreateInfo& logicalDevice
 		.vulkanWindowSurface = logicalDeviceCreateInfo.vulkanWindowSurface,
 		.framebufferSize = logicalDeviceCreateInfo.framebufferSize,
 		.queueFamilyIndices = logicalDeviceCreateInfo.queueFamilyIndices,
-		.vulkanLogicalDevice = this->vulkanLogicalDevice
+		.vulkanLogicalDevice = this->vulkanLogicalDevice,
+		.requestedPresentMode = logicalDeviceCreateInfo.renderSettings.presentMode,
+		.requestedImageUsage = logicalDeviceCreateInfo.renderSettings.isFrameCaptureEnabled ? vk::ImageUsageFlagBits::eTransferSrc : vk::ImageUsageFlags{}
 	};
 	swapChain = std::make_unique<SwapChain>(swapChainCreateInfo);
 }
@@ -89,6 +135,15 @@ void LogicalDevice::createSwapChain(const LogicalDeviceCreateInfo& logicalDevice
 void LogicalDevice::createRenderPass()
 {
 	renderPass = std::make_unique<RenderPass>(vulkanLogicalDevice, swapChain->getSurfaceFormat());
+	geometryRenderPass = std::make_unique<GeometryRenderPass>(vulkanLogicalDevice, AmbientOcclusionImageChain::normalsFormat, AmbientOcclusionImageChain::depthFormat);
+}
+
+void LogicalDevice::createPipelineCache(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	PipelineCacheCreateInfo pipelineCacheCreateInfo;
+	pipelineCacheCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	pipelineCacheCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+	pipelineCache = std::make_unique<PipelineCache>(pipelineCacheCreateInfo);
 }
 
 void LogicalDevice::createFramebuffers()
@@ -96,14 +151,43 @@ void LogicalDevice::createFramebuffers()
 	swapChain->buildFramebuffers(vulkanLogicalDevice, renderPass->getVulkanRenderPass());
 }
 
-void LogicalDevice::createCommandPool(const std::optional<uint32_t> graphicsFamilyIndex)
+void LogicalDevice::createCommandRecorders()
+{
+	ParallelCommandRecorderCreateInfo parallelCommandRecorderCreateInfo;
+	parallelCommandRecorderCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	parallelCommandRecorderCreateInfo.queueFamilyIndex = graphicsFamilyIndex;
+	parallelCommandRecorderCreateInfo.frameCount = static_cast<int>(getCommandRecordingSlotCount());
+	parallelCommandRecorderCreateInfo.threadCount = threadPool->getThreadCount() + 1;
+	parallelCommandRecorderCreateInfo.isReusable = renderSettings.isCommandBufferCachingEnabled;
+	graphicsCommandRecorder = std::make_unique<ParallelCommandRecorder>(parallelCommandRecorderCreateInfo);
+	if (computeQueue)
+	{
+		parallelCommandRecorderCreateInfo.queueFamilyIndex = computeFamilyIndex.value();
+		parallelCommandRecorderCreateInfo.threadCount = 1;
+		computeCommandRecorder = std::make_unique<ParallelCommandRecorder>(parallelCommandRecorderCreateInfo);
+	}
+	commandBufferCache = std::make_unique<CommandBufferCache>(getCommandRecordingSlotCount());
+}
+
+void LogicalDevice::resizeCommandRecordingSlots()
+{
+	const uint32_t slotCount{ getCommandRecordingSlotCount() };
+	graphicsCommandRecorder->reserveFrames(static_cast<int>(slotCount));
+	if (computeCommandRecorder)
+	{
+		computeCommandRecorder->reserveFrames(static_cast<int>(slotCount));
+	}
+	commandBufferCache->resize(slotCount);
+}
+
+const uint32_t LogicalDevice::getCommandRecordingSlotCount() const
 {
-	commandPool = std::make_unique<CommandPool>(vulkanLogicalDevice, graphicsFamilyIndex);
+	return renderSettings.isCommandBufferCachingEnabled ? MAX_FRAMES_IN_FLIGHT * swapChain->getImageCount() : MAX_FRAMES_IN_FLIGHT;
 }
 
-void LogicalDevice::createCommandBuffers()
+const uint32_t LogicalDevice::getCommandRecordingSlotIndex() const
 {
-	commandBuffers = std::make_unique<CommandBuffer>(vulkanLogicalDevice, commandPool->getVulkanCommandPool(), MAX_FRAMES_IN_FLIGHT);
+	return renderSettings.isCommandBufferCachingEnabled ? currentFrame * swapChain->getImageCount() + swapChainImageIndex : currentFrame;
 }
 
 void LogicalDevice::createSynchronizationObjects()
@@ -119,30 +203,305 @@ void LogicalDevice::createQueues(const QueueFamilyIndices& queueFamilyIndices)
 {
 	graphicsQueue = std::make_shared<GraphicsQueue>(vulkanLogicalDevice, queueFamilyIndices.getGraphicsFamilyIndex());
 	presentQueue = std::make_unique<PresentQueue>(vulkanLogicalDevice, queueFamilyIndices.getPresentFamilyIndex());
+	const std::optional<uint32_t> transferFamilyIndex{ queueFamilyIndices.getTransferFamilyIndex().has_value() ? queueFamilyIndices.getTransferFamilyIndex() : queueFamilyIndices.getGraphicsFamilyIndex() };
+	transferQueue = std::make_shared<TransferQueue>(vulkanLogicalDevice, transferFamilyIndex);
+	graphicsFamilyIndex = queueFamilyIndices.getGraphicsFamilyIndex().value();
+	computeFamilyIndex = queueFamilyIndices.getComputeFamilyIndex();
+	if (computeFamilyIndex.has_value() && computeFamilyIndex.value() != graphicsFamilyIndex)
+	{
+		computeQueue = std::make_unique<ComputeQueue>(vulkanLogicalDevice, computeFamilyIndex);
+	}
+}
+
+void LogicalDevice::createDeviceMemoryAllocator(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	DeviceMemoryAllocatorCreateInfo deviceMemoryAllocatorCreateInfo;
+	deviceMemoryAllocatorCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	deviceMemoryAllocatorCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+	deviceMemoryAllocator = std::make_shared<DeviceMemoryAllocator>(deviceMemoryAllocatorCreateInfo);
+}
+
+void LogicalDevice::createUploadManager(const QueueFamilyIndices& queueFamilyIndices)
+{
+	const uint32_t graphicsFamilyIndex{ queueFamilyIndices.getGraphicsFamilyIndex().value() };
+	const uint32_t transferFamilyIndex{ queueFamilyIndices.getTransferFamilyIndex().value_or(graphicsFamilyIndex) };
+	UploadManagerCreateInfo uploadManagerCreateInfo;
+	uploadManagerCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+	uploadManagerCreateInfo.transferQueue = transferQueue;
+	uploadManagerCreateInfo.transferFamilyIndex = transferFamilyIndex;
+	uploadManagerCreateInfo.sharingQueueFamilyIndices = { graphicsFamilyIndex };
+	if (transferFamilyIndex != graphicsFamilyIndex)
+	{
+		uploadManagerCreateInfo.sharingQueueFamilyIndices.push_back(transferFamilyIndex);
+	}
+	uploadManager = std::make_shared<UploadManager>(uploadManagerCreateInfo);
+}
+
+void LogicalDevice::createUniformRing(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	UniformRingCreateInfo uniformRingCreateInfo;
+	uniformRingCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+	uniformRingCreateInfo.uniformSize = sizeof(FrameUniforms);
+	uniformRingCreateInfo.minUniformBufferOffsetAlignment = vulkanPhysicalDevice.getProperties().limits.minUniformBufferOffsetAlignment;
+	uniformRingCreateInfo.frameCount = MAX_FRAMES_IN_FLIGHT;
+	uniformRingCreateInfo.shaderStages = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute;
+	uniformRingCreateInfo.sharingQueueFamilyIndices = { graphicsFamilyIndex };
+	if (computeQueue)
+	{
+		uniformRingCreateInfo.sharingQueueFamilyIndices.push_back(computeFamilyIndex.value());
+	}
+	uniformRing = std::make_unique<UniformRing>(uniformRingCreateInfo);
+}
+
+void LogicalDevice::enableDescriptorIndexingIfSupported(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	const auto physicalDeviceFeatures2{ vulkanPhysicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>() };
+	isDescriptorIndexingEnabled = BindlessDescriptorHeap::isDescriptorIndexingSupported(physicalDeviceFeatures2.get<vk::PhysicalDeviceVulkan12Features>());
+	if (isDescriptorIndexingEnabled)
+	{
+		BindlessDescriptorHeap::enableDescriptorIndexing(physicalDeviceVulkan12Features);
+	}
 }
 
-void LogicalDevice::createVertexBuffer(const std::vector<Vertex>& vertices, const vk::PhysicalDevice& vulkanPhysicalDevice)
+void LogicalDevice::enablePipelineStatisticsQueryIfSupported(const vk::PhysicalDevice& vulkanPhysicalDevice)
 {
-	const ContentBufferCreateInfo<Vertex> contentBufferCreateInfo{ buildContentBufferCreateInfo<Vertex>(vertices, vulkanPhysicalDevice) };
-	vertexBuffer = std::make_unique<VertexBuffer>(contentBufferCreateInfo);
+	const vk::PhysicalDeviceFeatures supportedPhysicalDeviceFeatures{ vulkanPhysicalDevice.getFeatures() };
+	physicalDeviceFeatures.pipelineStatisticsQuery = renderSettings.isGpuProfilingEnabled && supportedPhysicalDeviceFeatures.pipelineStatisticsQuery && supportedPhysicalDeviceFeatures.inheritedQueries;
+	physicalDeviceFeatures.inheritedQueries = physicalDeviceFeatures.pipelineStatisticsQuery;
+}
+
+void LogicalDevice::createBindlessDescriptorHeap(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	BindlessDescriptorHeapCreateInfo bindlessDescriptorHeapCreateInfo;
+	bindlessDescriptorHeapCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	bindlessDescriptorHeapCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+	bindlessDescriptorHeapCreateInfo.isDescriptorIndexingEnabled = isDescriptorIndexingEnabled;
+	bindlessDescriptorHeapCreateInfo.frameCount = MAX_FRAMES_IN_FLIGHT;
+	bindlessDescriptorHeapCreateInfo.shaderStages = vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute;
+	bindlessDescriptorHeap = std::make_unique<BindlessDescriptorHeap>(bindlessDescriptorHeapCreateInfo);
+}
+
+void LogicalDevice::createAmbientOcclusionImageChains()
+{
+	nearestSampler = std::make_unique<Sampler>(vulkanLogicalDevice, vk::Filter::eNearest);
+	ambientOcclusionImageChains.resize(MAX_FRAMES_IN_FLIGHT);
+	geometryFramebuffers.resize(MAX_FRAMES_IN_FLIGHT);
+	bindlessPushConstants.resize(MAX_FRAMES_IN_FLIGHT);
+	for (uint32_t frameIndex = 0; frameIndex < ambientOcclusionImageChains.size(); ++frameIndex)
+	{
+		ambientOcclusionImageChains[frameIndex] = std::make_unique<AmbientOcclusionImageChain>(deviceMemoryAllocator, swapChain->getExtent());
+		registerAmbientOcclusionImages(frameIndex);
+		createGeometryFramebuffer(frameIndex);
+	}
+}
+
+void LogicalDevice::updateAmbientOcclusionImageChain()
+{
+	const vk::Extent2D extent{ swapChain->getExtent() };
+	if (ambientOcclusionImageChains[currentFrame]->getImage(AmbientOcclusionImage::eNormals).getExtent() == extent)
+	{
+		return;
+	}
+	releaseAmbientOcclusionImages(currentFrame);
+	geometryFramebuffers[currentFrame].reset();
+	ambientOcclusionImageChains[currentFrame] = std::make_unique<AmbientOcclusionImageChain>(deviceMemoryAllocator, extent);
+	registerAmbientOcclusionImages(currentFrame);
+	createGeometryFramebuffer(currentFrame);
+	commandBufferCache->invalidate();
 }
 
-template<typename T>
-const ContentBufferCreateInfo<T> LogicalDevice::buildContentBufferCreateInfo(const std::vector<T>& content, const vk::PhysicalDevice& vulkanPhysicalDevice) const
+void LogicalDevice::registerAmbientOcclusionImages(const uint32_t frameIndex)
 {
-	return ContentBufferCreateInfo<T>{
-		.vulkanLogicalDevice = vulkanLogicalDevice,
-		.content = content,
-		.vulkanPhysicalDevice = vulkanPhysicalDevice,
-		.vulkanCommandPool = commandPool->getVulkanCommandPool(),
-		.graphicsQueue = graphicsQueue
+	const AmbientOcclusionImageChain& ambientOcclusionImageChain{ *ambientOcclusionImageChains[frameIndex] };
+	const vk::ImageView normalsImageView{ ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eNormals).getVulkanImageView() };
+	const vk::ImageView ambientOcclusionImageView{ ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eRawAmbientOcclusion).getVulkanImageView() };
+	std::array<uint32_t, BindlessPushConstants::resourceHandleCount>& resourceHandles{ bindlessPushConstants[frameIndex].resourceHandles };
+	resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eNormals)] = bindlessDescriptorHeap->registerSampledImage(normalsImageView, nearestSampler->getVulkanSampler(), vk::ImageLayout::eShaderReadOnlyOptimal);
+	resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eAmbientOcclusion)] = bindlessDescriptorHeap->registerSampledImage(ambientOcclusionImageView, nearestSampler->getVulkanSampler(), vk::ImageLayout::eShaderReadOnlyOptimal);
+	resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eAmbientOcclusionStorage)] = bindlessDescriptorHeap->registerStorageImage(ambientOcclusionImageView);
+}
+
+void LogicalDevice::releaseAmbientOcclusionImages(const uint32_t frameIndex)
+{
+	std::array<uint32_t, BindlessPushConstants::resourceHandleCount>& resourceHandles{ bindlessPushConstants[frameIndex].resourceHandles };
+	bindlessDescriptorHeap->release(BindlessResourceType::eSampledImage, resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eNormals)]);
+	bindlessDescriptorHeap->release(BindlessResourceType::eSampledImage, resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eAmbientOcclusion)]);
+	bindlessDescriptorHeap->release(BindlessResourceType::eStorageImage, resourceHandles[static_cast<uint32_t>(BindlessResourceSlot::eAmbientOcclusionStorage)]);
+	resourceHandles.fill(BindlessPushConstants::invalidResourceHandle);
+}
+
+void LogicalDevice::createGeometryFramebuffer(const uint32_t frameIndex)
+{
+	const AmbientOcclusionImageChain& ambientOcclusionImageChain{ *ambientOcclusionImageChains[frameIndex] };
+	const std::vector<vk::ImageView> vulkanImageViews{
+		ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eNormals).getVulkanImageView(),
+		ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eDepth).getVulkanImageView()
 	};
+	geometryFramebuffers[frameIndex] = std::make_unique<Framebuffer>(vulkanLogicalDevice, geometryRenderPass->getVulkanRenderPass(), vulkanImageViews, ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eNormals).getExtent());
+}
+
+void LogicalDevice::createGpuProfiler(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	if (!renderSettings.isGpuProfilingEnabled)
+	{
+		return;
+	}
+	GpuProfilerCreateInfo gpuProfilerCreateInfo;
+	gpuProfilerCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	gpuProfilerCreateInfo.vulkanPhysicalDevice = vulkanPhysicalDevice;
+	gpuProfilerCreateInfo.graphicsFamilyIndex = graphicsFamilyIndex;
+	gpuProfilerCreateInfo.computeFamilyIndex = computeQueue ? computeFamilyIndex : std::nullopt;
+	gpuProfilerCreateInfo.frameCount = MAX_FRAMES_IN_FLIGHT;
+	gpuProfilerCreateInfo.isPipelineStatisticsEnabled = physicalDeviceFeatures.pipelineStatisticsQuery;
+	gpuProfilerCreateInfo.sampleCount = renderSettings.gpuProfilerSampleCount;
+	gpuProfiler = std::make_unique<GpuProfiler>(gpuProfilerCreateInfo);
+}
+
+void LogicalDevice::createFrameCapture()
+{
+	if (!renderSettings.isFrameCaptureEnabled)
+	{
+		return;
+	}
+	if (!(swapChain->getImageUsage() & vk::ImageUsageFlagBits::eTransferSrc))
+	{
+		throw std::runtime_error("Error in LogicalDevice! Swap chain images cannot be used as a transfer source for frame capture");
+	}
+	frameCapture = std::make_unique<FrameCapture>(FrameCaptureCreateInfo{
+		.deviceMemoryAllocator = deviceMemoryAllocator,
+		.format = swapChain->getSurfaceFormat().format
+	});
 }
 
-void LogicalDevice::createIndexBuffer(const std::vector<uint16_t>& indices, const vk::PhysicalDevice& vulkanPhysicalDevice)
+void LogicalDevice::createRenderGraph()
 {
-	const ContentBufferCreateInfo<uint16_t> contentBufferCreateInfo{ buildContentBufferCreateInfo<uint16_t>(indices, vulkanPhysicalDevice) };
-	indexBuffer = std::make_unique<IndexBuffer>(contentBufferCreateInfo);
+	renderGraph = std::make_unique<RenderGraph>(RenderGraphCreateInfo{
+		.graphicsFamilyIndex = graphicsFamilyIndex,
+		.computeFamilyIndex = computeQueue ? computeFamilyIndex : std::nullopt
+	});
+	graphicsRenderGraphSemaphore = std::make_unique<TimelineSemaphore>(vulkanLogicalDevice);
+	computeRenderGraphSemaphore = std::make_unique<TimelineSemaphore>(vulkanLogicalDevice);
+	frameLatencyTracker = std::make_unique<FrameLatencyTracker>(*graphicsRenderGraphSemaphore);
+	swapChainImageHandle = renderGraph->addImage(RenderGraphImageDescription{
+		.name = "SwapChain",
+		.initialLayout = vk::ImageLayout::eUndefined,
+		.initialStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+		.finalLayout = vk::ImageLayout::ePresentSrcKHR,
+		.finalStageMask = vk::PipelineStageFlagBits::eBottomOfPipe,
+		.isExternal = true
+	});
+	depthImageHandle = renderGraph->addImage(RenderGraphImageDescription{ .name = "Depth", .aspectMask = vk::ImageAspectFlagBits::eDepth });
+	normalsImageHandle = renderGraph->addImage(RenderGraphImageDescription{ .name = "Normals" });
+	rawAmbientOcclusionImageHandle = renderGraph->addImage(RenderGraphImageDescription{ .name = "RawAmbientOcclusion" });
+	addRenderGraphPass(RenderGraphPassDescription{
+		.name = "Geometry",
+		.writes = {
+			RenderGraphAccess{
+				.imageHandle = depthImageHandle,
+				.stageMask = vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests,
+				.accessMask = vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+				.layout = vk::ImageLayout::eDepthStencilAttachmentOptimal
+			},
+			RenderGraphAccess{
+				.imageHandle = normalsImageHandle,
+				.stageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+				.accessMask = vk::AccessFlagBits::eColorAttachmentWrite,
+				.layout = vk::ImageLayout::eColorAttachmentOptimal
+			}
+		},
+		.record = [this](const vk::CommandBuffer& vulkanCommandBuffer) { CommandBuffer::recordGeometryPass(vulkanCommandBuffer, createGeometryPassRecordInfo()); }
+	});
+	addRenderGraphPass(RenderGraphPassDescription{
+		.name = "AmbientOcclusion",
+		.queue = RenderGraphQueue::eCompute,
+		.reads = { RenderGraphAccess{
+			.imageHandle = normalsImageHandle,
+			.stageMask = vk::PipelineStageFlagBits::eComputeShader,
+			.accessMask = vk::AccessFlagBits::eShaderRead,
+			.layout = vk::ImageLayout::eShaderReadOnlyOptimal
+		} },
+		.writes = { RenderGraphAccess{
+			.imageHandle = rawAmbientOcclusionImageHandle,
+			.stageMask = vk::PipelineStageFlagBits::eComputeShader,
+			.accessMask = vk::AccessFlagBits::eShaderWrite,
+			.layout = vk::ImageLayout::eGeneral
+		} },
+		.record = [this](const vk::CommandBuffer& vulkanCommandBuffer) { CommandBuffer::recordAmbientOcclusionPass(vulkanCommandBuffer, createAmbientOcclusionPassRecordInfo()); }
+	});
+	addRenderGraphPass(RenderGraphPassDescription{
+		.name = "Forward",
+		.reads = { RenderGraphAccess{
+			.imageHandle = rawAmbientOcclusionImageHandle,
+			.stageMask = vk::PipelineStageFlagBits::eFragmentShader,
+			.accessMask = vk::AccessFlagBits::eShaderRead,
+			.layout = vk::ImageLayout::eShaderReadOnlyOptimal
+		} },
+		.writes = { RenderGraphAccess{
+			.imageHandle = swapChainImageHandle,
+			.stageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+			.accessMask = vk::AccessFlagBits::eColorAttachmentWrite,
+			.layout = vk::ImageLayout::eColorAttachmentOptimal
+		} },
+		.record = [this](const vk::CommandBuffer& vulkanCommandBuffer) { CommandBuffer::recordForwardPass(vulkanCommandBuffer, createCommandBufferRecordInfo(swapChainImageIndex), *graphicsCommandRecorder, *threadPool); }
+	});
+	if (frameCapture)
+	{
+		addRenderGraphPass(RenderGraphPassDescription{
+			.name = "Capture",
+			.reads = { RenderGraphAccess{
+				.imageHandle = swapChainImageHandle,
+				.stageMask = vk::PipelineStageFlagBits::eTransfer,
+				.accessMask = vk::AccessFlagBits::eTransferRead,
+				.layout = vk::ImageLayout::eTransferSrcOptimal
+			} },
+			.record = [this](const vk::CommandBuffer& vulkanCommandBuffer) { frameCapture->record(vulkanCommandBuffer, swapChain->getVulkanImage(swapChainImageIndex), swapChain->getExtent()); },
+			.hasSideEffects = true
+		});
+	}
+	renderGraph->compile();
+}
+
+const uint32_t LogicalDevice::addRenderGraphPass(RenderGraphPassDescription renderGraphPassDescription)
+{
+	if (gpuProfiler)
+	{
+		const RenderGraphQueue executionQueue{ renderGraphPassDescription.queue == RenderGraphQueue::eCompute && computeQueue ? RenderGraphQueue::eCompute : RenderGraphQueue::eGraphics };
+		const uint32_t profiledPassIndex{ gpuProfiler->addPass(renderGraphPassDescription.name, executionQueue) };
+		const std::function<void(const vk::CommandBuffer&)> record{ renderGraphPassDescription.record };
+		renderGraphPassDescription.record = [this, profiledPassIndex, record](const vk::CommandBuffer& vulkanCommandBuffer)
+		{
+			gpuProfiler->beginPass(vulkanCommandBuffer, profiledPassIndex);
+			record(vulkanCommandBuffer);
+			gpuProfiler->endPass(vulkanCommandBuffer, profiledPassIndex);
+		};
+	}
+	return renderGraph->addPass(renderGraphPassDescription);
+}
+
+void LogicalDevice::createGeometryBuffers()
+{
+	BufferCreateInfo bufferCreateInfo;
+	bufferCreateInfo.deviceMemoryAllocator = deviceMemoryAllocator;
+	bufferCreateInfo.uploadManager = uploadManager;
+	vertexBuffer = std::make_unique<VertexBuffer>(bufferCreateInfo);
+	indexBuffer = std::make_unique<IndexBuffer>(bufferCreateInfo);
+}
+
+void LogicalDevice::generateAmbientOcclusionKernel()
+{
+	const uint64_t ambientOcclusionKernelSeed{ 1 };
+	ambientOcclusionKernel = AmbientOcclusionKernel::generate(ambientOcclusionParameters.sampleCount, ambientOcclusionKernelSeed);
+}
+
+const GeometryRange LogicalDevice::addMesh(const Mesh& mesh)
+{
+	return GeometryRange{
+		.vertexRangeHandle = vertexBuffer->allocate(mesh.vertices),
+		.indexRangeHandle = indexBuffer->allocate(mesh.indices),
+		.lods = mesh.lods,
+		.boundsCenter = mesh.boundsCenter,
+		.boundsRadius = mesh.boundsRadius
+	};
 }
 
 const vk::Device LogicalDevice::getVulkanLogicalDevice() const
@@ -150,64 +509,291 @@ const vk::Device LogicalDevice::getVulkanLogicalDevice() const
 	return vulkanLogicalDevice;
 }
 
-void LogicalDevice::createGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders)
+const MemoryStatistics LogicalDevice::getMemoryStatistics() const
+{
+	return deviceMemoryAllocator->getStatistics();
+}
+
+const UploadStatistics LogicalDevice::getUploadStatistics() const
+{
+	UploadStatistics uploadStatistics{ uploadManager->getStatistics() };
+	uploadStatistics.initialUploadMilliseconds = initialUploadMilliseconds;
+	return uploadStatistics;
+}
+
+const TransientMemoryStatistics LogicalDevice::getTransientMemoryStatistics() const
+{
+	TransientMemoryStatistics transientMemoryStatistics{};
+	for (const auto& ambientOcclusionImageChain : ambientOcclusionImageChains)
+	{
+		const TransientMemoryStatistics chainStatistics{ ambientOcclusionImageChain->getStatistics() };
+		transientMemoryStatistics.imageCount += chainStatistics.imageCount;
+		transientMemoryStatistics.unaliasedBytes += chainStatistics.unaliasedBytes;
+		transientMemoryStatistics.allocatedBytes += chainStatistics.allocatedBytes;
+		transientMemoryStatistics.lazilyAllocatedBytes += chainStatistics.lazilyAllocatedBytes;
+	}
+	return transientMemoryStatistics;
+}
+
+const std::string LogicalDevice::getRenderGraphSchedule() const
+{
+	return renderGraph->dump();
+}
+
+const CommandRecordingStatistics LogicalDevice::getCommandRecordingStatistics() const
+{
+	return graphicsCommandRecorder->getStatistics();
+}
+
+const CommandBufferCacheStatistics LogicalDevice::getCommandBufferCacheStatistics() const
+{
+	return commandBufferCache->getStatistics();
+}
+
+const PipelineCacheStatistics LogicalDevice::getPipelineCacheStatistics() const
+{
+	return pipelineCache->getStatistics();
+}
+
+const FrameLatencyStatistics LogicalDevice::getFrameLatencyStatistics() const
+{
+	return frameLatencyTracker->getStatistics();
+}
+
+const std::vector<GpuPassStatistics> LogicalDevice::getGpuPassStatistics() const
+{
+	return gpuProfiler ? gpuProfiler->getStatistics() : std::vector<GpuPassStatistics>{};
+}
+
+void LogicalDevice::writeGpuProfile(const std::filesystem::path& csvFilePath, const std::filesystem::path& jsonFilePath) const
+{
+	if (!gpuProfiler)
+	{
+		throw std::runtime_error("Error in LogicalDevice! GPU profiling is not enabled");
+	}
+	gpuProfiler->writeCsv(csvFilePath);
+	gpuProfiler->writeJson(jsonFilePath);
+}
+
+const vk::PresentModeKHR LogicalDevice::getPresentMode() const
+{
+	return swapChain->getPresentMode();
+}
+
+const uint32_t LogicalDevice::getAmbientOcclusionQualityLevelCount() const
+{
+	return static_cast<uint32_t>(ambientOcclusionQualityLevels.size());
+}
+
+const std::optional<uint32_t> LogicalDevice::findAmbientOcclusionQualityLevel(const uint32_t sampleCount) const
+{
+	const auto qualityLevel{ std::find_if(ambientOcclusionQualityLevels.begin(), ambientOcclusionQualityLevels.end(), [&](const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) { return ambientOcclusionVariantKey.sampleCount == sampleCount; }) };
+	if (qualityLevel == ambientOcclusionQualityLevels.end())
+	{
+		return std::nullopt;
+	}
+	return static_cast<uint32_t>(std::distance(ambientOcclusionQualityLevels.begin(), qualityLevel));
+}
+
+void LogicalDevice::createPipelines(const PipelineShaders& pipelineShaders)
+{
+	const auto start{ std::chrono::steady_clock::now() };
+	geometryPipeline = buildGraphicsPipeline(pipelineShaders.geometryShaders, geometryRenderPass->getVulkanRenderPass(), true);
+	forwardPipeline = buildGraphicsPipeline(pipelineShaders.forwardShaders, renderPass->getVulkanRenderPass(), false);
+	ComputePipelineCreateInfo computePipelineCreateInfo;
+	computePipelineCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
+	computePipelineCreateInfo.vulkanPipelineCache = pipelineCache->getVulkanPipelineCache();
+	computePipelineCreateInfo.descriptorSetLayouts = { uniformRing->getVulkanDescriptorSetLayout(), bindlessDescriptorHeap->getVulkanDescriptorSetLayout() };
+	computePipelineCreateInfo.pushConstantRanges = { vk::PushConstantRange{
+		.stageFlags = vk::ShaderStageFlagBits::eCompute,
+		.offset = 0,
+		.size = sizeof(BindlessPushConstants)
+	} };
+	pipelineVariantManager->build(computePipelineCreateInfo, pipelineShaders.ambientOcclusionShader, ambientOcclusionQualityLevels, *threadPool);
+	pipelineCache->addPipelineCreationTime(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	pipelineCache->save();
+	commandBufferCache->invalidate();
+}
+
+std::unique_ptr<GraphicsPipeline> LogicalDevice::buildGraphicsPipeline(const std::vector<std::shared_ptr<Shader>>& shaders, const vk::RenderPass& vulkanRenderPass, const bool isDepthTestEnabled) const
 {
 	GraphicsPipelineCreateInfo graphicsPipelineCreateInfo;
 	graphicsPipelineCreateInfo.vulkanLogicalDevice = vulkanLogicalDevice;
-	graphicsPipelineCreateInfo.swapChainExtent = swapChain->getExtent();
+	graphicsPipelineCreateInfo.vulkanPipelineCache = pipelineCache->getVulkanPipelineCache();
 	for (const auto& shader : shaders)
 	{
 		graphicsPipelineCreateInfo.shaderStages.push_back(shader->buildPipelineShaderStageCreateInfo());
 	}
-	graphicsPipelineCreateInfo.vulkanRenderPass = renderPass->getVulkanRenderPass();
-	graphicsPipeline = std::make_unique<GraphicsPipeline>(graphicsPipelineCreateInfo);
+	graphicsPipelineCreateInfo.vulkanRenderPass = vulkanRenderPass;
+	graphicsPipelineCreateInfo.descriptorSetLayouts = { uniformRing->getVulkanDescriptorSetLayout(), bindlessDescriptorHeap->getVulkanDescriptorSetLayout() };
+	graphicsPipelineCreateInfo.pushConstantRanges = { vk::PushConstantRange{
+		.stageFlags = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
+		.offset = 0,
+		.size = sizeof(BindlessPushConstants)
+	} };
+	graphicsPipelineCreateInfo.isDepthTestEnabled = isDepthTestEnabled;
+	return std::make_unique<GraphicsPipeline>(graphicsPipelineCreateInfo);
+}
+
+void LogicalDevice::setAmbientOcclusionQuality(const uint32_t qualityLevel)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(qualityLevel, ambientOcclusionQualityLevels.size(), "Error in LogicalDevice! Ambient occlusion quality level is out of bounds");
+	if (ambientOcclusionVariantKey == ambientOcclusionQualityLevels[qualityLevel])
+	{
+		return;
+	}
+	ambientOcclusionVariantKey = ambientOcclusionQualityLevels[qualityLevel];
+	ambientOcclusionParameters.sampleCount = ambientOcclusionVariantKey.sampleCount;
+	generateAmbientOcclusionKernel();
+	commandBufferCache->invalidate();
+}
+
+void LogicalDevice::setCameraPose(const glm::vec3& position, const glm::vec3& target)
+{
+	camera.lookAt(position, target);
 }
 
-void LogicalDevice::drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
+void LogicalDevice::resetGpuProfile()
 {
+	if (gpuProfiler)
+	{
+		gpuProfiler->readAllFrames();
+		gpuProfiler->resetStatistics();
+	}
+}
+
+void LogicalDevice::requestFrameCapture()
+{
+	if (!frameCapture)
+	{
+		throw std::runtime_error("Error in LogicalDevice! Frame capture is not enabled in the render settings");
+	}
+	frameCapture->request(swapChain->getExtent());
+	commandBufferCache->invalidate();
+}
+
+const std::optional<LuminanceImage> LogicalDevice::readFrameCapture()
+{
+	if (!frameCapture)
+	{
+		throw std::runtime_error("Error in LogicalDevice! Frame capture is not enabled in the render settings");
+	}
+	waitIdle();
+	commandBufferCache->invalidate();
+	return frameCapture->read();
+}
+
+void LogicalDevice::drawFrame(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const std::chrono::steady_clock::time_point inputTime)
+{
+	TRACE_ZONE("LogicalDevice::drawFrame");
 	const uint32_t fenceCount{ 1 };
 	waitForFences(fenceCount);
+	if (gpuProfiler)
+	{
+		gpuProfiler->beginFrame(currentFrame);
+	}
+	releaseRetiredSwapChainResources();
+	beginGeometryBufferFrame();
+	bindlessDescriptorHeap->beginFrame(currentFrame, frameNumber, getCompletedFrameCount());
+	uploadManager->flush();
+	uploadManager->collectCompletedUploads();
 	const uint32_t imageIndex{ acquireNextImageFromSwapChain(getFramebufferSize, waitEvents) };
 	resetFences(fenceCount);
-	commandBuffers->reset(currentFrame);
-	commandBuffers->record(createCommandBufferRecordInfo(imageIndex));
-	graphicsQueue->submit(synchronizationObjects[currentFrame], commandBuffers->getVulkanCommandBuffer(currentFrame));
+	updateAmbientOcclusionImageChain();
+	updateFrameUniforms();
+	updateForwardDraws();
+	setRenderGraphImages(imageIndex);
+	recordRenderGraph();
+	const auto submitTime{ std::chrono::steady_clock::now() };
+	submitRenderGraph();
 	presentResult(getFramebufferSize, waitEvents, imageIndex);
+	frameLatencyTracker->addFrame(FrameTimestamps{
+		.completionValue = graphicsRenderGraphSemaphoreValue,
+		.inputTime = inputTime,
+		.submitTime = submitTime,
+		.presentTime = std::chrono::steady_clock::now()
+	});
 	currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+	++frameNumber;
+}
+
+void LogicalDevice::beginGeometryBufferFrame()
+{
+	const uint64_t completedFrameCount{ getCompletedFrameCount() };
+	vertexBuffer->beginFrame(frameNumber, completedFrameCount);
+	indexBuffer->beginFrame(frameNumber, completedFrameCount);
+}
+
+const uint64_t LogicalDevice::getCompletedFrameCount() const
+{
+	return frameNumber >= MAX_FRAMES_IN_FLIGHT ? frameNumber - MAX_FRAMES_IN_FLIGHT + 1 : 0;
 }
 
 void LogicalDevice::waitForFences(const uint32_t fenceCount)
 {
+	TRACE_ZONE("WaitForFences");
 	constexpr uint64_t timeout{ std::numeric_limits<uint64_t>::max() };
 	const vk::Result result{ vulkanLogicalDevice.waitForFences(fenceCount, &synchronizationObjects[currentFrame]->inFlight, vk::Bool32{ true }, timeout) };
 	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to wait for fences!");
 }
 
+void LogicalDevice::releaseRetiredSwapChainResources()
+{
+	const uint64_t completedFrameCount{ getCompletedFrameCount() };
+	swapChain->releaseRetiredSwapChains(completedFrameCount);
+}
+
 const uint32_t LogicalDevice::acquireNextImageFromSwapChain(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
 {
+	TRACE_ZONE("AcquireNextImage");
 	uint32_t imageIndex;
-	vk::Result result;
-	try
+	vk::Result result{ tryAcquireNextImageFromSwapChain(imageIndex) };
+	while (result == vk::Result::eErrorOutOfDateKHR)
 	{
-		result = swapChain->acquireNextImage(synchronizationObjects[currentFrame]->imageAvailable, renderPass->getVulkanRenderPass(), imageIndex);
+		recreateSwapChainIfResultIsOutOfDateOrSuboptimalKHR(result, getFramebufferSize, waitEvents);
+		result = tryAcquireNextImageFromSwapChain(imageIndex);
 	}
-	catch (vk::OutOfDateKHRError error)
+	if (result == vk::Result::eSuboptimalKHR)
 	{
-		result = vk::Result::eErrorOutOfDateKHR;
+		result = vk::Result::eSuccess;
 	}
-	recreateSwapChainIfResultIsOutOfDateOrSuboptimalKHR(result, getFramebufferSize, waitEvents);
 	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to acquire next image!");
 	return imageIndex;
 }
 
+const vk::Result LogicalDevice::tryAcquireNextImageFromSwapChain(uint32_t& imageIndex)
+{
+	try
+	{
+		return swapChain->acquireNextImage(synchronizationObjects[currentFrame]->imageAvailable, renderPass->getVulkanRenderPass(), imageIndex);
+	}
+	catch (const vk::OutOfDateKHRError&)
+	{
+		return vk::Result::eErrorOutOfDateKHR;
+	}
+}
+
 void LogicalDevice::recreateSwapChainIfResultIsOutOfDateOrSuboptimalKHR(vk::Result& result, std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
 {
+	if (result != vk::Result::eErrorOutOfDateKHR && result != vk::Result::eSuboptimalKHR)
+	{
+		return;
+	}
 	const SwapChainRecreateInfo swapChainRecreateInfo{
 		.vulkanRenderPass = renderPass->getVulkanRenderPass(),
 		.getFramebufferSize = getFramebufferSize,
-		.waitEvents = waitEvents
+		.waitEvents = waitEvents,
+		.frameNumber = frameNumber
 	};
 	swapChain->recreateIfResultIsOutOfDateOrSuboptimalKHR(result, swapChainRecreateInfo);
+	resizeCommandRecordingSlots();
+}
+
+const bool LogicalDevice::isFramebufferSizeDifferentFromSwapChainExtent(std::function<WindowSize()> getFramebufferSize) const
+{
+	const WindowSize framebufferSize{ getFramebufferSize() };
+	const vk::Extent2D extent{ swapChain->getExtent() };
+	return static_cast<uint32_t>(framebufferSize.width) != extent.width || static_cast<uint32_t>(framebufferSize.height) != extent.height;
 }
 
 void LogicalDevice::resetFences(const uint32_t fenceCount)
@@ -216,30 +802,262 @@ void LogicalDevice::resetFences(const uint32_t fenceCount)
 	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to reset fences!");
 }
 
+void LogicalDevice::updateFrameUniforms()
+{
+	TRACE_ZONE("UpdateFrameUniforms");
+	uniformRing->beginFrame(currentFrame);
+	uniformDynamicOffset = uniformRing->write(buildFrameUniforms());
+}
+
+const FrameUniforms LogicalDevice::buildFrameUniforms() const
+{
+	const vk::Extent2D extent{ swapChain->getExtent() };
+	const float aspectRatio{ static_cast<float>(extent.width) / static_cast<float>(std::max(extent.height, 1u)) };
+	return FrameUniforms{
+		.view = camera.getViewMatrix(),
+		.projection = camera.getProjectionMatrix(aspectRatio),
+		.cameraPosition = glm::vec4(camera.getPosition(), 1.0f),
+		.ambientOcclusionParameters = glm::vec4(ambientOcclusionParameters.radius, ambientOcclusionParameters.bias, ambientOcclusionParameters.intensity, static_cast<float>(ambientOcclusionParameters.sampleCount)),
+		.ambientOcclusionKernel = ambientOcclusionKernel
+	};
+}
+
+void LogicalDevice::setRenderGraphImages(const uint32_t imageIndex)
+{
+	const AmbientOcclusionImageChain& ambientOcclusionImageChain{ *ambientOcclusionImageChains[currentFrame] };
+	swapChainImageIndex = imageIndex;
+	renderGraph->setVulkanImage(swapChainImageHandle, swapChain->getVulkanImage(imageIndex));
+	renderGraph->setVulkanImage(depthImageHandle, ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eDepth).getVulkanImage());
+	renderGraph->setVulkanImage(normalsImageHandle, ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eNormals).getVulkanImage());
+	renderGraph->setVulkanImage(rawAmbientOcclusionImageHandle, ambientOcclusionImageChain.getImage(AmbientOcclusionImage::eRawAmbientOcclusion).getVulkanImage());
+}
+
+const CommandBufferRecordInfo LogicalDevice::createGeometryPassRecordInfo() const
+{
+	CommandBufferRecordInfo commandBufferRecordInfo{ createCommandBufferRecordInfo(swapChainImageIndex) };
+	commandBufferRecordInfo.renderPassBeginInfo = geometryRenderPass->createRenderPassBeginInfo(geometryFramebuffers[currentFrame]->getVulkanFramebuffer(), swapChain->getExtent());
+	commandBufferRecordInfo.graphicsPipeline = geometryPipeline->getVulkanPipeline();
+	commandBufferRecordInfo.graphicsPipelineLayout = geometryPipeline->getVulkanPipelineLayout();
+	return commandBufferRecordInfo;
+}
+
+const AmbientOcclusionPassRecordInfo LogicalDevice::createAmbientOcclusionPassRecordInfo() const
+{
+	const ComputePipeline& computePipeline{ pipelineVariantManager->getPipeline(ambientOcclusionVariantKey) };
+	return AmbientOcclusionPassRecordInfo{
+		.computePipeline = computePipeline.getVulkanPipeline(),
+		.computePipelineLayout = computePipeline.getVulkanPipelineLayout(),
+		.vulkanUniformDescriptorSet = uniformRing->getVulkanDescriptorSet(),
+		.uniformDynamicOffset = uniformDynamicOffset,
+		.vulkanBindlessDescriptorSet = bindlessDescriptorHeap->getVulkanDescriptorSet(),
+		.bindlessPushConstants = bindlessPushConstants[currentFrame],
+		.extent = swapChain->getExtent()
+	};
+}
+
 const CommandBufferRecordInfo LogicalDevice::createCommandBufferRecordInfo(const uint32_t imageIndex) const
 {
 	return CommandBufferRecordInfo{
 		.renderPassBeginInfo = renderPass->createRenderPassBeginInfo(swapChain->getVulkanFramebuffer(imageIndex), swapChain->getExtent()),
-		.graphicsPipeline = graphicsPipeline->getVulkanPipeline(),
+		.graphicsPipeline = forwardPipeline->getVulkanPipeline(),
+		.graphicsPipelineLayout = forwardPipeline->getVulkanPipelineLayout(),
 		.vulkanVertexBuffer = vertexBuffer->getVulkanBuffer(),
 		.vulkanIndexBuffer = indexBuffer->getVulkanBuffer(),
-		.frameIndex = currentFrame,
-		.indexCount = indexBuffer->getIndexCount(),
-		.indexType = vk::IndexType::eUint16
+		.vulkanUniformDescriptorSet = uniformRing->getVulkanDescriptorSet(),
+		.uniformDynamicOffset = uniformDynamicOffset,
+		.vulkanBindlessDescriptorSet = bindlessDescriptorHeap->getVulkanDescriptorSet(),
+		.bindlessPushConstants = bindlessPushConstants[currentFrame],
+		.draws = forwardDraws,
+		.indexType = vk::IndexType::eUint32,
+		.pipelineStatistics = gpuProfiler ? gpuProfiler->getGraphicsPipelineStatistics() : vk::QueryPipelineStatisticFlags{}
+	};
+}
+
+void LogicalDevice::updateForwardDraws()
+{
+	TRACE_ZONE("UpdateForwardDraws");
+	const MeshLod meshLod{ selectMeshLod(meshGeometryRange) };
+	const std::vector<IndexedDraw> draws{ IndexedDraw{
+		.indexCount = meshLod.indexCount,
+		.instanceCount = 1,
+		.firstIndex = indexBuffer->getRange(meshGeometryRange.indexRangeHandle).firstElement + meshLod.firstIndex,
+		.vertexOffset = vertexBuffer->getRange(meshGeometryRange.vertexRangeHandle).firstElement,
+		.firstInstance = 0
+	} };
+	if (draws == forwardDraws && vertexBuffer->getVulkanBuffer() == forwardVertexBuffer && indexBuffer->getVulkanBuffer() == forwardIndexBuffer)
+	{
+		return;
+	}
+	forwardDraws = draws;
+	forwardVertexBuffer = vertexBuffer->getVulkanBuffer();
+	forwardIndexBuffer = indexBuffer->getVulkanBuffer();
+	commandBufferCache->invalidate();
+}
+
+const MeshLod LogicalDevice::selectMeshLod(const GeometryRange& geometryRange) const
+{
+	const LodSelector lodSelector{ static_cast<float>(swapChain->getExtent().height), camera.getVerticalFieldOfView(), maximumLodPixelError };
+	const float distance{ std::max(glm::distance(camera.getPosition(), geometryRange.boundsCenter) - geometryRange.boundsRadius, 0.0f) };
+	return geometryRange.lods[lodSelector.select(geometryRange.lods, distance)];
+}
+
+void LogicalDevice::recordRenderGraph()
+{
+	TRACE_ZONE("RecordRenderGraph");
+	const uint32_t slotIndex{ getCommandRecordingSlotIndex() };
+	const CommandBufferCacheKey commandBufferCacheKey{ buildCommandBufferCacheKey() };
+	if (renderSettings.isCommandBufferCachingEnabled)
+	{
+		const std::optional<std::vector<vk::CommandBuffer>> cachedCommandBuffers{ commandBufferCache->find(slotIndex, commandBufferCacheKey) };
+		if (cachedCommandBuffers)
+		{
+			segmentVulkanCommandBuffers = cachedCommandBuffers.value();
+			return;
+		}
+	}
+	graphicsCommandRecorder->beginFrame(slotIndex);
+	if (computeCommandRecorder)
+	{
+		computeCommandRecorder->beginFrame(slotIndex);
+	}
+	segmentVulkanCommandBuffers.clear();
+	const std::vector<RenderGraphSegment>& segments{ renderGraph->getSegments() };
+	for (uint32_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex)
+	{
+		ParallelCommandRecorder& parallelCommandRecorder{ segments[segmentIndex].queue == RenderGraphQueue::eCompute ? *computeCommandRecorder : *graphicsCommandRecorder };
+		const vk::CommandBuffer vulkanCommandBuffer{ parallelCommandRecorder.beginPrimaryCommandBuffer() };
+		renderGraph->execute(segmentIndex, vulkanCommandBuffer);
+		vulkanCommandBuffer.end();
+		segmentVulkanCommandBuffers.push_back(vulkanCommandBuffer);
+	}
+	if (renderSettings.isCommandBufferCachingEnabled)
+	{
+		commandBufferCache->store(slotIndex, commandBufferCacheKey, segmentVulkanCommandBuffers);
+	}
+}
+
+const CommandBufferCacheKey LogicalDevice::buildCommandBufferCacheKey() const
+{
+	return CommandBufferCacheKey{
+		.vulkanUniformDescriptorSet = uniformRing->getVulkanDescriptorSet(),
+		.uniformDynamicOffset = uniformDynamicOffset,
+		.vulkanBindlessDescriptorSet = bindlessDescriptorHeap->getVulkanDescriptorSet()
+	};
+}
+
+void LogicalDevice::submitRenderGraph()
+{
+	TRACE_ZONE("SubmitRenderGraph");
+	const std::vector<RenderGraphSegment>& segments{ renderGraph->getSegments() };
+	const uint32_t firstGraphicsSegmentIndex{ findFirstSegmentIndex(RenderGraphQueue::eGraphics) };
+	const uint32_t lastGraphicsSegmentIndex{ findLastSegmentIndex(RenderGraphQueue::eGraphics) };
+	const uint32_t lastComputeSegmentIndex{ findLastSegmentIndex(RenderGraphQueue::eCompute) };
+	assignSegmentSignalValues();
+	for (uint32_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex)
+	{
+		const QueueSubmitInfo queueSubmitInfo{ buildSegmentSubmitInfo(segmentIndex, firstGraphicsSegmentIndex, lastGraphicsSegmentIndex, lastComputeSegmentIndex) };
+		if (segments[segmentIndex].queue == RenderGraphQueue::eCompute)
+		{
+			computeQueue->submit(queueSubmitInfo);
+		}
+		else
+		{
+			graphicsQueue->submit(queueSubmitInfo);
+		}
+	}
+}
+
+void LogicalDevice::assignSegmentSignalValues()
+{
+	segmentSignalValues.clear();
+	for (const auto& segment : renderGraph->getSegments())
+	{
+		uint64_t& renderGraphSemaphoreValue{ segment.queue == RenderGraphQueue::eCompute ? computeRenderGraphSemaphoreValue : graphicsRenderGraphSemaphoreValue };
+		segmentSignalValues.push_back(++renderGraphSemaphoreValue);
+	}
+}
+
+const QueueSubmitInfo LogicalDevice::buildSegmentSubmitInfo(const uint32_t segmentIndex, const uint32_t firstGraphicsSegmentIndex, const uint32_t lastGraphicsSegmentIndex, const uint32_t lastComputeSegmentIndex) const
+{
+	const std::vector<RenderGraphSegment>& segments{ renderGraph->getSegments() };
+	const vk::Semaphore vulkanRenderGraphSemaphore{ getRenderGraphSemaphore(segments[segmentIndex].queue) };
+	QueueSubmitInfo queueSubmitInfo{
+		.vulkanCommandBuffer = segmentVulkanCommandBuffers[segmentIndex],
+		.signalSemaphores = { vulkanRenderGraphSemaphore },
+		.signalValues = { segmentSignalValues[segmentIndex] }
+	};
+	const auto addWait = [&](const vk::Semaphore& vulkanSemaphore, const uint64_t value, const vk::PipelineStageFlags stageMask)
+	{
+		queueSubmitInfo.waitSemaphores.push_back(vulkanSemaphore);
+		queueSubmitInfo.waitValues.push_back(value);
+		queueSubmitInfo.waitStageMasks.push_back(stageMask);
 	};
+	if (segmentIndex == firstGraphicsSegmentIndex)
+	{
+		addWait(synchronizationObjects[currentFrame]->imageAvailable, 0, vk::PipelineStageFlagBits::eColorAttachmentOutput);
+		addWait(uploadManager->getVulkanTimelineSemaphore(), getRequiredUploadTimelineValue(), vk::PipelineStageFlagBits::eVertexInput);
+	}
+	else if (segments[segmentIndex].queue == RenderGraphQueue::eGraphics)
+	{
+		addWait(vulkanRenderGraphSemaphore, segmentSignalValues[segmentIndex] - 1, vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eColorAttachmentOutput);
+	}
+	for (const auto& wait : segments[segmentIndex].waits)
+	{
+		addWait(getRenderGraphSemaphore(segments[wait.segmentIndex].queue), segmentSignalValues[wait.segmentIndex], wait.stageMask);
+	}
+	if (segmentIndex == lastGraphicsSegmentIndex)
+	{
+		if (lastComputeSegmentIndex < segments.size())
+		{
+			addWait(computeRenderGraphSemaphore->getVulkanSemaphore(), segmentSignalValues[lastComputeSegmentIndex], vk::PipelineStageFlagBits::eAllCommands);
+		}
+		queueSubmitInfo.signalSemaphores.push_back(synchronizationObjects[currentFrame]->renderFinished);
+		queueSubmitInfo.signalValues.push_back(0);
+		queueSubmitInfo.vulkanFence = synchronizationObjects[currentFrame]->inFlight;
+	}
+	return queueSubmitInfo;
+}
+
+const uint32_t LogicalDevice::findFirstSegmentIndex(const RenderGraphQueue queue) const
+{
+	const std::vector<RenderGraphSegment>& segments{ renderGraph->getSegments() };
+	const auto segment{ std::find_if(segments.begin(), segments.end(), [&](const RenderGraphSegment& segment) { return segment.queue == queue; }) };
+	return static_cast<uint32_t>(std::distance(segments.begin(), segment));
+}
+
+const uint32_t LogicalDevice::findLastSegmentIndex(const RenderGraphQueue queue) const
+{
+	const std::vector<RenderGraphSegment>& segments{ renderGraph->getSegments() };
+	const auto segment{ std::find_if(segments.rbegin(), segments.rend(), [&](const RenderGraphSegment& segment) { return segment.queue == queue; }) };
+	return segment == segments.rend() ? static_cast<uint32_t>(segments.size()) : static_cast<uint32_t>(std::distance(segment, segments.rend()) - 1);
+}
+
+const vk::Semaphore LogicalDevice::getRenderGraphSemaphore(const RenderGraphQueue queue) const
+{
+	return queue == RenderGraphQueue::eCompute ? computeRenderGraphSemaphore->getVulkanSemaphore() : graphicsRenderGraphSemaphore->getVulkanSemaphore();
+}
+
+const uint64_t LogicalDevice::getRequiredUploadTimelineValue() const
+{
+	return std::max(vertexBuffer->getUploadTimelineValue(), indexBuffer->getUploadTimelineValue());
 }
 
 void LogicalDevice::presentResult(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents, const uint32_t imageIndex)
 {
+	TRACE_ZONE("Present");
 	vk::Result result;
 	try
 	{
 		result = presentQueue->presentResult(synchronizationObjects[currentFrame]->renderFinished, swapChain->getVulkanSwapChain(), imageIndex);
 	}
-	catch (vk::OutOfDateKHRError error)
+	catch (const vk::OutOfDateKHRError&)
 	{
 		result = vk::Result::eErrorOutOfDateKHR;
 	}
+	if (result == vk::Result::eSuccess && isFramebufferSizeDifferentFromSwapChainExtent(getFramebufferSize))
+	{
+		result = vk::Result::eSuboptimalKHR;
+	}
 	recreateSwapChainIfResultIsOutOfDateOrSuboptimalKHR(result, getFramebufferSize, waitEvents);
 	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to present the results!");
 }
@@ -247,4 +1065,8 @@ void LogicalDevice::presentResult(std::function<WindowSize()> getFramebufferSize
 void LogicalDevice::waitIdle()
 {
 	vulkanLogicalDevice.waitIdle();
+	if (gpuProfiler)
+	{
+		gpuProfiler->readAllFrames();
+	}
 }
\ No newline at end of file
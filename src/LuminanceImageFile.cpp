@@ -0,0 +1,72 @@
+#include "LuminanceImageFile.h"
+
+const LuminanceImage LuminanceImageFile::read(const std::filesystem::path& filePath)
+{
+	std::ifstream file(filePath, std::ios::binary);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! " + filePath.string() + " could not be opened");
+	}
+	std::string magicNumber;
+	uint32_t width, height, fileMaximumValue;
+	file >> magicNumber >> width >> height >> fileMaximumValue;
+	if (!file || magicNumber != "P5" || fileMaximumValue != maximumValue)
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! " + filePath.string() + " is not an 8-bit binary PGM image");
+	}
+	file.get();
+	std::vector<uint8_t> values(static_cast<size_t>(width) * height);
+	file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size()));
+	if (file.gcount() != static_cast<std::streamsize>(values.size()))
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! " + filePath.string() + " is truncated");
+	}
+	LuminanceImage luminanceImage{
+		.width = width,
+		.height = height,
+		.pixels = std::vector<float>(values.size())
+	};
+	std::transform(values.begin(), values.end(), luminanceImage.pixels.begin(), [](const uint8_t value) { return static_cast<float>(value) / maximumValue; });
+	return luminanceImage;
+}
+
+void LuminanceImageFile::write(const LuminanceImage& luminanceImage, const std::filesystem::path& filePath)
+{
+	std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! " + filePath.string() + " could not be written");
+	}
+	file << "P5\n" << luminanceImage.width << " " << luminanceImage.height << "\n" << maximumValue << "\n";
+	std::vector<uint8_t> values(luminanceImage.pixels.size());
+	std::transform(luminanceImage.pixels.begin(), luminanceImage.pixels.end(), values.begin(), quantize);
+	file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size()));
+}
+
+void LuminanceImageFile::writeDifferenceHeatmap(const LuminanceImage& referenceImage, const LuminanceImage& image, const std::filesystem::path& filePath, const float differenceScale)
+{
+	if (referenceImage.width != image.width || referenceImage.height != image.height)
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! Heatmap images must have the same size");
+	}
+	std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in LuminanceImageFile! " + filePath.string() + " could not be written");
+	}
+	file << "P6\n" << image.width << " " << image.height << "\n" << maximumValue << "\n";
+	std::vector<uint8_t> colors(3 * image.pixels.size());
+	for (size_t pixelIndex = 0; pixelIndex < image.pixels.size(); ++pixelIndex)
+	{
+		const float heat{ std::clamp(std::abs(referenceImage.pixels[pixelIndex] - image.pixels[pixelIndex]) * differenceScale, 0.0f, 1.0f) };
+		colors[3 * pixelIndex] = quantize(3.0f * heat);
+		colors[3 * pixelIndex + 1] = quantize(3.0f * heat - 1.0f);
+		colors[3 * pixelIndex + 2] = quantize(3.0f * heat - 2.0f);
+	}
+	file.write(reinterpret_cast<const char*>(colors.data()), static_cast<std::streamsize>(colors.size()));
+}
+
+const uint8_t LuminanceImageFile::quantize(const float value)
+{
+	return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * maximumValue));
+}
\ No newline at end of file
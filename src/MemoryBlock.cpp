@@ -0,0 +1,70 @@
+#include "MemoryBlock.h"
+
+MemoryBlock::MemoryBlock(const MemoryBlockCreateInfo& memoryBlockCreateInfo) : vulkanLogicalDevice(memoryBlockCreateInfo.vulkanLogicalDevice),
+	tlsfAllocator(memoryBlockCreateInfo.size), memoryTypeIndex(memoryBlockCreateInfo.memoryTypeIndex),
+	memoryResourceType(memoryBlockCreateInfo.memoryResourceType), dedicated(memoryBlockCreateInfo.isDedicated)
+{
+	vulkanDeviceMemory = vulkanLogicalDevice.allocateMemory(buildMemoryAllocateInfo(memoryBlockCreateInfo));
+	if (memoryBlockCreateInfo.isHostVisible)
+	{
+		const vk::DeviceSize memoryOffset{ 0 };
+		mappedData = vulkanLogicalDevice.mapMemory(vulkanDeviceMemory, memoryOffset, VK_WHOLE_SIZE);
+	}
+}
+
+MemoryBlock::~MemoryBlock()
+{
+	if (mappedData)
+	{
+		vulkanLogicalDevice.unmapMemory(vulkanDeviceMemory);
+	}
+	vulkanLogicalDevice.freeMemory(vulkanDeviceMemory);
+}
+
+const vk::MemoryAllocateInfo MemoryBlock::buildMemoryAllocateInfo(const MemoryBlockCreateInfo& memoryBlockCreateInfo) const
+{
+	return vk::MemoryAllocateInfo{
+		.allocationSize = memoryBlockCreateInfo.size,
+		.memoryTypeIndex = memoryBlockCreateInfo.memoryTypeIndex
+	};
+}
+
+std::optional<TlsfAllocation> MemoryBlock::allocate(const vk::DeviceSize size, const vk::DeviceSize alignment)
+{
+	return tlsfAllocator.allocate(size, alignment);
+}
+
+void MemoryBlock::free(const uint32_t handle)
+{
+	tlsfAllocator.free(handle);
+}
+
+const vk::DeviceMemory MemoryBlock::getVulkanDeviceMemory() const
+{
+	return vulkanDeviceMemory;
+}
+
+void* MemoryBlock::getMappedData(const vk::DeviceSize offset) const
+{
+	return mappedData ? static_cast<char*>(mappedData) + offset : nullptr;
+}
+
+const uint32_t MemoryBlock::getMemoryTypeIndex() const
+{
+	return memoryTypeIndex;
+}
+
+const MemoryResourceType MemoryBlock::getMemoryResourceType() const
+{
+	return memoryResourceType;
+}
+
+const bool MemoryBlock::isDedicated() const
+{
+	return dedicated;
+}
+
+const TlsfAllocator& MemoryBlock::getTlsfAllocator() const
+{
+	return tlsfAllocator;
+}
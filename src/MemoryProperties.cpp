@@ -2,16 +2,61 @@
 
 uint32_t MemoryProperties::findMemoryType(const vk::PhysicalDevice& vulkanPhysicalDevice, uint32_t memoryTypeFilter, vk::MemoryPropertyFlags memoryPropertyFlags)
 {
-    const vk::PhysicalDeviceMemoryProperties physicalDeviceMemoryProperties{ vulkanPhysicalDevice.getMemoryProperties() };
+    const std::vector<uint32_t> memoryTypeIndices{ rankMemoryTypes(vulkanPhysicalDevice.getMemoryProperties(), memoryTypeFilter, memoryPropertyFlags, vk::MemoryPropertyFlags{}) };
+    if (memoryTypeIndices.empty())
+    {
+        throw std::runtime_error("Failed to find suitable memory type!");
+    }
+    return memoryTypeIndices.front();
+}
+
+std::vector<uint32_t> MemoryProperties::rankMemoryTypes(const vk::PhysicalDeviceMemoryProperties& physicalDeviceMemoryProperties, uint32_t memoryTypeFilter, vk::MemoryPropertyFlags requiredMemoryPropertyFlags, vk::MemoryPropertyFlags preferredMemoryPropertyFlags)
+{
+    vk::DeviceSize largestHeapSize{ 0 };
+    std::vector<MemoryTypeScore> memoryTypeScores;
     for (uint32_t i = 0; i < physicalDeviceMemoryProperties.memoryTypeCount; i++)
     {
-        if (memoryTypeFilter & (1 << i))
+        const vk::MemoryType& memoryType{ physicalDeviceMemoryProperties.memoryTypes[i] };
+        if ((memoryTypeFilter & (1 << i)) && (memoryType.propertyFlags & requiredMemoryPropertyFlags) == requiredMemoryPropertyFlags)
         {
-            if ((physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & memoryPropertyFlags) == memoryPropertyFlags)
-            {
-                return i;
-            }
+            const vk::DeviceSize heapSize{ physicalDeviceMemoryProperties.memoryHeaps[memoryType.heapIndex].size };
+            largestHeapSize = std::max(largestHeapSize, heapSize);
+            memoryTypeScores.push_back(MemoryTypeScore{
+                .memoryTypeIndex = i,
+                .preferredFlagCount = countFlags(memoryType.propertyFlags & preferredMemoryPropertyFlags),
+                .unwantedFlagCount = countFlags(memoryType.propertyFlags & ~(requiredMemoryPropertyFlags | preferredMemoryPropertyFlags)),
+                .heapSize = heapSize
+            });
         }
     }
-    throw std::runtime_error("Failed to find suitable memory type!");
+    for (auto& memoryTypeScore : memoryTypeScores)
+    {
+        if (memoryTypeScore.heapSize < largestHeapSize / 2)
+        {
+            memoryTypeScore.preferredFlagCount = 0;
+        }
+    }
+    std::stable_sort(memoryTypeScores.begin(), memoryTypeScores.end(), [](const MemoryTypeScore& a, const MemoryTypeScore& b)
+    {
+        if (a.preferredFlagCount != b.preferredFlagCount)
+        {
+            return a.preferredFlagCount > b.preferredFlagCount;
+        }
+        if (a.unwantedFlagCount != b.unwantedFlagCount)
+        {
+            return a.unwantedFlagCount < b.unwantedFlagCount;
+        }
+        return a.heapSize > b.heapSize;
+    });
+    std::vector<uint32_t> memoryTypeIndices;
+    for (const auto& memoryTypeScore : memoryTypeScores)
+    {
+        memoryTypeIndices.push_back(memoryTypeScore.memoryTypeIndex);
+    }
+    return memoryTypeIndices;
+}
+
+int MemoryProperties::countFlags(vk::MemoryPropertyFlags memoryPropertyFlags)
+{
+    return std::popcount(static_cast<uint32_t>(static_cast<VkMemoryPropertyFlags>(memoryPropertyFlags)));
 }
\ No newline at end of file
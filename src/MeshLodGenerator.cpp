@@ -0,0 +1,48 @@
+#include "MeshLodGenerator.h"
+
+void MeshLodGenerator::generate(std::vector<Mesh>& meshes, ThreadPool& threadPool) const
+{
+	std::vector<std::future<void>> generatedMeshes;
+	generatedMeshes.reserve(meshes.size());
+	for (auto& mesh : meshes)
+	{
+		generatedMeshes.push_back(threadPool.submit([this, &mesh]() { generate(mesh); }));
+	}
+	for (auto& generatedMesh : generatedMeshes)
+	{
+		generatedMesh.get();
+	}
+}
+
+void MeshLodGenerator::generate(Mesh& mesh) const
+{
+	mesh.lods.clear();
+	mesh.lods.push_back(MeshLod{
+		.firstIndex = 0,
+		.indexCount = static_cast<uint32_t>(mesh.indices.size()),
+		.error = 0.0f
+	});
+	std::vector<uint32_t> previousIndices{ mesh.indices };
+	while (mesh.lods.size() < maximumLodCount && previousIndices.size() > minimumIndexCount)
+	{
+		const size_t targetIndexCount{ static_cast<size_t>(previousIndices.size() * reductionRatio) / 3 * 3 };
+		MeshSimplifier meshSimplifier{ mesh.vertices, previousIndices };
+		const SimplificationResult simplificationResult{ meshSimplifier.simplify(targetIndexCount) };
+		if (!isReductionSufficient(previousIndices.size(), simplificationResult.indices.size()))
+		{
+			break;
+		}
+		mesh.lods.push_back(MeshLod{
+			.firstIndex = static_cast<uint32_t>(mesh.indices.size()),
+			.indexCount = static_cast<uint32_t>(simplificationResult.indices.size()),
+			.error = mesh.lods.back().error + simplificationResult.error
+		});
+		mesh.indices.insert(mesh.indices.end(), simplificationResult.indices.begin(), simplificationResult.indices.end());
+		previousIndices = simplificationResult.indices;
+	}
+}
+
+const bool MeshLodGenerator::isReductionSufficient(const size_t previousIndexCount, const size_t simplifiedIndexCount) const
+{
+	return simplifiedIndexCount > 0 && simplifiedIndexCount <= previousIndexCount * minimumReduction;
+}
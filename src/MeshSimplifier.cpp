@@ -0,0 +1,275 @@
+#include "MeshSimplifier.h"
+
+MeshSimplifier::MeshSimplifier(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) : vertices(vertices)
+{
+	weldVertices();
+	buildTriangles(indices);
+	buildQuadrics();
+	buildBoundaries();
+	vertexVersions.assign(vertices.size(), 0);
+	isVertexCollapsed.assign(vertices.size(), false);
+}
+
+void MeshSimplifier::weldVertices()
+{
+	std::vector<uint32_t> sortedVertices(vertices.size());
+	std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+	const auto isPositionLess = [this](const uint32_t left, const uint32_t right)
+	{
+		const glm::vec3& leftPosition{ vertices[left].position };
+		const glm::vec3& rightPosition{ vertices[right].position };
+		if (leftPosition.x != rightPosition.x) return leftPosition.x < rightPosition.x;
+		if (leftPosition.y != rightPosition.y) return leftPosition.y < rightPosition.y;
+		if (leftPosition.z != rightPosition.z) return leftPosition.z < rightPosition.z;
+		return left < right;
+	};
+	std::sort(sortedVertices.begin(), sortedVertices.end(), isPositionLess);
+	canonicalVertices.resize(vertices.size());
+	for (size_t sortedIndex = 0; sortedIndex < sortedVertices.size(); ++sortedIndex)
+	{
+		const uint32_t vertex{ sortedVertices[sortedIndex] };
+		const bool isDuplicate{ sortedIndex > 0 && vertices[sortedVertices[sortedIndex - 1]].position == vertices[vertex].position };
+		canonicalVertices[vertex] = isDuplicate ? canonicalVertices[sortedVertices[sortedIndex - 1]] : vertex;
+	}
+}
+
+void MeshSimplifier::buildTriangles(const std::vector<uint32_t>& indices)
+{
+	vertexTriangles.resize(vertices.size());
+	for (size_t index = 0; index + 2 < indices.size(); index += 3)
+	{
+		const std::array<uint32_t, 3> originalTriangle{ indices[index], indices[index + 1], indices[index + 2] };
+		const std::array<uint32_t, 3> triangle{ canonicalVertices[originalTriangle[0]], canonicalVertices[originalTriangle[1]], canonicalVertices[originalTriangle[2]] };
+		const bool isDegenerate{ triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2] };
+		const uint32_t triangleIndex{ static_cast<uint32_t>(triangles.size()) };
+		originalTriangles.push_back(originalTriangle);
+		triangles.push_back(triangle);
+		isTriangleAlive.push_back(!isDegenerate);
+		if (!isDegenerate)
+		{
+			++aliveTriangleCount;
+			for (const uint32_t vertex : triangle)
+			{
+				vertexTriangles[vertex].push_back(triangleIndex);
+			}
+		}
+	}
+}
+
+void MeshSimplifier::buildQuadrics()
+{
+	quadrics.resize(vertices.size());
+	for (size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex)
+	{
+		if (!isTriangleAlive[triangleIndex])
+		{
+			continue;
+		}
+		const std::array<uint32_t, 3>& triangle{ triangles[triangleIndex] };
+		const glm::vec3 normal{ computeTriangleNormal(triangle) };
+		const float doubleArea{ glm::length(normal) };
+		if (doubleArea <= 0.0f)
+		{
+			continue;
+		}
+		const glm::vec3 unitNormal{ normal / doubleArea };
+		const Quadric quadric{ unitNormal, -glm::dot(unitNormal, vertices[triangle[0]].position), doubleArea * 0.5f };
+		for (const uint32_t vertex : triangle)
+		{
+			quadrics[vertex] += quadric;
+		}
+	}
+}
+
+void MeshSimplifier::buildBoundaries()
+{
+	std::vector<std::pair<uint64_t, uint32_t>> halfEdges;
+	for (size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex)
+	{
+		if (!isTriangleAlive[triangleIndex])
+		{
+			continue;
+		}
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			const uint32_t from{ triangles[triangleIndex][corner] };
+			const uint32_t to{ triangles[triangleIndex][(corner + 1) % 3] };
+			const uint64_t edgeKey{ (static_cast<uint64_t>(std::min(from, to)) << 32) | std::max(from, to) };
+			halfEdges.emplace_back(edgeKey, static_cast<uint32_t>(triangleIndex));
+		}
+	}
+	std::sort(halfEdges.begin(), halfEdges.end());
+	isBoundaryVertex.assign(vertices.size(), false);
+	for (size_t edgeIndex = 0; edgeIndex < halfEdges.size(); ++edgeIndex)
+	{
+		const bool hasPrevious{ edgeIndex > 0 && halfEdges[edgeIndex - 1].first == halfEdges[edgeIndex].first };
+		const bool hasNext{ edgeIndex + 1 < halfEdges.size() && halfEdges[edgeIndex + 1].first == halfEdges[edgeIndex].first };
+		if (hasPrevious || hasNext)
+		{
+			continue;
+		}
+		const uint32_t first{ static_cast<uint32_t>(halfEdges[edgeIndex].first >> 32) };
+		const uint32_t second{ static_cast<uint32_t>(halfEdges[edgeIndex].first & 0xFFFFFFFFu) };
+		const glm::vec3 edge{ vertices[second].position - vertices[first].position };
+		const glm::vec3 triangleNormal{ computeTriangleNormal(triangles[halfEdges[edgeIndex].second]) };
+		const glm::vec3 boundaryNormal{ glm::cross(edge, triangleNormal) };
+		const float boundaryNormalLength{ glm::length(boundaryNormal) };
+		isBoundaryVertex[first] = true;
+		isBoundaryVertex[second] = true;
+		if (boundaryNormalLength <= 0.0f)
+		{
+			continue;
+		}
+		const glm::vec3 unitBoundaryNormal{ boundaryNormal / boundaryNormalLength };
+		const Quadric quadric{ unitBoundaryNormal, -glm::dot(unitBoundaryNormal, vertices[first].position), glm::dot(edge, edge) * boundaryWeight };
+		quadrics[first] += quadric;
+		quadrics[second] += quadric;
+	}
+}
+
+const glm::vec3 MeshSimplifier::computeTriangleNormal(const std::array<uint32_t, 3>& triangle) const
+{
+	const glm::vec3& position0{ vertices[triangle[0]].position };
+	return glm::cross(vertices[triangle[1]].position - position0, vertices[triangle[2]].position - position0);
+}
+
+const SimplificationResult MeshSimplifier::simplify(const size_t targetIndexCount)
+{
+	for (uint32_t vertex = 0; vertex < vertices.size(); ++vertex)
+	{
+		for (const uint32_t triangleIndex : vertexTriangles[vertex])
+		{
+			for (const uint32_t neighbour : triangles[triangleIndex])
+			{
+				if (neighbour != vertex)
+				{
+					pushCollapse(vertex, neighbour);
+				}
+			}
+		}
+	}
+	float maximumError{ 0.0f };
+	while (aliveTriangleCount * 3 > targetIndexCount && !edgeCollapses.empty())
+	{
+		const EdgeCollapse edgeCollapse{ edgeCollapses.top() };
+		edgeCollapses.pop();
+		if (!isCollapseValid(edgeCollapse))
+		{
+			continue;
+		}
+		applyCollapse(edgeCollapse);
+		maximumError = std::max(maximumError, edgeCollapse.cost);
+	}
+	return SimplificationResult{
+		.indices = buildIndices(),
+		.error = std::sqrt(maximumError)
+	};
+}
+
+void MeshSimplifier::pushCollapse(const uint32_t from, const uint32_t to)
+{
+	if (isBoundaryVertex[from] && !isBoundaryVertex[to])
+	{
+		return;
+	}
+	Quadric quadric{ quadrics[from] };
+	quadric += quadrics[to];
+	edgeCollapses.push(EdgeCollapse{
+		.cost = quadric.evaluate(vertices[to].position),
+		.from = from,
+		.to = to,
+		.fromVersion = vertexVersions[from],
+		.toVersion = vertexVersions[to]
+	});
+}
+
+void MeshSimplifier::pushCollapsesAroundVertex(const uint32_t vertex)
+{
+	std::vector<uint32_t>& triangleList{ vertexTriangles[vertex] };
+	std::sort(triangleList.begin(), triangleList.end());
+	triangleList.erase(std::unique(triangleList.begin(), triangleList.end()), triangleList.end());
+	triangleList.erase(std::remove_if(triangleList.begin(), triangleList.end(), [this](const uint32_t triangleIndex) { return !isTriangleAlive[triangleIndex]; }), triangleList.end());
+	for (const uint32_t triangleIndex : triangleList)
+	{
+		for (const uint32_t neighbour : triangles[triangleIndex])
+		{
+			if (neighbour != vertex)
+			{
+				pushCollapse(vertex, neighbour);
+				pushCollapse(neighbour, vertex);
+			}
+		}
+	}
+}
+
+const bool MeshSimplifier::isCollapseValid(const EdgeCollapse& edgeCollapse) const
+{
+	if (isVertexCollapsed[edgeCollapse.from] || isVertexCollapsed[edgeCollapse.to]
+		|| vertexVersions[edgeCollapse.from] != edgeCollapse.fromVersion || vertexVersions[edgeCollapse.to] != edgeCollapse.toVersion)
+	{
+		return false;
+	}
+	for (const uint32_t triangleIndex : vertexTriangles[edgeCollapse.from])
+	{
+		const std::array<uint32_t, 3>& triangle{ triangles[triangleIndex] };
+		if (!isTriangleAlive[triangleIndex] || std::find(triangle.begin(), triangle.end(), edgeCollapse.to) != triangle.end())
+		{
+			continue;
+		}
+		std::array<uint32_t, 3> collapsedTriangle{ triangle };
+		std::replace(collapsedTriangle.begin(), collapsedTriangle.end(), edgeCollapse.from, edgeCollapse.to);
+		if (glm::dot(computeTriangleNormal(triangle), computeTriangleNormal(collapsedTriangle)) <= 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void MeshSimplifier::applyCollapse(const EdgeCollapse& edgeCollapse)
+{
+	isVertexCollapsed[edgeCollapse.from] = true;
+	quadrics[edgeCollapse.to] += quadrics[edgeCollapse.from];
+	++vertexVersions[edgeCollapse.from];
+	++vertexVersions[edgeCollapse.to];
+	for (const uint32_t triangleIndex : vertexTriangles[edgeCollapse.from])
+	{
+		if (!isTriangleAlive[triangleIndex])
+		{
+			continue;
+		}
+		std::array<uint32_t, 3>& triangle{ triangles[triangleIndex] };
+		std::replace(triangle.begin(), triangle.end(), edgeCollapse.from, edgeCollapse.to);
+		if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+		{
+			isTriangleAlive[triangleIndex] = false;
+			--aliveTriangleCount;
+		}
+		else
+		{
+			vertexTriangles[edgeCollapse.to].push_back(triangleIndex);
+		}
+	}
+	vertexTriangles[edgeCollapse.from].clear();
+	pushCollapsesAroundVertex(edgeCollapse.to);
+}
+
+const std::vector<uint32_t> MeshSimplifier::buildIndices() const
+{
+	std::vector<uint32_t> indices;
+	indices.reserve(aliveTriangleCount * 3);
+	for (size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex)
+	{
+		if (!isTriangleAlive[triangleIndex])
+		{
+			continue;
+		}
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			const uint32_t originalVertex{ originalTriangles[triangleIndex][corner] };
+			const bool isOriginalVertexKept{ canonicalVertices[originalVertex] == triangles[triangleIndex][corner] };
+			indices.push_back(isOriginalVertexKept ? originalVertex : triangles[triangleIndex][corner]);
+		}
+	}
+	return indices;
+}
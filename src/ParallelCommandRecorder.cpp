@@ -0,0 +1,94 @@
+#include "ParallelCommandRecorder.h"
+
+ParallelCommandRecorder::ParallelCommandRecorder(const ParallelCommandRecorderCreateInfo& parallelCommandRecorderCreateInfo) : vulkanLogicalDevice(parallelCommandRecorderCreateInfo.vulkanLogicalDevice),
+	queueFamilyIndex(parallelCommandRecorderCreateInfo.queueFamilyIndex), threadCount(std::max(parallelCommandRecorderCreateInfo.threadCount, 1u)),
+	minimumItemsPerCommandBuffer(std::max<size_t>(parallelCommandRecorderCreateInfo.minimumItemsPerCommandBuffer, 1)),
+	usageFlags(parallelCommandRecorderCreateInfo.isReusable ? vk::CommandBufferUsageFlags{} : vk::CommandBufferUsageFlags{ vk::CommandBufferUsageFlagBits::eOneTimeSubmit })
+{
+	reserveFrames(parallelCommandRecorderCreateInfo.frameCount);
+	statistics.threadCount = threadCount;
+}
+
+void ParallelCommandRecorder::reserveFrames(const int frameCount)
+{
+	const vk::CommandPoolCreateFlags commandPoolCreateFlags{ vk::CommandPoolCreateFlagBits::eTransient };
+	for (int frameIndex = static_cast<int>(primaryCommandPools.size()); frameIndex < frameCount; ++frameIndex)
+	{
+		primaryCommandPools.push_back(CommandPoolSlot{ .commandPool = std::make_unique<CommandPool>(vulkanLogicalDevice, queueFamilyIndex, commandPoolCreateFlags) });
+		secondaryCommandPools.emplace_back(threadCount);
+		for (auto& secondaryCommandPool : secondaryCommandPools.back())
+		{
+			secondaryCommandPool.commandPool = std::make_unique<CommandPool>(vulkanLogicalDevice, queueFamilyIndex, commandPoolCreateFlags);
+		}
+	}
+}
+
+void ParallelCommandRecorder::beginFrame(const int frameIndex)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(frameIndex, primaryCommandPools.size(), "Error in ParallelCommandRecorder! Frame index is out of bounds");
+	currentFrameIndex = frameIndex;
+	primaryCommandPools[frameIndex].commandPool->reset();
+	primaryCommandPools[frameIndex].usedCommandBufferCount = 0;
+	for (auto& secondaryCommandPool : secondaryCommandPools[frameIndex])
+	{
+		secondaryCommandPool.commandPool->reset();
+		secondaryCommandPool.usedCommandBufferCount = 0;
+	}
+}
+
+const vk::CommandBuffer ParallelCommandRecorder::beginPrimaryCommandBuffer()
+{
+	const vk::CommandBuffer vulkanPrimaryCommandBuffer{ acquireCommandBuffer(primaryCommandPools[currentFrameIndex], vk::CommandBufferLevel::ePrimary) };
+	vulkanPrimaryCommandBuffer.begin(vk::CommandBufferBeginInfo{ .flags = usageFlags });
+	return vulkanPrimaryCommandBuffer;
+}
+
+void ParallelCommandRecorder::recordSecondaryCommandBuffers(const vk::CommandBuffer& vulkanPrimaryCommandBuffer, const vk::CommandBufferInheritanceInfo& commandBufferInheritanceInfo, const size_t itemCount,
+	const std::function<void(const vk::CommandBuffer&, const size_t, const size_t)>& recordItems, ThreadPool& threadPool)
+{
+	if (itemCount == 0)
+	{
+		return;
+	}
+	const auto start{ std::chrono::steady_clock::now() };
+	std::vector<CommandPoolSlot>& frameCommandPools{ secondaryCommandPools[currentFrameIndex] };
+	const size_t commandBufferCount{ std::min(frameCommandPools.size(), (itemCount + minimumItemsPerCommandBuffer - 1) / minimumItemsPerCommandBuffer) };
+	const size_t itemsPerCommandBuffer{ (itemCount + commandBufferCount - 1) / commandBufferCount };
+	std::vector<vk::CommandBuffer> vulkanSecondaryCommandBuffers((itemCount + itemsPerCommandBuffer - 1) / itemsPerCommandBuffer);
+	threadPool.parallelFor(itemCount, itemsPerCommandBuffer, [&](const size_t commandBufferIndex, const size_t firstItem, const size_t lastItem)
+	{
+		TRACE_ZONE("RecordSecondaryCommandBuffer");
+		const vk::CommandBuffer vulkanSecondaryCommandBuffer{ acquireCommandBuffer(frameCommandPools[commandBufferIndex], vk::CommandBufferLevel::eSecondary) };
+		vulkanSecondaryCommandBuffer.begin(vk::CommandBufferBeginInfo{
+			.flags = usageFlags | vk::CommandBufferUsageFlagBits::eRenderPassContinue,
+			.pInheritanceInfo = &commandBufferInheritanceInfo
+		});
+		recordItems(vulkanSecondaryCommandBuffer, firstItem, lastItem);
+		vulkanSecondaryCommandBuffer.end();
+		vulkanSecondaryCommandBuffers[commandBufferIndex] = vulkanSecondaryCommandBuffer;
+	});
+	vulkanPrimaryCommandBuffer.executeCommands(vulkanSecondaryCommandBuffers);
+	++statistics.recordedFrameCount;
+	statistics.itemCount = itemCount;
+	statistics.secondaryCommandBufferCount = vulkanSecondaryCommandBuffers.size();
+	statistics.recordingMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+const vk::CommandBuffer ParallelCommandRecorder::acquireCommandBuffer(CommandPoolSlot& commandPoolSlot, const vk::CommandBufferLevel level)
+{
+	if (commandPoolSlot.usedCommandBufferCount == commandPoolSlot.vulkanCommandBuffers.size())
+	{
+		const vk::CommandBufferAllocateInfo commandBufferAllocateInfo{
+			.commandPool = commandPoolSlot.commandPool->getVulkanCommandPool(),
+			.level = level,
+			.commandBufferCount = 1
+		};
+		commandPoolSlot.vulkanCommandBuffers.push_back(vulkanLogicalDevice.allocateCommandBuffers(commandBufferAllocateInfo).front());
+	}
+	return commandPoolSlot.vulkanCommandBuffers[commandPoolSlot.usedCommandBufferCount++];
+}
+
+const CommandRecordingStatistics ParallelCommandRecorder::getStatistics() const
+{
+	return statistics;
+}
\ No newline at end of file
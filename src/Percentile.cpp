@@ -0,0 +1,17 @@
+#include "Percentile.h"
+
+const double Percentile::compute(const std::vector<double>& sortedValues, const double percentile)
+{
+	if (sortedValues.empty())
+	{
+		return 0.0;
+	}
+	const size_t rank{ static_cast<size_t>(std::ceil(percentile / 100.0 * sortedValues.size())) };
+	return sortedValues[std::clamp<size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+const std::vector<double> Percentile::sort(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	return values;
+}
\ No newline at end of file
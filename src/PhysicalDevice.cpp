@@ -54,8 +54,8 @@ std::unique_ptr<LogicalDevice> PhysicalDevice::createLogicalDevice(const Logical
 		.framebufferSize = logicalDevicePartialCreateInfo.framebufferSize,
 		.enabledLayerCount = logicalDevicePartialCreateInfo.enabledLayerCount,
 		.enabledLayerNames = logicalDevicePartialCreateInfo.enabledLayerNames,
-		.vertices = logicalDevicePartialCreateInfo.vertices,
-		.indices = logicalDevicePartialCreateInfo.indices
+		.mesh = logicalDevicePartialCreateInfo.mesh,
+		.renderSettings = logicalDevicePartialCreateInfo.renderSettings
 	};
 	return std::make_unique<LogicalDevice>(logicalDeviceCreateInfo);
 }
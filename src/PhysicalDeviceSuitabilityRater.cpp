@@ -7,6 +7,7 @@ const int PhysicalDeviceSuitabilityRater::rate(const PhysicalDeviceSuitabilityRa
 	score += rateByQueueFamilyProperties(physicalDeviceSuitabilityRaterInfo);
 	score *= rateByDeviceExtensionSupport(physicalDeviceSuitabilityRaterInfo);
 	score *= rateBySwapChainProperties(physicalDeviceSuitabilityRaterInfo);
+	score *= rateByTimelineSemaphoreSupport(physicalDeviceSuitabilityRaterInfo);
 	return score;
 }
 
@@ -40,6 +41,8 @@ const int PhysicalDeviceSuitabilityRater::rateByQueueFamilyProperties(const Phys
 	};
 	score += 1000 * static_cast<int>(queueFamilyIndices.getGraphicsFamilyIndex().has_value());
 	score += 1000 * static_cast<int>(queueFamilyIndices.getPresentFamilyIndex().has_value());
+	score += 100 * static_cast<int>(queueFamilyIndices.getTransferFamilyIndex().has_value());
+	score += 100 * static_cast<int>(queueFamilyIndices.getComputeFamilyIndex().has_value());
 	return score;
 }
 
@@ -57,4 +60,14 @@ const int PhysicalDeviceSuitabilityRater::rateByDeviceExtensionSupport(const Phy
 const int PhysicalDeviceSuitabilityRater::rateBySwapChainProperties(const PhysicalDeviceSuitabilityRaterInfo& physicalDeviceSuitabilityRaterInfo) const
 {
 	return SwapChain::isValid(physicalDeviceSuitabilityRaterInfo.vulkanPhysicalDevice, physicalDeviceSuitabilityRaterInfo.vulkanWindowSurface);
+}
+
+const int PhysicalDeviceSuitabilityRater::rateByTimelineSemaphoreSupport(const PhysicalDeviceSuitabilityRaterInfo& physicalDeviceSuitabilityRaterInfo) const
+{
+	if (physicalDeviceSuitabilityRaterInfo.vulkanPhysicalDevice.getProperties().apiVersion < VK_API_VERSION_1_2)
+	{
+		return 0;
+	}
+	const auto physicalDeviceFeatures{ physicalDeviceSuitabilityRaterInfo.vulkanPhysicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>() };
+	return static_cast<int>(physicalDeviceFeatures.get<vk::PhysicalDeviceVulkan12Features>().timelineSemaphore);
 }
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "PipelineCache.h"
+
+PipelineCache::PipelineCache(const PipelineCacheCreateInfo& pipelineCacheCreateInfo) : vulkanLogicalDevice(pipelineCacheCreateInfo.vulkanLogicalDevice)
+{
+	const auto physicalDeviceProperties{ pipelineCacheCreateInfo.vulkanPhysicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceIDProperties>() };
+	const vk::PhysicalDeviceProperties& properties{ physicalDeviceProperties.get<vk::PhysicalDeviceProperties2>().properties };
+	vendorID = properties.vendorID;
+	deviceID = properties.deviceID;
+	std::memcpy(pipelineCacheUUID.data(), properties.pipelineCacheUUID.data(), VK_UUID_SIZE);
+	filePath = buildFilePath(pipelineCacheCreateInfo.directory, properties, physicalDeviceProperties.get<vk::PhysicalDeviceIDProperties>());
+	const std::vector<char> cacheData{ load() };
+	pipelineCacheStatistics.isWarm = !cacheData.empty();
+	pipelineCacheStatistics.loadedBytes = cacheData.size();
+	pipelineCacheStatistics.savedBytes = cacheData.size();
+	const vk::PipelineCacheCreateInfo vulkanPipelineCacheCreateInfo{
+		.initialDataSize = cacheData.size(),
+		.pInitialData = cacheData.data()
+	};
+	vulkanPipelineCache = vulkanLogicalDevice.createPipelineCache(vulkanPipelineCacheCreateInfo);
+}
+
+PipelineCache::~PipelineCache()
+{
+	save();
+	vulkanLogicalDevice.destroyPipelineCache(vulkanPipelineCache);
+}
+
+const std::filesystem::path PipelineCache::buildFilePath(const std::filesystem::path& directory, const vk::PhysicalDeviceProperties& physicalDeviceProperties, const vk::PhysicalDeviceIDProperties& physicalDeviceIDProperties) const
+{
+	std::ostringstream fileName;
+	fileName << std::hex << std::setfill('0') << "pipeline_" << std::setw(4) << physicalDeviceProperties.vendorID << "_" << std::setw(4) << physicalDeviceProperties.deviceID << "_";
+	for (const uint8_t byte : physicalDeviceIDProperties.driverUUID)
+	{
+		fileName << std::setw(2) << static_cast<uint32_t>(byte);
+	}
+	fileName << ".bin";
+	return directory / fileName.str();
+}
+
+const std::vector<char> PipelineCache::load() const
+{
+	std::ifstream file(filePath, std::ios::ate | std::ios::binary);
+	if (!file.is_open())
+	{
+		return {};
+	}
+	std::vector<char> cacheData(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(cacheData.data(), cacheData.size());
+	if (!file || !isHeaderValid(cacheData))
+	{
+		std::cout << "Pipeline cache at " << filePath.string() << " is invalid and has been discarded" << std::endl;
+		return {};
+	}
+	return cacheData;
+}
+
+const bool PipelineCache::isHeaderValid(const std::vector<char>& cacheData) const
+{
+	if (cacheData.size() < headerSize)
+	{
+		return false;
+	}
+	const uint32_t cacheHeaderSize{ readHeaderField(cacheData, 0) };
+	const uint32_t cacheHeaderVersion{ readHeaderField(cacheData, 4) };
+	return cacheHeaderSize >= headerSize && cacheHeaderSize <= cacheData.size()
+		&& cacheHeaderVersion == static_cast<uint32_t>(vk::PipelineCacheHeaderVersion::eOne)
+		&& readHeaderField(cacheData, 8) == vendorID && readHeaderField(cacheData, 12) == deviceID
+		&& std::memcmp(cacheData.data() + 16, pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+}
+
+const uint32_t PipelineCache::readHeaderField(const std::vector<char>& cacheData, const size_t offset) const
+{
+	uint32_t headerField;
+	std::memcpy(&headerField, cacheData.data() + offset, sizeof(headerField));
+	return headerField;
+}
+
+void PipelineCache::save()
+{
+	const std::vector<uint8_t> cacheData{ vulkanLogicalDevice.getPipelineCacheData(vulkanPipelineCache) };
+	if (cacheData.empty() || cacheData.size() == pipelineCacheStatistics.savedBytes)
+	{
+		return;
+	}
+	std::error_code errorCode;
+	std::filesystem::create_directories(filePath.parent_path(), errorCode);
+	std::filesystem::path temporaryFilePath{ filePath };
+	temporaryFilePath += ".tmp";
+	{
+		std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			std::cout << "Pipeline cache could not be written to " << temporaryFilePath.string() << std::endl;
+			return;
+		}
+		file.write(reinterpret_cast<const char*>(cacheData.data()), cacheData.size());
+	}
+	std::filesystem::rename(temporaryFilePath, filePath, errorCode);
+	if (!errorCode)
+	{
+		pipelineCacheStatistics.savedBytes = cacheData.size();
+	}
+}
+
+void PipelineCache::addPipelineCreationTime(const double milliseconds)
+{
+	pipelineCacheStatistics.pipelineCreationMilliseconds += milliseconds;
+}
+
+const vk::PipelineCache PipelineCache::getVulkanPipelineCache() const
+{
+	return vulkanPipelineCache;
+}
+
+const PipelineCacheStatistics PipelineCache::getStatistics() const
+{
+	return pipelineCacheStatistics;
+}
@@ -0,0 +1,63 @@
+#include "PipelineVariantManager.h"
+
+void PipelineVariantManager::build(const ComputePipelineCreateInfo& computePipelineCreateInfo, const std::shared_ptr<Shader>& shader, const std::vector<AmbientOcclusionVariantKey>& ambientOcclusionVariantKeys, ThreadPool& threadPool)
+{
+	const auto start{ std::chrono::steady_clock::now() };
+	std::vector<std::future<std::unique_ptr<ComputePipeline>>> variantFutures;
+	for (const auto& ambientOcclusionVariantKey : ambientOcclusionVariantKeys)
+	{
+		variantFutures.push_back(threadPool.submit([&computePipelineCreateInfo, &shader, ambientOcclusionVariantKey]()
+		{
+			return buildVariant(computePipelineCreateInfo, shader, ambientOcclusionVariantKey);
+		}));
+	}
+	std::map<AmbientOcclusionVariantKey, std::unique_ptr<ComputePipeline>> builtPipelines;
+	for (size_t variantIndex = 0; variantIndex < variantFutures.size(); ++variantIndex)
+	{
+		builtPipelines[ambientOcclusionVariantKeys[variantIndex]] = variantFutures[variantIndex].get();
+	}
+	pipelines = std::move(builtPipelines);
+	buildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+const SpecializationConstants PipelineVariantManager::buildSpecializationConstants(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey)
+{
+	SpecializationConstants specializationConstants;
+	specializationConstants.add(0, ambientOcclusionVariantKey.sampleCount);
+	specializationConstants.add(1, ambientOcclusionVariantKey.stepCount);
+	specializationConstants.add(2, ambientOcclusionVariantKey.directionCount);
+	return specializationConstants;
+}
+
+std::unique_ptr<ComputePipeline> PipelineVariantManager::buildVariant(ComputePipelineCreateInfo computePipelineCreateInfo, const std::shared_ptr<Shader>& shader, const AmbientOcclusionVariantKey& ambientOcclusionVariantKey)
+{
+	const SpecializationConstants specializationConstants{ buildSpecializationConstants(ambientOcclusionVariantKey) };
+	const vk::SpecializationInfo specializationInfo{ specializationConstants.buildSpecializationInfo() };
+	computePipelineCreateInfo.shaderStage = shader->buildPipelineShaderStageCreateInfo(&specializationInfo);
+	return std::make_unique<ComputePipeline>(computePipelineCreateInfo);
+}
+
+const ComputePipeline& PipelineVariantManager::getPipeline(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) const
+{
+	const auto pipeline{ pipelines.find(ambientOcclusionVariantKey) };
+	if (pipeline == pipelines.end())
+	{
+		throw std::runtime_error("Error in PipelineVariantManager! Pipeline variant has not been built");
+	}
+	return *pipeline->second;
+}
+
+const bool PipelineVariantManager::contains(const AmbientOcclusionVariantKey& ambientOcclusionVariantKey) const
+{
+	return pipelines.contains(ambientOcclusionVariantKey);
+}
+
+const size_t PipelineVariantManager::getVariantCount() const
+{
+	return pipelines.size();
+}
+
+const double PipelineVariantManager::getBuildMilliseconds() const
+{
+	return buildMilliseconds;
+}
@@ -0,0 +1,48 @@
+#include "Quadric.h"
+
+Quadric::Quadric(const glm::vec3& planeNormal, const float planeDistance, const float weight) : weight(weight)
+{
+	const double a{ planeNormal.x }, b{ planeNormal.y }, c{ planeNormal.z }, d{ planeDistance };
+	a2 = a * a * weight;
+	ab = a * b * weight;
+	ac = a * c * weight;
+	ad = a * d * weight;
+	b2 = b * b * weight;
+	bc = b * c * weight;
+	bd = b * d * weight;
+	c2 = c * c * weight;
+	cd = c * d * weight;
+	d2 = d * d * weight;
+}
+
+Quadric& Quadric::operator+=(const Quadric& quadric)
+{
+	a2 += quadric.a2;
+	ab += quadric.ab;
+	ac += quadric.ac;
+	ad += quadric.ad;
+	b2 += quadric.b2;
+	bc += quadric.bc;
+	bd += quadric.bd;
+	c2 += quadric.c2;
+	cd += quadric.cd;
+	d2 += quadric.d2;
+	weight += quadric.weight;
+	return *this;
+}
+
+const float Quadric::evaluate(const glm::vec3& position) const
+{
+	if (weight <= 0.0)
+	{
+		return 0.0f;
+	}
+	const double x{ position.x }, y{ position.y }, z{ position.z };
+	const double error{
+		a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x
+		+ b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y
+		+ c2 * z * z + 2.0 * cd * z
+		+ d2
+	};
+	return static_cast<float>(std::abs(error) / weight);
+}
@@ -3,4 +3,25 @@
 Queue::Queue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex)
 {
 	vulkanQueue = vulkanLogicalDevice.getQueue(queueFamilyIndex.value(), 0);
+}
+
+void Queue::submit(const QueueSubmitInfo& queueSubmitInfo)
+{
+	const vk::TimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{
+		.waitSemaphoreValueCount = static_cast<uint32_t>(queueSubmitInfo.waitValues.size()),
+		.pWaitSemaphoreValues = queueSubmitInfo.waitValues.data(),
+		.signalSemaphoreValueCount = static_cast<uint32_t>(queueSubmitInfo.signalValues.size()),
+		.pSignalSemaphoreValues = queueSubmitInfo.signalValues.data()
+	};
+	const vk::SubmitInfo submitInfo{
+		.pNext = &timelineSemaphoreSubmitInfo,
+		.waitSemaphoreCount = static_cast<uint32_t>(queueSubmitInfo.waitSemaphores.size()),
+		.pWaitSemaphores = queueSubmitInfo.waitSemaphores.data(),
+		.pWaitDstStageMask = queueSubmitInfo.waitStageMasks.data(),
+		.commandBufferCount = 1,
+		.pCommandBuffers = &queueSubmitInfo.vulkanCommandBuffer,
+		.signalSemaphoreCount = static_cast<uint32_t>(queueSubmitInfo.signalSemaphores.size()),
+		.pSignalSemaphores = queueSubmitInfo.signalSemaphores.data()
+	};
+	vulkanQueue.submit(submitInfo, queueSubmitInfo.vulkanFence);
 }
\ No newline at end of file
@@ -4,6 +4,8 @@ QueueFamilyIndices::QueueFamilyIndices(const vk::PhysicalDevice& vulkanPhysicalD
 {
 	computeValidGraphicsFamilyIndex(vulkanPhysicalDevice);
 	computeValidPresentFamilyIndex(vulkanPhysicalDevice, vulkanWindowSurface);
+	computeValidTransferFamilyIndex(vulkanPhysicalDevice);
+	computeValidComputeFamilyIndex(vulkanPhysicalDevice);
 }
 
 void QueueFamilyIndices::computeValidGraphicsFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice)
@@ -34,6 +36,36 @@ void QueueFamilyIndices::computeValidPresentFamilyIndex(const vk::PhysicalDevice
 	}
 }
 
+void QueueFamilyIndices::computeValidTransferFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	int queueFamilyIndex{ 0 };
+	const std::vector<vk::QueueFamilyProperties> queueFamilies{ vulkanPhysicalDevice.getQueueFamilyProperties() };
+	for (const auto& queueFamily : queueFamilies)
+	{
+		if ((queueFamily.queueFlags & vk::QueueFlagBits::eTransfer) && !(queueFamily.queueFlags & (vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute)))
+		{
+			transferFamilyIndex = queueFamilyIndex;
+			break;
+		}
+		++queueFamilyIndex;
+	}
+}
+
+void QueueFamilyIndices::computeValidComputeFamilyIndex(const vk::PhysicalDevice& vulkanPhysicalDevice)
+{
+	int queueFamilyIndex{ 0 };
+	const std::vector<vk::QueueFamilyProperties> queueFamilies{ vulkanPhysicalDevice.getQueueFamilyProperties() };
+	for (const auto& queueFamily : queueFamilies)
+	{
+		if ((queueFamily.queueFlags & vk::QueueFlagBits::eCompute) && !(queueFamily.queueFlags & vk::QueueFlagBits::eGraphics))
+		{
+			computeFamilyIndex = queueFamilyIndex;
+			break;
+		}
+		++queueFamilyIndex;
+	}
+}
+
 const std::optional<uint32_t> QueueFamilyIndices::getGraphicsFamilyIndex() const
 {
 	return graphicsFamilyIndex;
@@ -43,3 +75,13 @@ const std::optional<uint32_t> QueueFamilyIndices::getPresentFamilyIndex() const
 {
 	return presentFamilyIndex;
 }
+
+const std::optional<uint32_t> QueueFamilyIndices::getTransferFamilyIndex() const
+{
+	return transferFamilyIndex;
+}
+
+const std::optional<uint32_t> QueueFamilyIndices::getComputeFamilyIndex() const
+{
+	return computeFamilyIndex;
+}
@@ -0,0 +1,42 @@
+#include "Random.h"
+
+Random::Random(const uint64_t seed) : state(mix(seed))
+{
+}
+
+const uint64_t Random::mix(uint64_t value)
+{
+	value += 0x9E3779B97F4A7C15ull;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+const uint64_t Random::deriveSeed(const uint64_t seed, const uint64_t stream)
+{
+	return mix(seed ^ mix(stream));
+}
+
+const uint32_t Random::nextUint()
+{
+	const uint64_t previousState{ state };
+	state = previousState * 6364136223846793005ull + increment;
+	const uint32_t xorShifted{ static_cast<uint32_t>(((previousState >> 18) ^ previousState) >> 27) };
+	const uint32_t rotation{ static_cast<uint32_t>(previousState >> 59) };
+	return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+}
+
+const uint32_t Random::nextUint(const uint32_t bound)
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(nextUint()) * bound) >> 32);
+}
+
+const float Random::nextFloat()
+{
+	return static_cast<float>(nextUint() >> 8) * (1.0f / 16777216.0f);
+}
+
+const float Random::nextFloat(const float minimum, const float maximum)
+{
+	return minimum + (maximum - minimum) * nextFloat();
+}
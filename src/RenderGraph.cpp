@@ -0,0 +1,495 @@
+#include "RenderGraph.h"
+
+RenderGraph::RenderGraph(const RenderGraphCreateInfo& renderGraphCreateInfo) : renderGraphCreateInfo(renderGraphCreateInfo)
+{
+}
+
+const uint32_t RenderGraph::addImage(const RenderGraphImageDescription& renderGraphImageDescription)
+{
+	images.push_back(renderGraphImageDescription);
+	isCompiled = false;
+	return static_cast<uint32_t>(images.size() - 1);
+}
+
+const uint32_t RenderGraph::addPass(const RenderGraphPassDescription& renderGraphPassDescription)
+{
+	for (const auto& access : renderGraphPassDescription.reads)
+	{
+		ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(access.imageHandle, images.size(), "Error in RenderGraph! Pass " + renderGraphPassDescription.name + " reads an unknown image");
+	}
+	for (const auto& access : renderGraphPassDescription.writes)
+	{
+		ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(access.imageHandle, images.size(), "Error in RenderGraph! Pass " + renderGraphPassDescription.name + " writes an unknown image");
+	}
+	passes.push_back(renderGraphPassDescription);
+	isCompiled = false;
+	return static_cast<uint32_t>(passes.size() - 1);
+}
+
+void RenderGraph::setVulkanImage(const uint32_t imageHandle, const vk::Image& vulkanImage)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(imageHandle, images.size(), "Error in RenderGraph! Image handle is out of bounds");
+	images[imageHandle].vulkanImage = vulkanImage;
+}
+
+void RenderGraph::compile()
+{
+	const std::vector<bool> usedPasses{ findUsedPasses() };
+	std::vector<ImageState> imageStates;
+	for (const auto& image : images)
+	{
+		imageStates.push_back(ImageState{
+			.layout = image.initialLayout,
+			.writeStageMask = image.initialStageMask,
+			.queue = RenderGraphQueue::eGraphics,
+			.isOwned = image.initialLayout != vk::ImageLayout::eUndefined
+		});
+	}
+	compiledPasses.clear();
+	segments.clear();
+	for (uint32_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+	{
+		if (!usedPasses[passIndex])
+		{
+			continue;
+		}
+		const RenderGraphQueue queue{ getExecutionQueue(passes[passIndex].queue) };
+		CompiledPass compiledPass{ .passIndex = passIndex, .segmentIndex = beginSegment(queue) };
+		for (const auto& passAccess : mergePassAccesses(passes[passIndex]))
+		{
+			ImageState& imageState{ imageStates[passAccess.access.imageHandle] };
+			if (imageState.isOwned && imageState.queue != queue)
+			{
+				if (!imageState.segmentIndex.has_value())
+				{
+					imageState.segmentIndex = findFirstGraphicsSegmentIndex(compiledPass.segmentIndex);
+				}
+				if (!imageState.segmentIndex.has_value())
+				{
+					throw std::runtime_error("Error in RenderGraph! Pass " + passes[passIndex].name + " accesses " + images[passAccess.access.imageHandle].name + " on the compute queue before a graphics submission can release it");
+				}
+				transferOwnership(compiledPass.barrierBatch, imageState, passAccess, compiledPass.segmentIndex);
+			}
+			else
+			{
+				addAccessBarrier(compiledPass.barrierBatch, imageState, passAccess);
+			}
+			imageState.queue = queue;
+			imageState.segmentIndex = compiledPass.segmentIndex;
+			imageState.isOwned = true;
+		}
+		compiledPasses.push_back(compiledPass);
+	}
+	if (segments.empty() || segments.back().queue != RenderGraphQueue::eGraphics)
+	{
+		throw std::runtime_error("Error in RenderGraph! The last pass must run on the graphics queue");
+	}
+	finalBarrierBatch = RenderGraphBarrierBatch{};
+	for (uint32_t imageHandle = 0; imageHandle < images.size(); ++imageHandle)
+	{
+		addFinalBarrier(imageStates[imageHandle], imageHandle);
+	}
+	waitForLastComputeSegment();
+	isCompiled = true;
+}
+
+const RenderGraphQueue RenderGraph::getExecutionQueue(const RenderGraphQueue requestedQueue) const
+{
+	return requestedQueue == RenderGraphQueue::eCompute && isAsyncComputeEnabled() ? RenderGraphQueue::eCompute : RenderGraphQueue::eGraphics;
+}
+
+const uint32_t RenderGraph::getQueueFamilyIndex(const RenderGraphQueue queue) const
+{
+	return queue == RenderGraphQueue::eCompute ? renderGraphCreateInfo.computeFamilyIndex.value() : renderGraphCreateInfo.graphicsFamilyIndex;
+}
+
+const uint32_t RenderGraph::beginSegment(const RenderGraphQueue queue)
+{
+	if (segments.empty() || segments.back().queue != queue)
+	{
+		segments.push_back(RenderGraphSegment{ .queue = queue });
+	}
+	return static_cast<uint32_t>(segments.size() - 1);
+}
+
+const std::optional<uint32_t> RenderGraph::findFirstGraphicsSegmentIndex(const uint32_t lastSegmentIndex) const
+{
+	for (uint32_t segmentIndex = 0; segmentIndex < lastSegmentIndex; ++segmentIndex)
+	{
+		if (segments[segmentIndex].queue == RenderGraphQueue::eGraphics)
+		{
+			return segmentIndex;
+		}
+	}
+	return std::nullopt;
+}
+
+void RenderGraph::addSegmentWait(const uint32_t segmentIndex, const uint32_t waitSegmentIndex, const vk::PipelineStageFlags stageMask)
+{
+	std::vector<RenderGraphSemaphoreWait>& waits{ segments[segmentIndex].waits };
+	const auto wait{ std::find_if(waits.begin(), waits.end(), [&](const RenderGraphSemaphoreWait& wait) { return wait.segmentIndex == waitSegmentIndex; }) };
+	if (wait == waits.end())
+	{
+		waits.push_back(RenderGraphSemaphoreWait{ .segmentIndex = waitSegmentIndex, .stageMask = stageMask });
+		return;
+	}
+	wait->stageMask |= stageMask;
+}
+
+void RenderGraph::transferOwnership(RenderGraphBarrierBatch& barrierBatch, ImageState& imageState, const PassAccess& passAccess, const uint32_t segmentIndex)
+{
+	const RenderGraphAccess& access{ passAccess.access };
+	const uint32_t ownerSegmentIndex{ imageState.segmentIndex.value() };
+	addSegmentWait(segmentIndex, ownerSegmentIndex, access.stageMask);
+	if (imageState.layout == vk::ImageLayout::eUndefined)
+	{
+		imageState = ImageState{ .layout = vk::ImageLayout::eUndefined };
+		addAccessBarrier(barrierBatch, imageState, passAccess);
+		return;
+	}
+	const vk::PipelineStageFlags srcStageMask{ imageState.writeStageMask | imageState.readStageMask };
+	RenderGraphBarrierBatch& releaseBarrierBatch{ segments[ownerSegmentIndex].releaseBarrierBatch };
+	releaseBarrierBatch.imageBarriers.push_back(RenderGraphImageBarrier{
+		.imageHandle = access.imageHandle,
+		.srcAccessMask = imageState.writeAccessMask,
+		.dstAccessMask = vk::AccessFlags{},
+		.oldLayout = imageState.layout,
+		.newLayout = access.layout,
+		.srcQueueFamilyIndex = getQueueFamilyIndex(imageState.queue),
+		.dstQueueFamilyIndex = getQueueFamilyIndex(segments[segmentIndex].queue)
+	});
+	releaseBarrierBatch.srcStageMask |= srcStageMask ? srcStageMask : vk::PipelineStageFlags{ vk::PipelineStageFlagBits::eTopOfPipe };
+	releaseBarrierBatch.dstStageMask |= vk::PipelineStageFlagBits::eBottomOfPipe;
+	barrierBatch.imageBarriers.push_back(RenderGraphImageBarrier{
+		.imageHandle = access.imageHandle,
+		.srcAccessMask = vk::AccessFlags{},
+		.dstAccessMask = access.accessMask,
+		.oldLayout = imageState.layout,
+		.newLayout = access.layout,
+		.srcQueueFamilyIndex = getQueueFamilyIndex(imageState.queue),
+		.dstQueueFamilyIndex = getQueueFamilyIndex(segments[segmentIndex].queue)
+	});
+	barrierBatch.srcStageMask |= access.stageMask;
+	barrierBatch.dstStageMask |= access.stageMask;
+	imageState = ImageState{
+		.layout = access.layout,
+		.writeStageMask = access.stageMask,
+		.writeAccessMask = passAccess.isWrite ? access.accessMask : vk::AccessFlags{},
+		.readStageMask = passAccess.isWrite ? vk::PipelineStageFlags{} : access.stageMask,
+		.visibleStageMask = passAccess.isWrite ? vk::PipelineStageFlags{} : access.stageMask,
+		.visibleAccessMask = passAccess.isWrite ? vk::AccessFlags{} : access.accessMask
+	};
+}
+
+const std::vector<bool> RenderGraph::findUsedPasses() const
+{
+	std::vector<bool> usedPasses(passes.size(), false);
+	std::vector<bool> requiredImages(images.size(), false);
+	for (uint32_t imageHandle = 0; imageHandle < images.size(); ++imageHandle)
+	{
+		requiredImages[imageHandle] = images[imageHandle].isExternal;
+	}
+	for (size_t passIndex = passes.size(); passIndex-- > 0;)
+	{
+		const RenderGraphPassDescription& pass{ passes[passIndex] };
+		usedPasses[passIndex] = pass.hasSideEffects || std::any_of(pass.writes.begin(), pass.writes.end(), [&](const RenderGraphAccess& access) { return requiredImages[access.imageHandle]; });
+		if (usedPasses[passIndex])
+		{
+			for (const auto& access : pass.reads)
+			{
+				requiredImages[access.imageHandle] = true;
+			}
+		}
+	}
+	return usedPasses;
+}
+
+const std::vector<RenderGraph::PassAccess> RenderGraph::mergePassAccesses(const RenderGraphPassDescription& renderGraphPassDescription) const
+{
+	std::vector<PassAccess> passAccesses;
+	const auto mergeAccess = [&](const RenderGraphAccess& access, const bool isWrite)
+	{
+		const auto passAccess{ std::find_if(passAccesses.begin(), passAccesses.end(), [&](const PassAccess& passAccess) { return passAccess.access.imageHandle == access.imageHandle; }) };
+		if (passAccess == passAccesses.end())
+		{
+			passAccesses.push_back(PassAccess{ .access = access, .isWrite = isWrite });
+			return;
+		}
+		if (passAccess->access.layout != access.layout)
+		{
+			throw std::runtime_error("Error in RenderGraph! Pass " + renderGraphPassDescription.name + " accesses " + images[access.imageHandle].name + " in two different layouts");
+		}
+		passAccess->access.stageMask |= access.stageMask;
+		passAccess->access.accessMask |= access.accessMask;
+		passAccess->isWrite = passAccess->isWrite || isWrite;
+	};
+	for (const auto& access : renderGraphPassDescription.reads)
+	{
+		mergeAccess(access, false);
+	}
+	for (const auto& access : renderGraphPassDescription.writes)
+	{
+		mergeAccess(access, true);
+	}
+	return passAccesses;
+}
+
+void RenderGraph::addAccessBarrier(RenderGraphBarrierBatch& barrierBatch, ImageState& imageState, const PassAccess& passAccess) const
+{
+	const RenderGraphAccess& access{ passAccess.access };
+	const bool isLayoutTransition{ imageState.layout != access.layout };
+	if (passAccess.isWrite || isLayoutTransition)
+	{
+		const vk::PipelineStageFlags srcStageMask{ imageState.writeStageMask | imageState.readStageMask };
+		if (isLayoutTransition || imageState.writeAccessMask)
+		{
+			barrierBatch.imageBarriers.push_back(RenderGraphImageBarrier{
+				.imageHandle = access.imageHandle,
+				.srcAccessMask = imageState.writeAccessMask,
+				.dstAccessMask = access.accessMask,
+				.oldLayout = imageState.layout,
+				.newLayout = access.layout
+			});
+		}
+		if (srcStageMask || isLayoutTransition)
+		{
+			barrierBatch.srcStageMask |= srcStageMask ? srcStageMask : vk::PipelineStageFlags{ vk::PipelineStageFlagBits::eTopOfPipe };
+			barrierBatch.dstStageMask |= access.stageMask;
+		}
+		imageState = ImageState{
+			.layout = access.layout,
+			.writeStageMask = access.stageMask,
+			.writeAccessMask = passAccess.isWrite ? access.accessMask : vk::AccessFlags{},
+			.readStageMask = passAccess.isWrite ? vk::PipelineStageFlags{} : access.stageMask,
+			.visibleStageMask = passAccess.isWrite ? vk::PipelineStageFlags{} : access.stageMask,
+			.visibleAccessMask = passAccess.isWrite ? vk::AccessFlags{} : access.accessMask
+		};
+		return;
+	}
+	const bool isVisible{ !(access.stageMask & ~imageState.visibleStageMask) && !(access.accessMask & ~imageState.visibleAccessMask) };
+	if (imageState.writeStageMask && !isVisible)
+	{
+		if (imageState.writeAccessMask)
+		{
+			barrierBatch.imageBarriers.push_back(RenderGraphImageBarrier{
+				.imageHandle = access.imageHandle,
+				.srcAccessMask = imageState.writeAccessMask,
+				.dstAccessMask = access.accessMask,
+				.oldLayout = imageState.layout,
+				.newLayout = access.layout
+			});
+		}
+		barrierBatch.srcStageMask |= imageState.writeStageMask;
+		barrierBatch.dstStageMask |= access.stageMask;
+		imageState.visibleStageMask |= access.stageMask;
+		imageState.visibleAccessMask |= access.accessMask;
+	}
+	imageState.readStageMask |= access.stageMask;
+}
+
+void RenderGraph::addFinalBarrier(const ImageState& imageState, const uint32_t imageHandle)
+{
+	const RenderGraphImageDescription& image{ images[imageHandle] };
+	if (image.finalLayout == vk::ImageLayout::eUndefined)
+	{
+		return;
+	}
+	if (imageState.isOwned && imageState.queue != RenderGraphQueue::eGraphics)
+	{
+		const PassAccess finalAccess{
+			.access = RenderGraphAccess{
+				.imageHandle = imageHandle,
+				.stageMask = vk::PipelineStageFlagBits::eAllCommands,
+				.accessMask = vk::AccessFlags{},
+				.layout = image.finalLayout
+			},
+			.isWrite = false
+		};
+		ImageState finalImageState{ imageState };
+		transferOwnership(finalBarrierBatch, finalImageState, finalAccess, static_cast<uint32_t>(segments.size() - 1));
+		return;
+	}
+	if (image.finalLayout == imageState.layout)
+	{
+		return;
+	}
+	const vk::PipelineStageFlags srcStageMask{ imageState.writeStageMask | imageState.readStageMask };
+	finalBarrierBatch.imageBarriers.push_back(RenderGraphImageBarrier{
+		.imageHandle = imageHandle,
+		.srcAccessMask = imageState.writeAccessMask,
+		.dstAccessMask = vk::AccessFlags{},
+		.oldLayout = imageState.layout,
+		.newLayout = image.finalLayout
+	});
+	finalBarrierBatch.srcStageMask |= srcStageMask ? srcStageMask : vk::PipelineStageFlags{ vk::PipelineStageFlagBits::eTopOfPipe };
+	finalBarrierBatch.dstStageMask |= image.finalStageMask;
+}
+
+void RenderGraph::waitForLastComputeSegment()
+{
+	const uint32_t lastSegmentIndex{ static_cast<uint32_t>(segments.size() - 1) };
+	for (uint32_t segmentIndex = lastSegmentIndex; segmentIndex-- > 0;)
+	{
+		if (segments[segmentIndex].queue == RenderGraphQueue::eCompute)
+		{
+			const std::vector<RenderGraphSemaphoreWait>& waits{ segments[lastSegmentIndex].waits };
+			if (std::none_of(waits.begin(), waits.end(), [&](const RenderGraphSemaphoreWait& wait) { return wait.segmentIndex == segmentIndex; }))
+			{
+				addSegmentWait(lastSegmentIndex, segmentIndex, vk::PipelineStageFlagBits::eAllCommands);
+			}
+			return;
+		}
+	}
+}
+
+void RenderGraph::execute(const uint32_t segmentIndex, const vk::CommandBuffer& vulkanCommandBuffer) const
+{
+	if (!isCompiled)
+	{
+		throw std::runtime_error("Error in RenderGraph! The graph must be compiled before it is executed");
+	}
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(segmentIndex, segments.size(), "Error in RenderGraph! Segment index is out of bounds");
+	for (const auto& compiledPass : compiledPasses)
+	{
+		if (compiledPass.segmentIndex == segmentIndex)
+		{
+			recordBarrierBatch(vulkanCommandBuffer, compiledPass.barrierBatch);
+			passes[compiledPass.passIndex].record(vulkanCommandBuffer);
+		}
+	}
+	recordBarrierBatch(vulkanCommandBuffer, segments[segmentIndex].releaseBarrierBatch);
+	if (segmentIndex == segments.size() - 1)
+	{
+		recordBarrierBatch(vulkanCommandBuffer, finalBarrierBatch);
+	}
+}
+
+void RenderGraph::recordBarrierBatch(const vk::CommandBuffer& vulkanCommandBuffer, const RenderGraphBarrierBatch& barrierBatch) const
+{
+	if (!barrierBatch.srcStageMask)
+	{
+		return;
+	}
+	std::vector<vk::ImageMemoryBarrier> imageMemoryBarriers;
+	for (const auto& imageBarrier : barrierBatch.imageBarriers)
+	{
+		imageMemoryBarriers.push_back(buildImageMemoryBarrier(imageBarrier));
+	}
+	vulkanCommandBuffer.pipelineBarrier(barrierBatch.srcStageMask, barrierBatch.dstStageMask, vk::DependencyFlags{}, nullptr, nullptr, imageMemoryBarriers);
+}
+
+const vk::ImageMemoryBarrier RenderGraph::buildImageMemoryBarrier(const RenderGraphImageBarrier& imageBarrier) const
+{
+	const RenderGraphImageDescription& image{ images[imageBarrier.imageHandle] };
+	return vk::ImageMemoryBarrier{
+		.srcAccessMask = imageBarrier.srcAccessMask,
+		.dstAccessMask = imageBarrier.dstAccessMask,
+		.oldLayout = imageBarrier.oldLayout,
+		.newLayout = imageBarrier.newLayout,
+		.srcQueueFamilyIndex = imageBarrier.srcQueueFamilyIndex,
+		.dstQueueFamilyIndex = imageBarrier.dstQueueFamilyIndex,
+		.image = image.vulkanImage,
+		.subresourceRange = vk::ImageSubresourceRange{
+			.aspectMask = image.aspectMask,
+			.baseMipLevel = 0,
+			.levelCount = image.mipLevels,
+			.baseArrayLayer = 0,
+			.layerCount = 1
+		}
+	};
+}
+
+const std::string RenderGraph::dump() const
+{
+	const RenderGraphStatistics statistics{ getStatistics() };
+	std::ostringstream schedule;
+	schedule << "Render graph: " << statistics.passCount << " passes, " << statistics.culledPassCount << " culled, " << statistics.segmentCount << " queue submissions, "
+		<< statistics.barrierBatchCount << " barrier batches, " << statistics.imageBarrierCount << " image barriers, " << statistics.queueOwnershipTransferCount << " queue ownership transfers ("
+		<< (isAsyncComputeEnabled() ? "async compute on queue family " + std::to_string(renderGraphCreateInfo.computeFamilyIndex.value()) : "compute passes run on the graphics queue") << ")" << std::endl;
+	for (uint32_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex)
+	{
+		schedule << "  Submission " << segmentIndex << " on the " << (segments[segmentIndex].queue == RenderGraphQueue::eCompute ? "compute" : "graphics") << " queue" << std::endl;
+		for (const auto& wait : segments[segmentIndex].waits)
+		{
+			schedule << "    wait for submission " << wait.segmentIndex << " at " << vk::to_string(wait.stageMask) << std::endl;
+		}
+		for (const auto& compiledPass : compiledPasses)
+		{
+			if (compiledPass.segmentIndex == segmentIndex)
+			{
+				dumpBarrierBatch(schedule, "barrier", compiledPass.barrierBatch);
+				schedule << "    " << passes[compiledPass.passIndex].name << std::endl;
+			}
+		}
+		dumpBarrierBatch(schedule, "release", segments[segmentIndex].releaseBarrierBatch);
+	}
+	dumpBarrierBatch(schedule, "final barrier", finalBarrierBatch);
+	for (uint32_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+	{
+		if (std::none_of(compiledPasses.begin(), compiledPasses.end(), [&](const CompiledPass& compiledPass) { return compiledPass.passIndex == passIndex; }))
+		{
+			schedule << "  " << passes[passIndex].name << " (culled)" << std::endl;
+		}
+	}
+	return schedule.str();
+}
+
+void RenderGraph::dumpBarrierBatch(std::ostringstream& schedule, const std::string& label, const RenderGraphBarrierBatch& barrierBatch) const
+{
+	if (!barrierBatch.srcStageMask)
+	{
+		return;
+	}
+	schedule << "    " << label << " " << vk::to_string(barrierBatch.srcStageMask) << " -> " << vk::to_string(barrierBatch.dstStageMask) << std::endl;
+	for (const auto& imageBarrier : barrierBatch.imageBarriers)
+	{
+		schedule << "      " << images[imageBarrier.imageHandle].name << ": " << vk::to_string(imageBarrier.oldLayout) << " -> " << vk::to_string(imageBarrier.newLayout)
+			<< ", " << vk::to_string(imageBarrier.srcAccessMask) << " -> " << vk::to_string(imageBarrier.dstAccessMask);
+		if (imageBarrier.srcQueueFamilyIndex != imageBarrier.dstQueueFamilyIndex)
+		{
+			schedule << ", queue family " << imageBarrier.srcQueueFamilyIndex << " -> " << imageBarrier.dstQueueFamilyIndex;
+		}
+		schedule << std::endl;
+	}
+}
+
+const RenderGraphStatistics RenderGraph::getStatistics() const
+{
+	RenderGraphStatistics statistics{
+		.passCount = static_cast<uint32_t>(passes.size()),
+		.culledPassCount = static_cast<uint32_t>(passes.size() - compiledPasses.size()),
+		.segmentCount = static_cast<uint32_t>(segments.size()),
+		.queueOwnershipTransferCount = 0,
+		.barrierBatchCount = 0,
+		.imageBarrierCount = 0
+	};
+	const auto countBarrierBatch = [&](const RenderGraphBarrierBatch& barrierBatch)
+	{
+		if (barrierBatch.srcStageMask)
+		{
+			++statistics.barrierBatchCount;
+			statistics.imageBarrierCount += static_cast<uint32_t>(barrierBatch.imageBarriers.size());
+		}
+	};
+	for (const auto& compiledPass : compiledPasses)
+	{
+		countBarrierBatch(compiledPass.barrierBatch);
+	}
+	for (const auto& segment : segments)
+	{
+		countBarrierBatch(segment.releaseBarrierBatch);
+		statistics.queueOwnershipTransferCount += static_cast<uint32_t>(segment.releaseBarrierBatch.imageBarriers.size());
+	}
+	countBarrierBatch(finalBarrierBatch);
+	return statistics;
+}
+
+const std::vector<RenderGraphSegment>& RenderGraph::getSegments() const
+{
+	return segments;
+}
+
+const bool RenderGraph::isAsyncComputeEnabled() const
+{
+	return renderGraphCreateInfo.computeFamilyIndex.has_value() && renderGraphCreateInfo.computeFamilyIndex.value() != renderGraphCreateInfo.graphicsFamilyIndex;
+}
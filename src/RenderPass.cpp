@@ -36,8 +36,8 @@ const vk::AttachmentDescription RenderPass::createAttachmentDescription(const vk
 		.storeOp = vk::AttachmentStoreOp::eStore,
 		.stencilLoadOp = vk::AttachmentLoadOp::eDontCare,
 		.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
-		.initialLayout = vk::ImageLayout::eUndefined,
-		.finalLayout = vk::ImageLayout::ePresentSrcKHR
+		.initialLayout = vk::ImageLayout::eColorAttachmentOptimal,
+		.finalLayout = vk::ImageLayout::eColorAttachmentOptimal
 	};
 }
 
@@ -0,0 +1,76 @@
+#include "RingAllocator.h"
+
+RingAllocator::RingAllocator(const uint64_t size) : size(size)
+{
+}
+
+std::optional<uint64_t> RingAllocator::allocate(const uint64_t size, const uint64_t alignment)
+{
+	if (usedSize == 0)
+	{
+		head = 0;
+		tail = 0;
+	}
+	const uint64_t alignedHead{ alignment > 1 ? (head + alignment - 1) / alignment * alignment : head };
+	if (head >= tail && usedSize < this->size)
+	{
+		if (alignedHead + size <= this->size)
+		{
+			consume(alignedHead + size - head, alignedHead + size);
+			return alignedHead;
+		}
+		if (size <= tail)
+		{
+			consume(this->size - head + size, size);
+			return 0;
+		}
+	}
+	else if (head < tail && alignedHead + size <= tail)
+	{
+		consume(alignedHead + size - head, alignedHead + size);
+		return alignedHead;
+	}
+	return std::nullopt;
+}
+
+void RingAllocator::consume(const uint64_t consumedSize, const uint64_t newHead)
+{
+	usedSize += consumedSize;
+	pendingSize += consumedSize;
+	head = newHead;
+}
+
+const RingMarker RingAllocator::createMarker()
+{
+	const RingMarker ringMarker{
+		.head = head,
+		.size = pendingSize
+	};
+	pendingSize = 0;
+	return ringMarker;
+}
+
+void RingAllocator::release(const RingMarker& ringMarker)
+{
+	if (ringMarker.size == 0)
+	{
+		return;
+	}
+	tail = ringMarker.head;
+	usedSize -= ringMarker.size;
+}
+
+const uint64_t RingAllocator::getSize() const
+{
+	return size;
+}
+
+const uint64_t RingAllocator::getUsedSize() const
+{
+	return usedSize;
+}
+
+const uint64_t RingAllocator::getPendingSize() const
+{
+	return pendingSize;
+}
@@ -0,0 +1,29 @@
+#include "Sampler.h"
+
+Sampler::Sampler(const vk::Device& vulkanLogicalDevice, const vk::Filter filter) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	vulkanSampler = vulkanLogicalDevice.createSampler(buildSamplerCreateInfo(filter));
+}
+
+Sampler::~Sampler()
+{
+	vulkanLogicalDevice.destroySampler(vulkanSampler);
+}
+
+const vk::SamplerCreateInfo Sampler::buildSamplerCreateInfo(const vk::Filter filter) const
+{
+	return vk::SamplerCreateInfo{
+		.magFilter = filter,
+		.minFilter = filter,
+		.mipmapMode = vk::SamplerMipmapMode::eNearest,
+		.addressModeU = vk::SamplerAddressMode::eClampToEdge,
+		.addressModeV = vk::SamplerAddressMode::eClampToEdge,
+		.addressModeW = vk::SamplerAddressMode::eClampToEdge,
+		.maxLod = VK_LOD_CLAMP_NONE
+	};
+}
+
+const vk::Sampler Sampler::getVulkanSampler() const
+{
+	return vulkanSampler;
+}
\ No newline at end of file
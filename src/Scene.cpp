@@ -0,0 +1,171 @@
+#include "Scene.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SCENE_CULLING_USE_SSE2
+#endif
+
+const uint32_t Scene::addObject(const SceneObjectCreateInfo& sceneObjectCreateInfo)
+{
+	const uint32_t objectIndex{ static_cast<uint32_t>(transforms.size()) };
+	localBoundsCenter.push_back(sceneObjectCreateInfo.boundsCenter);
+	localBoundsRadius.push_back(sceneObjectCreateInfo.boundsRadius);
+	transforms.push_back(sceneObjectCreateInfo.transform);
+	meshIndices.push_back(sceneObjectCreateInfo.meshIndex);
+	worldBoundsCenterX.push_back(0.0f);
+	worldBoundsCenterY.push_back(0.0f);
+	worldBoundsCenterZ.push_back(0.0f);
+	worldBoundsRadius.push_back(0.0f);
+	updateWorldBounds(objectIndex);
+	return objectIndex;
+}
+
+void Scene::setTransform(const uint32_t objectIndex, const glm::mat4& transform)
+{
+	if (objectIndex >= transforms.size())
+	{
+		throw std::runtime_error("Error in Scene! Object index is out of bounds");
+	}
+	transforms[objectIndex] = transform;
+	updateWorldBounds(objectIndex);
+}
+
+void Scene::updateWorldBounds(const uint32_t objectIndex)
+{
+	const glm::mat4& transform{ transforms[objectIndex] };
+	const glm::vec4 worldCenter{ transform * glm::vec4(localBoundsCenter[objectIndex], 1.0f) };
+	const float maximumScale{ std::max({
+		glm::length(glm::vec3(transform[0].x, transform[0].y, transform[0].z)),
+		glm::length(glm::vec3(transform[1].x, transform[1].y, transform[1].z)),
+		glm::length(glm::vec3(transform[2].x, transform[2].y, transform[2].z))
+	}) };
+	worldBoundsCenterX[objectIndex] = worldCenter.x;
+	worldBoundsCenterY[objectIndex] = worldCenter.y;
+	worldBoundsCenterZ[objectIndex] = worldCenter.z;
+	worldBoundsRadius[objectIndex] = localBoundsRadius[objectIndex] * maximumScale;
+}
+
+void Scene::reserve(const size_t objectCount)
+{
+	worldBoundsCenterX.reserve(objectCount);
+	worldBoundsCenterY.reserve(objectCount);
+	worldBoundsCenterZ.reserve(objectCount);
+	worldBoundsRadius.reserve(objectCount);
+	localBoundsCenter.reserve(objectCount);
+	localBoundsRadius.reserve(objectCount);
+	transforms.reserve(objectCount);
+	meshIndices.reserve(objectCount);
+	visibleObjects.reserve(objectCount);
+}
+
+void Scene::clear()
+{
+	worldBoundsCenterX.clear();
+	worldBoundsCenterY.clear();
+	worldBoundsCenterZ.clear();
+	worldBoundsRadius.clear();
+	localBoundsCenter.clear();
+	localBoundsRadius.clear();
+	transforms.clear();
+	meshIndices.clear();
+	visibleObjects.clear();
+}
+
+void Scene::cull(const Frustum& frustum, ThreadPool& threadPool)
+{
+	const size_t objectCount{ getObjectCount() };
+	visibleChunks.resize((objectCount + cullChunkSize - 1) / cullChunkSize);
+	threadPool.parallelFor(objectCount, cullChunkSize, [&](const size_t chunkIndex, const size_t begin, const size_t end)
+	{
+		visibleChunks[chunkIndex].clear();
+		cullRange(frustum, begin, end, visibleChunks[chunkIndex]);
+	});
+	visibleObjects.clear();
+	for (const auto& visibleChunk : visibleChunks)
+	{
+		visibleObjects.insert(visibleObjects.end(), visibleChunk.begin(), visibleChunk.end());
+	}
+}
+
+void Scene::cullRange(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visibleRange) const
+{
+	for (size_t objectIndex = cullRangeSIMD(frustum, begin, end, visibleRange); objectIndex < end; ++objectIndex)
+	{
+		const glm::vec3 center{ worldBoundsCenterX[objectIndex], worldBoundsCenterY[objectIndex], worldBoundsCenterZ[objectIndex] };
+		if (frustum.intersectsSphere(center, worldBoundsRadius[objectIndex]))
+		{
+			visibleRange.push_back(static_cast<uint32_t>(objectIndex));
+		}
+	}
+}
+
+const size_t Scene::cullRangeSIMD(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visibleRange) const
+{
+#ifdef SCENE_CULLING_USE_SSE2
+	const std::array<glm::vec4, 6>& planes{ frustum.getPlanes() };
+	__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+	for (size_t planeIndex = 0; planeIndex < planes.size(); ++planeIndex)
+	{
+		planeX[planeIndex] = _mm_set1_ps(planes[planeIndex].x);
+		planeY[planeIndex] = _mm_set1_ps(planes[planeIndex].y);
+		planeZ[planeIndex] = _mm_set1_ps(planes[planeIndex].z);
+		planeW[planeIndex] = _mm_set1_ps(planes[planeIndex].w);
+	}
+	size_t objectIndex{ begin };
+	for (; objectIndex + 4 <= end; objectIndex += 4)
+	{
+		const __m128 centerX{ _mm_loadu_ps(&worldBoundsCenterX[objectIndex]) };
+		const __m128 centerY{ _mm_loadu_ps(&worldBoundsCenterY[objectIndex]) };
+		const __m128 centerZ{ _mm_loadu_ps(&worldBoundsCenterZ[objectIndex]) };
+		const __m128 negativeRadius{ _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&worldBoundsRadius[objectIndex])) };
+		__m128 isInside{ _mm_castsi128_ps(_mm_set1_epi32(-1)) };
+		for (size_t planeIndex = 0; planeIndex < planes.size(); ++planeIndex)
+		{
+			const __m128 distanceXY{ _mm_add_ps(_mm_mul_ps(centerX, planeX[planeIndex]), _mm_mul_ps(centerY, planeY[planeIndex])) };
+			const __m128 distanceZW{ _mm_add_ps(_mm_mul_ps(centerZ, planeZ[planeIndex]), planeW[planeIndex]) };
+			isInside = _mm_and_ps(isInside, _mm_cmpge_ps(_mm_add_ps(distanceXY, distanceZW), negativeRadius));
+		}
+		const int insideMask{ _mm_movemask_ps(isInside) };
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			if (insideMask & (1 << lane))
+			{
+				visibleRange.push_back(static_cast<uint32_t>(objectIndex + lane));
+			}
+		}
+	}
+	return objectIndex;
+#else
+	return begin;
+#endif
+}
+
+const size_t Scene::getObjectCount() const
+{
+	return transforms.size();
+}
+
+const uint32_t Scene::getMeshIndex(const uint32_t objectIndex) const
+{
+	return meshIndices[objectIndex];
+}
+
+const glm::mat4& Scene::getTransform(const uint32_t objectIndex) const
+{
+	return transforms[objectIndex];
+}
+
+const glm::vec3 Scene::getWorldBoundsCenter(const uint32_t objectIndex) const
+{
+	return glm::vec3{ worldBoundsCenterX[objectIndex], worldBoundsCenterY[objectIndex], worldBoundsCenterZ[objectIndex] };
+}
+
+const float Scene::getWorldBoundsRadius(const uint32_t objectIndex) const
+{
+	return worldBoundsRadius[objectIndex];
+}
+
+const std::vector<uint32_t>& Scene::getVisibleObjects() const
+{
+	return visibleObjects;
+}
@@ -0,0 +1,388 @@
+#include "SceneGenerator.h"
+
+SceneGenerator::SceneGenerator(const SceneGeneratorCreateInfo& sceneGeneratorCreateInfo) : sceneGeneratorCreateInfo(sceneGeneratorCreateInfo), firstClutterMeshIndex(firstColumnMeshIndex + std::max(1u, sceneGeneratorCreateInfo.variantCount))
+{
+}
+
+GeneratedScene SceneGenerator::generate(ThreadPool& threadPool) const
+{
+	GeneratedScene generatedScene;
+	buildMeshes(generatedScene.meshes, threadPool);
+	placeObjects(generatedScene.scene, generatedScene.meshes, threadPool);
+	return generatedScene;
+}
+
+void SceneGenerator::buildMeshes(std::vector<Mesh>& meshes, ThreadPool& threadPool) const
+{
+	const uint32_t variantCount{ std::max(1u, sceneGeneratorCreateInfo.variantCount) };
+	meshes.resize(firstClutterMeshIndex + variantCount);
+	std::vector<std::future<void>> builtMeshes;
+	builtMeshes.push_back(threadPool.submit([this, &meshes]() { meshes[boxMeshIndex] = buildBoxMesh(); }));
+	for (uint32_t variant = 0; variant < variantCount; ++variant)
+	{
+		builtMeshes.push_back(threadPool.submit([this, &meshes, variant]() { meshes[firstColumnMeshIndex + variant] = buildColumnMesh(variant); }));
+		builtMeshes.push_back(threadPool.submit([this, &meshes, variant]() { meshes[firstClutterMeshIndex + variant] = buildClutterMesh(variant); }));
+	}
+	meshes[terrainMeshIndex] = buildTerrainMesh(threadPool);
+	for (auto& builtMesh : builtMeshes)
+	{
+		builtMesh.get();
+	}
+	for (auto& mesh : meshes)
+	{
+		computeBounds(mesh);
+	}
+}
+
+const Mesh SceneGenerator::buildTerrainMesh(ThreadPool& threadPool) const
+{
+	const uint32_t resolution{ std::max(1u, static_cast<uint32_t>(std::sqrt(sceneGeneratorCreateInfo.terrainTriangleCount / 2.0))) };
+	const float step{ sceneGeneratorCreateInfo.extent / resolution };
+	const float origin{ -0.5f * sceneGeneratorCreateInfo.extent };
+	Mesh mesh;
+	mesh.vertices.resize(static_cast<size_t>(resolution + 1) * (resolution + 1));
+	mesh.indices.resize(static_cast<size_t>(resolution) * resolution * 6);
+	const size_t rowsPerChunk{ 16 };
+	threadPool.parallelFor(resolution + 1, rowsPerChunk, [&](const size_t, const size_t begin, const size_t end)
+	{
+		for (size_t row = begin; row < end; ++row)
+		{
+			const float z{ origin + step * row };
+			for (uint32_t column = 0; column <= resolution; ++column)
+			{
+				const float x{ origin + step * column };
+				const float height{ terrainHeight(x, z) };
+				const float shade{ glm::clamp(0.55f + 0.04f * height, 0.2f, 0.9f) };
+				mesh.vertices[row * (resolution + 1) + column] = Vertex{
+					.position = glm::vec3(x, height, z),
+					.color = glm::vec3(shade, shade * 0.9f, shade * 0.75f),
+					.normal = terrainNormal(x, z, step)
+				};
+				if (row < resolution && column < resolution)
+				{
+					const uint32_t first{ static_cast<uint32_t>(row * (resolution + 1) + column) };
+					const uint32_t second{ first + resolution + 1 };
+					const size_t firstIndex{ (row * resolution + column) * 6 };
+					const uint32_t quadIndices[]{ first, second, first + 1, first + 1, second, second + 1 };
+					std::copy(std::begin(quadIndices), std::end(quadIndices), mesh.indices.begin() + firstIndex);
+				}
+			}
+		}
+	});
+	return mesh;
+}
+
+const Mesh SceneGenerator::buildColumnMesh(const uint32_t variant) const
+{
+	Random random{ Random::deriveSeed(sceneGeneratorCreateInfo.seed, columnVariantStream + variant) };
+	const uint32_t segmentCount{ std::max(8u, static_cast<uint32_t>(std::sqrt(static_cast<float>(sceneGeneratorCreateInfo.columnTriangleCount)))) };
+	const uint32_t sideTriangleCount{ sceneGeneratorCreateInfo.columnTriangleCount > 2 * segmentCount ? sceneGeneratorCreateInfo.columnTriangleCount - 2 * segmentCount : 0 };
+	const uint32_t ringCount{ std::max(1u, sideTriangleCount / (2 * segmentCount)) };
+	const uint32_t fluteCount{ 8 + 2 * random.nextUint(9) };
+	const float fluteDepth{ random.nextFloat(0.04f, 0.12f) };
+	const float taper{ random.nextFloat(0.0f, 0.15f) };
+	const glm::vec3 color{ glm::vec3(random.nextFloat(0.75f, 0.9f)) };
+	constexpr float twoPi{ 6.28318530718f };
+	Mesh mesh;
+	for (uint32_t ring = 0; ring <= ringCount; ++ring)
+	{
+		const float height{ static_cast<float>(ring) / ringCount };
+		for (uint32_t segment = 0; segment <= segmentCount; ++segment)
+		{
+			const float angle{ twoPi * segment / segmentCount };
+			const float flute{ 0.5f + 0.5f * deterministicCos(angle * fluteCount) };
+			const float radius{ (1.0f - taper * height) * (1.0f - fluteDepth * flute) };
+			mesh.vertices.push_back(Vertex{
+				.position = glm::vec3(radius * deterministicCos(angle), height, radius * deterministicSin(angle)),
+				.color = color,
+				.normal = glm::vec3(0.0f)
+			});
+		}
+	}
+	for (uint32_t ring = 0; ring < ringCount; ++ring)
+	{
+		for (uint32_t segment = 0; segment < segmentCount; ++segment)
+		{
+			const uint32_t first{ ring * (segmentCount + 1) + segment };
+			const uint32_t second{ first + segmentCount + 1 };
+			mesh.indices.insert(mesh.indices.end(), { first, second, first + 1, first + 1, second, second + 1 });
+		}
+	}
+	const uint32_t capCenter{ static_cast<uint32_t>(mesh.vertices.size()) };
+	mesh.vertices.push_back(Vertex{ .position = glm::vec3(0.0f, 1.0f, 0.0f), .color = color, .normal = glm::vec3(0.0f) });
+	const uint32_t topRing{ ringCount * (segmentCount + 1) };
+	for (uint32_t segment = 0; segment < segmentCount; ++segment)
+	{
+		mesh.indices.insert(mesh.indices.end(), { capCenter, topRing + segment + 1, topRing + segment });
+	}
+	computeNormals(mesh);
+	return mesh;
+}
+
+const Mesh SceneGenerator::buildBoxMesh() const
+{
+	const glm::vec3 axisX{ 1.0f, 0.0f, 0.0f };
+	const glm::vec3 axisY{ 0.0f, 1.0f, 0.0f };
+	const glm::vec3 axisZ{ 0.0f, 0.0f, 1.0f };
+	const glm::vec3 faces[6][2]{ { axisY, axisZ }, { axisZ, axisY }, { axisZ, axisX }, { axisX, axisZ }, { axisX, axisY }, { axisY, axisX } };
+	const glm::vec3 color{ 0.7f, 0.6f, 0.45f };
+	Mesh mesh;
+	for (const auto& face : faces)
+	{
+		const glm::vec3 normal{ glm::cross(face[0], face[1]) };
+		addQuad(mesh, (normal - face[0] - face[1]) * 0.5f, face[0], face[1], color);
+	}
+	return mesh;
+}
+
+const Mesh SceneGenerator::buildClutterMesh(const uint32_t variant) const
+{
+	Random random{ Random::deriveSeed(sceneGeneratorCreateInfo.seed, clutterVariantStream + variant) };
+	const uint32_t bladeCount{ std::max(1u, sceneGeneratorCreateInfo.clutterTriangleCount / 4) };
+	const glm::vec3 baseColor{ random.nextFloat(0.2f, 0.35f), random.nextFloat(0.45f, 0.6f), random.nextFloat(0.15f, 0.25f) };
+	constexpr float twoPi{ 6.28318530718f };
+	Mesh mesh;
+	for (uint32_t blade = 0; blade < bladeCount; ++blade)
+	{
+		const float placementAngle{ random.nextFloat(0.0f, twoPi) };
+		const float placementRadius{ std::sqrt(random.nextFloat()) };
+		const float facingAngle{ random.nextFloat(0.0f, twoPi) };
+		const float width{ random.nextFloat(0.05f, 0.15f) };
+		const float height{ random.nextFloat(0.3f, 1.0f) };
+		const float lean{ random.nextFloat(-0.3f, 0.3f) };
+		const glm::vec3 base{ placementRadius * deterministicCos(placementAngle), 0.0f, placementRadius * deterministicSin(placementAngle) };
+		const glm::vec3 across{ width * deterministicCos(facingAngle), 0.0f, width * deterministicSin(facingAngle) };
+		const glm::vec3 up{ lean * deterministicSin(facingAngle), height, -lean * deterministicCos(facingAngle) };
+		const glm::vec3 color{ baseColor * random.nextFloat(0.8f, 1.2f) };
+		addQuad(mesh, base - across * 0.5f, across, up, color);
+		addQuad(mesh, base + across * 0.5f, -across, up, color);
+	}
+	return mesh;
+}
+
+void SceneGenerator::addQuad(Mesh& mesh, const glm::vec3& corner, const glm::vec3& edge0, const glm::vec3& edge1, const glm::vec3& color) const
+{
+	const glm::vec3 normal{ glm::normalize(glm::cross(edge0, edge1)) };
+	const uint32_t first{ static_cast<uint32_t>(mesh.vertices.size()) };
+	mesh.vertices.push_back(Vertex{ .position = corner, .color = color, .normal = normal });
+	mesh.vertices.push_back(Vertex{ .position = corner + edge0, .color = color, .normal = normal });
+	mesh.vertices.push_back(Vertex{ .position = corner + edge0 + edge1, .color = color, .normal = normal });
+	mesh.vertices.push_back(Vertex{ .position = corner + edge1, .color = color, .normal = normal });
+	mesh.indices.insert(mesh.indices.end(), { first, first + 1, first + 2, first + 2, first + 3, first });
+}
+
+void SceneGenerator::computeNormals(Mesh& mesh) const
+{
+	for (auto& vertex : mesh.vertices)
+	{
+		vertex.normal = glm::vec3(0.0f);
+	}
+	for (size_t index = 0; index + 2 < mesh.indices.size(); index += 3)
+	{
+		Vertex& vertex0{ mesh.vertices[mesh.indices[index]] };
+		Vertex& vertex1{ mesh.vertices[mesh.indices[index + 1]] };
+		Vertex& vertex2{ mesh.vertices[mesh.indices[index + 2]] };
+		const glm::vec3 faceNormal{ glm::cross(vertex1.position - vertex0.position, vertex2.position - vertex0.position) };
+		vertex0.normal += faceNormal;
+		vertex1.normal += faceNormal;
+		vertex2.normal += faceNormal;
+	}
+	for (auto& vertex : mesh.vertices)
+	{
+		const float normalLength{ glm::length(vertex.normal) };
+		vertex.normal = normalLength > 0.0f ? vertex.normal / normalLength : glm::vec3(0.0f, 1.0f, 0.0f);
+	}
+}
+
+void SceneGenerator::computeBounds(Mesh& mesh) const
+{
+	if (mesh.vertices.empty())
+	{
+		return;
+	}
+	glm::vec3 minimum{ mesh.vertices[0].position };
+	glm::vec3 maximum{ mesh.vertices[0].position };
+	for (const auto& vertex : mesh.vertices)
+	{
+		minimum = glm::min(minimum, vertex.position);
+		maximum = glm::max(maximum, vertex.position);
+	}
+	mesh.boundsCenter = (minimum + maximum) * 0.5f;
+	mesh.boundsRadius = 0.0f;
+	for (const auto& vertex : mesh.vertices)
+	{
+		mesh.boundsRadius = std::max(mesh.boundsRadius, glm::distance(vertex.position, mesh.boundsCenter));
+	}
+}
+
+void SceneGenerator::placeObjects(Scene& scene, const std::vector<Mesh>& meshes, ThreadPool& threadPool) const
+{
+	std::vector<SceneObjectCreateInfo> objects;
+	objects.push_back(buildObject(terrainMeshIndex, glm::vec3(0.0f), 0.0f, glm::vec3(1.0f)));
+	const auto placeColumnArray = [this](Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& groupObjects) { this->placeColumnArray(random, groupIndex, groupObjects); };
+	const auto placeBoxStack = [this](Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& groupObjects) { this->placeBoxStack(random, groupIndex, groupObjects); };
+	const auto placeClutterPatch = [this](Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& groupObjects) { this->placeClutterPatch(random, groupIndex, groupObjects); };
+	placeGroups(objects, (sceneGeneratorCreateInfo.columnCount + columnsPerArray - 1) / columnsPerArray, columnArrayStream, threadPool, placeColumnArray);
+	placeGroups(objects, (sceneGeneratorCreateInfo.boxCount + boxesPerStack - 1) / boxesPerStack, boxStackStream, threadPool, placeBoxStack);
+	placeGroups(objects, (sceneGeneratorCreateInfo.clutterCount + clutterPerPatch - 1) / clutterPerPatch, clutterPatchStream, threadPool, placeClutterPatch);
+	scene.reserve(objects.size());
+	for (auto& object : objects)
+	{
+		object.boundsCenter = meshes[object.meshIndex].boundsCenter;
+		object.boundsRadius = meshes[object.meshIndex].boundsRadius;
+		scene.addObject(object);
+	}
+}
+
+void SceneGenerator::placeGroups(std::vector<SceneObjectCreateInfo>& objects, const uint32_t groupCount, const uint64_t stream, ThreadPool& threadPool, const std::function<void(Random&, const uint32_t, std::vector<SceneObjectCreateInfo>&)>& placeGroup) const
+{
+	std::vector<std::vector<SceneObjectCreateInfo>> groups(groupCount);
+	const size_t groupsPerChunk{ 16 };
+	threadPool.parallelFor(groupCount, groupsPerChunk, [&](const size_t, const size_t begin, const size_t end)
+	{
+		for (size_t groupIndex = begin; groupIndex < end; ++groupIndex)
+		{
+			Random random{ Random::deriveSeed(sceneGeneratorCreateInfo.seed, stream + groupIndex) };
+			placeGroup(random, static_cast<uint32_t>(groupIndex), groups[groupIndex]);
+		}
+	});
+	for (const auto& group : groups)
+	{
+		objects.insert(objects.end(), group.begin(), group.end());
+	}
+}
+
+void SceneGenerator::placeColumnArray(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const
+{
+	const uint32_t columnCount{ std::min(columnsPerArray, sceneGeneratorCreateInfo.columnCount - groupIndex * columnsPerArray) };
+	const float halfExtent{ 0.4f * sceneGeneratorCreateInfo.extent };
+	const glm::vec3 origin{ random.nextFloat(-halfExtent, halfExtent), 0.0f, random.nextFloat(-halfExtent, halfExtent) };
+	const float orientation{ random.nextFloat(0.0f, 3.14159265f) };
+	const glm::vec3 rowDirection{ deterministicCos(orientation), 0.0f, deterministicSin(orientation) };
+	const glm::vec3 columnDirection{ -rowDirection.z, 0.0f, rowDirection.x };
+	const float spacing{ random.nextFloat(3.0f, 5.0f) };
+	const uint32_t columnsPerRow{ columnsPerArray / 2 };
+	for (uint32_t column = 0; column < columnCount; ++column)
+	{
+		glm::vec3 position{ origin + rowDirection * (spacing * (column % columnsPerRow)) + columnDirection * (spacing * 2.0f * (column / columnsPerRow)) };
+		position.y = terrainHeight(position.x, position.z) - 0.5f;
+		const float radius{ random.nextFloat(0.5f, 0.8f) };
+		const float height{ random.nextFloat(8.0f, 12.0f) };
+		const uint32_t variant{ random.nextUint(std::max(1u, sceneGeneratorCreateInfo.variantCount)) };
+		objects.push_back(buildObject(firstColumnMeshIndex + variant, position, random.nextFloat(0.0f, 6.28318530718f), glm::vec3(radius, height, radius)));
+	}
+}
+
+void SceneGenerator::placeBoxStack(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const
+{
+	const uint32_t boxCount{ std::min(boxesPerStack, sceneGeneratorCreateInfo.boxCount - groupIndex * boxesPerStack) };
+	const float halfExtent{ 0.45f * sceneGeneratorCreateInfo.extent };
+	const glm::vec3 origin{ random.nextFloat(-halfExtent, halfExtent), 0.0f, random.nextFloat(-halfExtent, halfExtent) };
+	float stackHeight{ terrainHeight(origin.x, origin.z) - 0.2f };
+	float previousSize{ 3.0f };
+	for (uint32_t box = 0; box < boxCount; ++box)
+	{
+		const float size{ std::min(previousSize, random.nextFloat(0.8f, 2.5f)) };
+		const glm::vec3 offset{ random.nextFloat(-0.2f, 0.2f) * size, 0.0f, random.nextFloat(-0.2f, 0.2f) * size };
+		const glm::vec3 position{ origin.x + offset.x, stackHeight + 0.5f * size, origin.z + offset.z };
+		objects.push_back(buildObject(boxMeshIndex, position, random.nextFloat(-0.4f, 0.4f), glm::vec3(size)));
+		stackHeight += size;
+		previousSize = size;
+	}
+}
+
+void SceneGenerator::placeClutterPatch(Random& random, const uint32_t groupIndex, std::vector<SceneObjectCreateInfo>& objects) const
+{
+	const uint32_t clutterCount{ std::min(clutterPerPatch, sceneGeneratorCreateInfo.clutterCount - groupIndex * clutterPerPatch) };
+	const float halfExtent{ 0.48f * sceneGeneratorCreateInfo.extent };
+	const glm::vec3 center{ random.nextFloat(-halfExtent, halfExtent), 0.0f, random.nextFloat(-halfExtent, halfExtent) };
+	for (uint32_t clutter = 0; clutter < clutterCount; ++clutter)
+	{
+		const float angle{ random.nextFloat(0.0f, 6.28318530718f) };
+		const float distance{ 6.0f * std::sqrt(random.nextFloat()) };
+		glm::vec3 position{ center.x + distance * deterministicCos(angle), 0.0f, center.z + distance * deterministicSin(angle) };
+		position.y = terrainHeight(position.x, position.z);
+		const uint32_t variant{ random.nextUint(std::max(1u, sceneGeneratorCreateInfo.variantCount)) };
+		const float scale{ random.nextFloat(0.5f, 1.5f) };
+		objects.push_back(buildObject(firstClutterMeshIndex + variant, position, random.nextFloat(0.0f, 6.28318530718f), glm::vec3(scale)));
+	}
+}
+
+const SceneObjectCreateInfo SceneGenerator::buildObject(const uint32_t meshIndex, const glm::vec3& position, const float rotation, const glm::vec3& scale) const
+{
+	const float cosine{ deterministicCos(rotation) };
+	const float sine{ deterministicSin(rotation) };
+	glm::mat4 transform{ 1.0f };
+	transform[0] = glm::vec4(cosine * scale.x, 0.0f, -sine * scale.x, 0.0f);
+	transform[1] = glm::vec4(0.0f, scale.y, 0.0f, 0.0f);
+	transform[2] = glm::vec4(sine * scale.z, 0.0f, cosine * scale.z, 0.0f);
+	transform[3] = glm::vec4(position, 1.0f);
+	return SceneObjectCreateInfo{
+		.meshIndex = meshIndex,
+		.boundsCenter = glm::vec3(0.0f),
+		.boundsRadius = 0.0f,
+		.transform = transform
+	};
+}
+
+const float SceneGenerator::terrainHeight(const float x, const float z) const
+{
+	float height{ 0.0f };
+	float amplitude{ 6.0f };
+	float frequency{ 1.0f / 40.0f };
+	for (uint32_t octave = 0; octave < 4; ++octave)
+	{
+		height += amplitude * (2.0f * valueNoise(x * frequency, z * frequency, octave) - 1.0f);
+		amplitude *= 0.5f;
+		frequency *= 2.0f;
+	}
+	const float ridge{ 1.0f - std::abs(2.0f * valueNoise(x / 25.0f, z / 25.0f, 4) - 1.0f) };
+	const float ridgeSquared{ ridge * ridge };
+	const float ridgeToTheFourth{ ridgeSquared * ridgeSquared };
+	return height - 5.0f * ridgeToTheFourth * ridgeToTheFourth;
+}
+
+const glm::vec3 SceneGenerator::terrainNormal(const float x, const float z, const float step) const
+{
+	const float heightLeft{ terrainHeight(x - step, z) };
+	const float heightRight{ terrainHeight(x + step, z) };
+	const float heightBack{ terrainHeight(x, z - step) };
+	const float heightFront{ terrainHeight(x, z + step) };
+	return glm::normalize(glm::vec3(heightLeft - heightRight, 2.0f * step, heightBack - heightFront));
+}
+
+const float SceneGenerator::valueNoise(const float x, const float z, const uint32_t octave) const
+{
+	const float cellX{ std::floor(x) };
+	const float cellZ{ std::floor(z) };
+	const float fractionX{ x - cellX };
+	const float fractionZ{ z - cellZ };
+	const float smoothX{ fractionX * fractionX * (3.0f - 2.0f * fractionX) };
+	const float smoothZ{ fractionZ * fractionZ * (3.0f - 2.0f * fractionZ) };
+	const int32_t latticeX{ static_cast<int32_t>(cellX) };
+	const int32_t latticeZ{ static_cast<int32_t>(cellZ) };
+	const float bottom{ glm::mix(latticeValue(latticeX, latticeZ, octave), latticeValue(latticeX + 1, latticeZ, octave), smoothX) };
+	const float top{ glm::mix(latticeValue(latticeX, latticeZ + 1, octave), latticeValue(latticeX + 1, latticeZ + 1, octave), smoothX) };
+	return glm::mix(bottom, top, smoothZ);
+}
+
+const float SceneGenerator::latticeValue(const int32_t x, const int32_t z, const uint32_t octave) const
+{
+	const uint64_t lattice{ (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z) };
+	const uint64_t hash{ Random::deriveSeed(sceneGeneratorCreateInfo.seed + octave, lattice) };
+	return static_cast<float>(hash >> 40) * (1.0f / 16777216.0f);
+}
+
+const float SceneGenerator::deterministicSin(const float angle)
+{
+	constexpr double pi{ 3.14159265358979323846 };
+	double x{ angle - 2.0 * pi * std::floor(angle / (2.0 * pi) + 0.5) };
+	x = x > 0.5 * pi ? pi - x : (x < -0.5 * pi ? -pi - x : x);
+	const double x2{ x * x };
+	return static_cast<float>(x * (1.0 - x2 / 6.0 * (1.0 - x2 / 20.0 * (1.0 - x2 / 42.0 * (1.0 - x2 / 72.0 * (1.0 - x2 / 110.0))))));
+}
+
+const float SceneGenerator::deterministicCos(const float angle)
+{
+	return deterministicSin(angle + 1.57079632679f);
+}
@@ -0,0 +1,232 @@
+#include "ShaderCompiler.h"
+
+ShaderCompiler::ShaderCompiler(const ShaderCompilerCreateInfo& shaderCompilerCreateInfo) : cacheDirectory(shaderCompilerCreateInfo.cacheDirectory),
+	isOptimizationEnabled(shaderCompilerCreateInfo.isOptimizationEnabled)
+{
+	if (!compiler.IsValid())
+	{
+		throw std::runtime_error("Error in ShaderCompiler! Unable to initialize the shader compiler");
+	}
+}
+
+const CompiledShader ShaderCompiler::compile(const ShaderSourceDescription& shaderSourceDescription)
+{
+	const auto start{ std::chrono::steady_clock::now() };
+	CompiledShader compiledShader{};
+	collectDependencies(shaderSourceDescription.path.lexically_normal(), compiledShader.dependencies);
+	compiledShader.hash = computeHash(shaderSourceDescription, compiledShader.dependencies);
+	const std::optional<std::vector<uint32_t>> cachedSpirv{ loadCachedSpirv(compiledShader.hash) };
+	compiledShader.isCached = cachedSpirv.has_value();
+	if (compiledShader.isCached)
+	{
+		compiledShader.spirv = cachedSpirv.value();
+		++shaderCompilerStatistics.cachedShaderCount;
+	}
+	else
+	{
+		compiledShader.spirv = compileSource(shaderSourceDescription);
+		storeCachedSpirv(compiledShader.hash, compiledShader.spirv);
+		++shaderCompilerStatistics.compiledShaderCount;
+	}
+	shaderCompilerStatistics.compilationMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return compiledShader;
+}
+
+const shaderc_shader_kind ShaderCompiler::toShaderKind(const vk::ShaderStageFlagBits stage)
+{
+	switch (stage)
+	{
+	case vk::ShaderStageFlagBits::eVertex:
+		return shaderc_vertex_shader;
+	case vk::ShaderStageFlagBits::eFragment:
+		return shaderc_fragment_shader;
+	case vk::ShaderStageFlagBits::eCompute:
+		return shaderc_compute_shader;
+	default:
+		throw std::runtime_error("Error in ShaderCompiler! Shader stage is not supported");
+	}
+}
+
+void ShaderCompiler::hashBytes(uint64_t& hash, const void* data, const size_t size)
+{
+	const uint8_t* bytes{ static_cast<const uint8_t*>(data) };
+	for (size_t byteIndex = 0; byteIndex < size; ++byteIndex)
+	{
+		hash = (hash ^ bytes[byteIndex]) * 1099511628211ull;
+	}
+}
+
+const std::string ShaderCompiler::readSource(const std::filesystem::path& path) const
+{
+	std::ifstream file(path, std::ios::binary);
+	ExceptionChecker::throwExceptionIfFileCouldNotBeOpened(file, path.string().c_str());
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	return buffer.str();
+}
+
+const std::string ShaderCompiler::stripComments(const std::string& source)
+{
+	std::string strippedSource;
+	strippedSource.reserve(source.size());
+	bool isInsideBlockComment{ false };
+	bool isInsideLineComment{ false };
+	bool isInsideString{ false };
+	for (size_t characterIndex = 0; characterIndex < source.size(); ++characterIndex)
+	{
+		const char character{ source[characterIndex] };
+		const char nextCharacter{ characterIndex + 1 < source.size() ? source[characterIndex + 1] : '\0' };
+		if (isInsideBlockComment)
+		{
+			if (character == '*' && nextCharacter == '/')
+			{
+				isInsideBlockComment = false;
+				++characterIndex;
+			}
+			else if (character == '\n')
+			{
+				strippedSource.push_back(character);
+			}
+			continue;
+		}
+		if (isInsideLineComment)
+		{
+			if (character == '\n')
+			{
+				isInsideLineComment = false;
+				strippedSource.push_back(character);
+			}
+			continue;
+		}
+		if (!isInsideString && character == '/' && nextCharacter == '*')
+		{
+			isInsideBlockComment = true;
+			strippedSource.push_back(' ');
+			++characterIndex;
+			continue;
+		}
+		if (!isInsideString && character == '/' && nextCharacter == '/')
+		{
+			isInsideLineComment = true;
+			continue;
+		}
+		if (character == '"' || (isInsideString && character == '\n'))
+		{
+			isInsideString = !isInsideString && character == '"';
+		}
+		strippedSource.push_back(character);
+	}
+	return strippedSource;
+}
+
+void ShaderCompiler::collectDependencies(const std::filesystem::path& path, std::vector<std::filesystem::path>& dependencies) const
+{
+	if (std::find(dependencies.begin(), dependencies.end(), path) != dependencies.end())
+	{
+		return;
+	}
+	dependencies.push_back(path);
+	const std::regex includePattern{ "^[ \\t]*#[ \\t]*include[ \\t]*[<\"]([^>\"]+)[>\"]" };
+	std::istringstream source{ stripComments(readSource(path)) };
+	std::string line;
+	while (std::getline(source, line))
+	{
+		std::smatch match;
+		if (std::regex_search(line, match, includePattern))
+		{
+			collectDependencies(ShaderIncluder::resolve(match[1].str(), path), dependencies);
+		}
+	}
+}
+
+const uint64_t ShaderCompiler::computeHash(const ShaderSourceDescription& shaderSourceDescription, const std::vector<std::filesystem::path>& dependencies) const
+{
+	uint64_t hash{ 14695981039346656037ull };
+	const uint32_t stage{ static_cast<uint32_t>(shaderSourceDescription.stage) };
+	hashBytes(hash, &stage, sizeof(stage));
+	hashBytes(hash, &isOptimizationEnabled, sizeof(isOptimizationEnabled));
+	for (const auto& shaderDefine : shaderSourceDescription.defines)
+	{
+		hashBytes(hash, shaderDefine.name.data(), shaderDefine.name.size() + 1);
+		hashBytes(hash, shaderDefine.value.data(), shaderDefine.value.size() + 1);
+	}
+	for (const auto& dependency : dependencies)
+	{
+		const std::string dependencyName{ dependency.generic_string() };
+		const std::string dependencySource{ readSource(dependency) };
+		hashBytes(hash, dependencyName.data(), dependencyName.size() + 1);
+		hashBytes(hash, dependencySource.data(), dependencySource.size());
+	}
+	return hash;
+}
+
+const std::filesystem::path ShaderCompiler::buildCachePath(const uint64_t hash) const
+{
+	std::ostringstream fileName;
+	fileName << std::hex << std::setfill('0') << std::setw(16) << hash << ".spv";
+	return cacheDirectory / fileName.str();
+}
+
+const std::optional<std::vector<uint32_t>> ShaderCompiler::loadCachedSpirv(const uint64_t hash) const
+{
+	std::ifstream file(buildCachePath(hash), std::ios::ate | std::ios::binary);
+	if (!file.is_open())
+	{
+		return std::nullopt;
+	}
+	const size_t fileSize{ static_cast<size_t>(file.tellg()) };
+	if (fileSize == 0 || fileSize % sizeof(uint32_t) != 0)
+	{
+		return std::nullopt;
+	}
+	std::vector<uint32_t> spirv(fileSize / sizeof(uint32_t));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(spirv.data()), fileSize);
+	if (!file)
+	{
+		return std::nullopt;
+	}
+	return spirv;
+}
+
+void ShaderCompiler::storeCachedSpirv(const uint64_t hash, const std::vector<uint32_t>& spirv) const
+{
+	std::error_code errorCode;
+	std::filesystem::create_directories(cacheDirectory, errorCode);
+	const std::filesystem::path cachePath{ buildCachePath(hash) };
+	std::filesystem::path temporaryCachePath{ cachePath };
+	temporaryCachePath += ".tmp";
+	{
+		std::ofstream file(temporaryCachePath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			return;
+		}
+		file.write(reinterpret_cast<const char*>(spirv.data()), spirv.size() * sizeof(uint32_t));
+	}
+	std::filesystem::rename(temporaryCachePath, cachePath, errorCode);
+}
+
+const std::vector<uint32_t> ShaderCompiler::compileSource(const ShaderSourceDescription& shaderSourceDescription) const
+{
+	shaderc::CompileOptions compileOptions;
+	compileOptions.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
+	compileOptions.SetOptimizationLevel(isOptimizationEnabled ? shaderc_optimization_level_performance : shaderc_optimization_level_zero);
+	compileOptions.SetIncluder(std::make_unique<ShaderIncluder>());
+	for (const auto& shaderDefine : shaderSourceDescription.defines)
+	{
+		compileOptions.AddMacroDefinition(shaderDefine.name, shaderDefine.value);
+	}
+	const std::string path{ shaderSourceDescription.path.lexically_normal().string() };
+	const shaderc::SpvCompilationResult compilationResult{ compiler.CompileGlslToSpv(readSource(shaderSourceDescription.path), toShaderKind(shaderSourceDescription.stage), path.c_str(), compileOptions) };
+	if (compilationResult.GetCompilationStatus() != shaderc_compilation_status_success)
+	{
+		throw std::runtime_error("Error in ShaderCompiler! Unable to compile " + path + ":\n" + compilationResult.GetErrorMessage());
+	}
+	return std::vector<uint32_t>(compilationResult.cbegin(), compilationResult.cend());
+}
+
+const ShaderCompilerStatistics ShaderCompiler::getStatistics() const
+{
+	return shaderCompilerStatistics;
+}
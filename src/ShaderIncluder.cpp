@@ -0,0 +1,37 @@
+#include "ShaderIncluder.h"
+
+shaderc_include_result* ShaderIncluder::GetInclude(const char* requestedSource, shaderc_include_type type, const char* requestingSource, size_t includeDepth)
+{
+	auto includeResult{ new IncludeResult };
+	const std::filesystem::path includePath{ resolve(requestedSource, requestingSource) };
+	std::ifstream file(includePath, std::ios::binary);
+	if (file.is_open())
+	{
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		includeResult->sourceName = includePath.string();
+		includeResult->content = buffer.str();
+	}
+	else
+	{
+		includeResult->content = "Unable to open included file " + includePath.string();
+	}
+	includeResult->result = shaderc_include_result{
+		.source_name = includeResult->sourceName.c_str(),
+		.source_name_length = includeResult->sourceName.size(),
+		.content = includeResult->content.c_str(),
+		.content_length = includeResult->content.size(),
+		.user_data = includeResult
+	};
+	return &includeResult->result;
+}
+
+void ShaderIncluder::ReleaseInclude(shaderc_include_result* data)
+{
+	delete static_cast<IncludeResult*>(data->user_data);
+}
+
+const std::filesystem::path ShaderIncluder::resolve(const std::filesystem::path& requestedSource, const std::filesystem::path& requestingSource)
+{
+	return (requestingSource.parent_path() / requestedSource).lexically_normal();
+}
@@ -0,0 +1,124 @@
+#include "ShaderWatcher.h"
+
+ShaderWatcher::ShaderWatcher(const std::filesystem::path& directory)
+{
+#ifdef __linux__
+	inotifyFileDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+	addDirectory(directory.lexically_normal());
+	if (inotifyFileDescriptor < 0)
+	{
+		lastWriteTimes = scanDirectories();
+	}
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+#ifdef __linux__
+	if (inotifyFileDescriptor >= 0)
+	{
+		close(inotifyFileDescriptor);
+	}
+#endif
+}
+
+void ShaderWatcher::watch(const std::set<std::filesystem::path>& files)
+{
+	bool isDirectoryAdded{ false };
+	for (const auto& file : files)
+	{
+		const std::filesystem::path directory{ file.lexically_normal().parent_path() };
+		if (!directories.contains(directory))
+		{
+			addDirectory(directory);
+			isDirectoryAdded = true;
+		}
+	}
+	if (isDirectoryAdded && inotifyFileDescriptor < 0)
+	{
+		lastWriteTimes = scanDirectories();
+	}
+}
+
+void ShaderWatcher::addDirectory(const std::filesystem::path& directory)
+{
+	directories.insert(directory);
+#ifdef __linux__
+	if (inotifyFileDescriptor < 0)
+	{
+		return;
+	}
+	const std::filesystem::path watchedDirectory{ directory.empty() ? std::filesystem::path{ "." } : directory };
+	const int watchDescriptor{ inotify_add_watch(inotifyFileDescriptor, watchedDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) };
+	if (watchDescriptor < 0)
+	{
+		fallBackToPolling();
+		return;
+	}
+	watchDescriptorDirectories[watchDescriptor] = directory;
+#endif
+}
+
+void ShaderWatcher::fallBackToPolling()
+{
+#ifdef __linux__
+	close(inotifyFileDescriptor);
+	inotifyFileDescriptor = -1;
+	watchDescriptorDirectories.clear();
+#endif
+	lastWriteTimes = scanDirectories();
+}
+
+const std::set<std::filesystem::path> ShaderWatcher::poll()
+{
+	std::set<std::filesystem::path> changedFiles;
+#ifdef __linux__
+	if (inotifyFileDescriptor >= 0)
+	{
+		alignas(inotify_event) char eventBuffer[4096];
+		ssize_t readSize;
+		while ((readSize = read(inotifyFileDescriptor, eventBuffer, sizeof(eventBuffer))) > 0)
+		{
+			for (ssize_t eventOffset = 0; eventOffset < readSize;)
+			{
+				const inotify_event* event{ reinterpret_cast<const inotify_event*>(eventBuffer + eventOffset) };
+				const auto watchDescriptorDirectory{ watchDescriptorDirectories.find(event->wd) };
+				if (event->len > 0 && watchDescriptorDirectory != watchDescriptorDirectories.end())
+				{
+					changedFiles.insert(watchDescriptorDirectory->second / event->name);
+				}
+				eventOffset += sizeof(inotify_event) + event->len;
+			}
+		}
+		return changedFiles;
+	}
+#endif
+	const std::map<std::filesystem::path, std::filesystem::file_time_type> currentWriteTimes{ scanDirectories() };
+	for (const auto& [path, writeTime] : currentWriteTimes)
+	{
+		const auto lastWriteTime{ lastWriteTimes.find(path) };
+		if (lastWriteTime == lastWriteTimes.end() || lastWriteTime->second != writeTime)
+		{
+			changedFiles.insert(path);
+		}
+	}
+	lastWriteTimes = currentWriteTimes;
+	return changedFiles;
+}
+
+const std::map<std::filesystem::path, std::filesystem::file_time_type> ShaderWatcher::scanDirectories() const
+{
+	std::map<std::filesystem::path, std::filesystem::file_time_type> writeTimes;
+	std::error_code errorCode;
+	for (const auto& directory : directories)
+	{
+		for (const auto& directoryEntry : std::filesystem::directory_iterator(directory.empty() ? std::filesystem::path{ "." } : directory, errorCode))
+		{
+			if (directoryEntry.is_regular_file(errorCode))
+			{
+				writeTimes[(directory / directoryEntry.path().filename()).lexically_normal()] = directoryEntry.last_write_time(errorCode);
+			}
+		}
+	}
+	return writeTimes;
+}
@@ -0,0 +1,11 @@
+#include "SpecializationConstants.h"
+
+const vk::SpecializationInfo SpecializationConstants::buildSpecializationInfo() const
+{
+	return vk::SpecializationInfo{
+		.mapEntryCount = static_cast<uint32_t>(mapEntries.size()),
+		.pMapEntries = mapEntries.data(),
+		.dataSize = data.size(),
+		.pData = data.data()
+	};
+}
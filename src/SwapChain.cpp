@@ -8,6 +8,7 @@ SwapChain::SwapChain(const SwapChainCreateInfo& swapChainCreateInfo) : swapChain
     chooseSwapSurfaceFormat(availableFormats);
     chooseSwapPresentMode(availablePresentModes);
     chooseSwapExtent(capabilities, swapChainCreateInfo.framebufferSize);
+    chooseSwapImageUsage(capabilities);
     buildVulkanSwapChain(swapChainCreateInfo, capabilities, estimateImageCount(capabilities));
     buildSwapChainImageViews(swapChainCreateInfo);
 }
@@ -19,11 +20,13 @@ SwapChain::~SwapChain()
 
 void SwapChain::cleanup()
 {
-    for (int imageIndex = 0; imageIndex < imageViews.size(); imageIndex++)
+    for (auto& retiredSwapChain : retiredSwapChains)
     {
-        framebuffers[imageIndex].reset();
-        imageViews[imageIndex].reset();
+        destroyRetiredSwapChain(retiredSwapChain);
     }
+    retiredSwapChains.clear();
+    framebuffers.clear();
+    imageViews.clear();
     swapChainCreateInfo.vulkanLogicalDevice.destroySwapchainKHR(vulkanSwapChain);
 }
 
@@ -45,7 +48,7 @@ void SwapChain::chooseSwapPresentMode(const std::vector<vk::PresentModeKHR>& ava
     presentMode = vk::PresentModeKHR::eFifo;
     for (const auto& availablePresentMode : availablePresentModes) 
     {
-        if (availablePresentMode == vk::PresentModeKHR::eMailbox) 
+        if (availablePresentMode == swapChainCreateInfo.requestedPresentMode) 
         {
             presentMode = availablePresentMode;
             return;
@@ -67,6 +70,11 @@ void SwapChain::chooseSwapExtent(const vk::SurfaceCapabilitiesKHR& capabilities,
     }
 }
 
+void SwapChain::chooseSwapImageUsage(const vk::SurfaceCapabilitiesKHR& capabilities)
+{
+    imageUsage = vk::ImageUsageFlagBits::eColorAttachment | (swapChainCreateInfo.requestedImageUsage & capabilities.supportedUsageFlags);
+}
+
 const uint32_t SwapChain::estimateImageCount(const vk::SurfaceCapabilitiesKHR& capabilities)
 {
     uint32_t imageCount{ capabilities.minImageCount + 1 };
@@ -84,7 +92,7 @@ const bool SwapChain::isValid(const vk::PhysicalDevice& vulkanPhysicalDevice, co
     return !availableFormats.empty() && !availablePresentModes.empty();
 }
 
-void SwapChain::buildVulkanSwapChain(const SwapChainCreateInfo& swapChainCreateInfo, const vk::SurfaceCapabilitiesKHR& capabilities, const uint32_t imageCount)
+void SwapChain::buildVulkanSwapChain(const SwapChainCreateInfo& swapChainCreateInfo, const vk::SurfaceCapabilitiesKHR& capabilities, const uint32_t imageCount, const vk::SwapchainKHR& oldVulkanSwapChain)
 {
     std::optional<uint32_t> graphicsFamilyIndex{ swapChainCreateInfo.queueFamilyIndices.getGraphicsFamilyIndex() };
     std::optional<uint32_t> presentFamilyIndex{ swapChainCreateInfo.queueFamilyIndices.getPresentFamilyIndex() };
@@ -96,13 +104,15 @@ void SwapChain::buildVulkanSwapChain(const SwapChainCreateInfo& swapChainCreateI
         .imageColorSpace = surfaceFormat.colorSpace,
         .imageExtent = extent,
         .imageArrayLayers = 1,
-        .imageUsage = vk::ImageUsageFlagBits::eColorAttachment,
+        .imageUsage = imageUsage,
         .imageSharingMode = (graphicsFamilyIndex != presentFamilyIndex) ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
         .queueFamilyIndexCount = (graphicsFamilyIndex != presentFamilyIndex) ? static_cast<uint32_t>(2) : static_cast<uint32_t>(0),
         .pQueueFamilyIndices = (graphicsFamilyIndex != presentFamilyIndex) ? queueFamilyIndices : nullptr,
         .preTransform = capabilities.currentTransform,
         .compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque,
-        .presentMode = presentMode
+        .presentMode = presentMode,
+        .clipped = VK_TRUE,
+        .oldSwapchain = oldVulkanSwapChain
     };
     vulkanSwapChain = swapChainCreateInfo.vulkanLogicalDevice.createSwapchainKHR(swapChainCreateInfoKHR);
     images = swapChainCreateInfo.vulkanLogicalDevice.getSwapchainImagesKHR(vulkanSwapChain);
@@ -137,24 +147,58 @@ void SwapChain::recreateIfResultIsOutOfDateOrSuboptimalKHR(vk::Result& result, c
 {
     if (result == vk::Result::eErrorOutOfDateKHR || result == vk::Result::eSuboptimalKHR)
     {
-        waitValidFramebufferSize(swapChainRecreateInfo.getFramebufferSize, swapChainRecreateInfo.waitEvents);
-        swapChainCreateInfo.vulkanLogicalDevice.waitIdle();
-        cleanup();
-        buildVulkanSwapChain(swapChainCreateInfo, swapChainCreateInfo.vulkanPhysicalDevice.getSurfaceCapabilitiesKHR(swapChainCreateInfo.vulkanWindowSurface), static_cast<const uint32_t>(images.size()));
+        const WindowSize framebufferSize{ waitValidFramebufferSize(swapChainRecreateInfo.getFramebufferSize, swapChainRecreateInfo.waitEvents) };
+        const vk::SurfaceCapabilitiesKHR capabilities{ swapChainCreateInfo.vulkanPhysicalDevice.getSurfaceCapabilitiesKHR(swapChainCreateInfo.vulkanWindowSurface) };
+        chooseSwapExtent(capabilities, framebufferSize);
+        retire(swapChainRecreateInfo.frameNumber);
+        buildVulkanSwapChain(swapChainCreateInfo, capabilities, estimateImageCount(capabilities), retiredSwapChains.back().vulkanSwapChain);
         buildSwapChainImageViews(swapChainCreateInfo);
         buildFramebuffers(swapChainCreateInfo.vulkanLogicalDevice, swapChainRecreateInfo.vulkanRenderPass);
         result = vk::Result::eSuccess;
     }
 }
 
-void SwapChain::waitValidFramebufferSize(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
+void SwapChain::retire(const uint64_t frameNumber)
+{
+    retiredSwapChains.push_back(RetiredSwapChain{
+        .vulkanSwapChain = vulkanSwapChain,
+        .imageViews = std::move(imageViews),
+        .framebuffers = std::move(framebuffers),
+        .frameNumber = frameNumber
+    });
+    imageViews.clear();
+    framebuffers.clear();
+}
+
+void SwapChain::releaseRetiredSwapChains(const uint64_t completedFrameCount)
+{
+    std::erase_if(retiredSwapChains, [&](RetiredSwapChain& retiredSwapChain)
+    {
+        if (retiredSwapChain.frameNumber + 1 >= completedFrameCount)
+        {
+            return false;
+        }
+        destroyRetiredSwapChain(retiredSwapChain);
+        return true;
+    });
+}
+
+void SwapChain::destroyRetiredSwapChain(RetiredSwapChain& retiredSwapChain)
+{
+    retiredSwapChain.framebuffers.clear();
+    retiredSwapChain.imageViews.clear();
+    swapChainCreateInfo.vulkanLogicalDevice.destroySwapchainKHR(retiredSwapChain.vulkanSwapChain);
+}
+
+const WindowSize SwapChain::waitValidFramebufferSize(std::function<WindowSize()> getFramebufferSize, std::function<void()> waitEvents)
 {
     WindowSize framebufferSize = getFramebufferSize();
     while (framebufferSize.width == 0 || framebufferSize.height == 0)
     {
-        framebufferSize = getFramebufferSize();
         waitEvents();
+        framebufferSize = getFramebufferSize();
     }
+    return framebufferSize;
 }
 
 const vk::Extent2D SwapChain::getExtent() const
@@ -167,11 +211,31 @@ const vk::Framebuffer SwapChain::getVulkanFramebuffer(const int framebufferIndex
     return framebuffers[framebufferIndex]->getVulkanFramebuffer();
 }
 
+const vk::Image SwapChain::getVulkanImage(const int imageIndex) const
+{
+    return images[imageIndex];
+}
+
+const uint32_t SwapChain::getImageCount() const
+{
+    return static_cast<uint32_t>(images.size());
+}
+
 const vk::SurfaceFormatKHR SwapChain::getSurfaceFormat() const
 {
     return surfaceFormat;
 }
 
+const vk::PresentModeKHR SwapChain::getPresentMode() const
+{
+    return presentMode;
+}
+
+const vk::ImageUsageFlags SwapChain::getImageUsage() const
+{
+    return imageUsage;
+}
+
 const vk::SwapchainKHR SwapChain::getVulkanSwapChain() const
 {
     return vulkanSwapChain;
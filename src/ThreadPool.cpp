@@ -0,0 +1,91 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(const unsigned int threadCount)
+{
+	workers.reserve(threadCount);
+	for (unsigned int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+	{
+		workers.emplace_back(&ThreadPool::runWorker, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(tasksMutex);
+		isStopping = true;
+	}
+	tasksCondition.notify_all();
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::runWorker()
+{
+	while (true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(tasksMutex);
+			tasksCondition.wait(lock, [this]() { return isStopping || !tasks.empty(); });
+			if (isStopping && tasks.empty())
+			{
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+		task();
+	}
+}
+
+void ThreadPool::parallelFor(const size_t count, const size_t chunkSize, const std::function<void(const size_t, const size_t, const size_t)>& task)
+{
+	const size_t chunkCount{ (count + chunkSize - 1) / chunkSize };
+	std::atomic<size_t> nextChunk{ 0 };
+	const auto runChunks = [&]()
+	{
+		for (size_t chunkIndex = nextChunk++; chunkIndex < chunkCount; chunkIndex = nextChunk++)
+		{
+			task(chunkIndex, chunkIndex * chunkSize, std::min(count, (chunkIndex + 1) * chunkSize));
+		}
+	};
+	const size_t helperCount{ std::min(workers.size(), chunkCount > 0 ? chunkCount - 1 : 0) };
+	std::vector<std::future<void>> helpers;
+	helpers.reserve(helperCount);
+	for (size_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+	{
+		helpers.push_back(submit(runChunks));
+	}
+	std::exception_ptr exception;
+	try
+	{
+		runChunks();
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
+	}
+	for (auto& helper : helpers)
+	{
+		try
+		{
+			helper.get();
+		}
+		catch (...)
+		{
+			exception = exception ? exception : std::current_exception();
+		}
+	}
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+}
+
+const unsigned int ThreadPool::getThreadCount() const
+{
+	return static_cast<unsigned int>(workers.size());
+}
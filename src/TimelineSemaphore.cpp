@@ -0,0 +1,54 @@
+#include "TimelineSemaphore.h"
+
+TimelineSemaphore::TimelineSemaphore(const vk::Device& vulkanLogicalDevice) : vulkanLogicalDevice(vulkanLogicalDevice)
+{
+	const vk::SemaphoreTypeCreateInfo semaphoreTypeCreateInfo{
+		.semaphoreType = vk::SemaphoreType::eTimeline,
+		.initialValue = 0
+	};
+	const vk::SemaphoreCreateInfo semaphoreCreateInfo{ .pNext = &semaphoreTypeCreateInfo };
+	vulkanSemaphore = vulkanLogicalDevice.createSemaphore(semaphoreCreateInfo);
+}
+
+TimelineSemaphore::~TimelineSemaphore()
+{
+	vulkanLogicalDevice.destroySemaphore(vulkanSemaphore);
+}
+
+void TimelineSemaphore::wait(const uint64_t value) const
+{
+	constexpr uint64_t timeout{ std::numeric_limits<uint64_t>::max() };
+	const vk::SemaphoreWaitInfo semaphoreWaitInfo{
+		.semaphoreCount = 1,
+		.pSemaphores = &vulkanSemaphore,
+		.pValues = &value
+	};
+	const vk::Result result{ vulkanLogicalDevice.waitSemaphores(semaphoreWaitInfo, timeout) };
+	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to wait for timeline semaphore!");
+}
+
+const bool TimelineSemaphore::waitFor(const uint64_t value, const uint64_t timeout) const
+{
+	const vk::SemaphoreWaitInfo semaphoreWaitInfo{
+		.semaphoreCount = 1,
+		.pSemaphores = &vulkanSemaphore,
+		.pValues = &value
+	};
+	const vk::Result result{ vulkanLogicalDevice.waitSemaphores(semaphoreWaitInfo, timeout) };
+	if (result == vk::Result::eTimeout)
+	{
+		return false;
+	}
+	ExceptionChecker::throwExceptionIfVulkanResultIsNotSuccess(result, "Failed to wait for timeline semaphore!");
+	return true;
+}
+
+const uint64_t TimelineSemaphore::getCompletedValue() const
+{
+	return vulkanLogicalDevice.getSemaphoreCounterValue(vulkanSemaphore);
+}
+
+const vk::Semaphore TimelineSemaphore::getVulkanSemaphore() const
+{
+	return vulkanSemaphore;
+}
@@ -0,0 +1,267 @@
+#include "TlsfAllocator.h"
+
+TlsfAllocator::TlsfAllocator(const uint64_t size) : size(size)
+{
+	for (auto& freeList : freeLists)
+	{
+		freeList.fill(invalidRange);
+	}
+	const uint32_t rangeIndex{ createRange(Range{
+		.offset = 0,
+		.size = size,
+		.previousPhysical = invalidRange,
+		.nextPhysical = invalidRange,
+		.previousFree = invalidRange,
+		.nextFree = invalidRange,
+		.isFree = true
+	}) };
+	insertFreeRange(rangeIndex);
+}
+
+std::optional<TlsfAllocation> TlsfAllocator::allocate(const uint64_t size, const uint64_t alignment)
+{
+	const uint64_t rangeAlignment{ std::max(alignment, minimumAlignment) };
+	const uint64_t rangeSize{ std::max((size + minimumAlignment - 1) & ~(minimumAlignment - 1), minimumAlignment) };
+	uint32_t rangeIndex{ findFreeRange(rangeSize, rangeAlignment) };
+	if (rangeIndex == invalidRange)
+	{
+		return std::nullopt;
+	}
+	removeFreeRange(rangeIndex);
+	const uint64_t padding{ ((ranges[rangeIndex].offset + rangeAlignment - 1) & ~(rangeAlignment - 1)) - ranges[rangeIndex].offset };
+	if (padding > 0)
+	{
+		const uint32_t alignedRangeIndex{ splitRange(rangeIndex, padding) };
+		insertFreeRange(rangeIndex);
+		rangeIndex = alignedRangeIndex;
+	}
+	if (ranges[rangeIndex].size > rangeSize)
+	{
+		insertFreeRange(splitRange(rangeIndex, rangeSize));
+	}
+	ranges[rangeIndex].isFree = false;
+	usedSize += ranges[rangeIndex].size;
+	++allocationCount;
+	return TlsfAllocation{
+		.offset = ranges[rangeIndex].offset,
+		.size = ranges[rangeIndex].size,
+		.handle = rangeIndex
+	};
+}
+
+void TlsfAllocator::free(const uint32_t handle)
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(handle, ranges.size(), "Error in TlsfAllocator! Allocation handle is out of bounds");
+	if (ranges[handle].isFree)
+	{
+		throw std::runtime_error("Error in TlsfAllocator! Allocation has already been released");
+	}
+	uint32_t rangeIndex{ handle };
+	usedSize -= ranges[rangeIndex].size;
+	--allocationCount;
+	ranges[rangeIndex].isFree = true;
+	const uint32_t nextRangeIndex{ ranges[rangeIndex].nextPhysical };
+	if (nextRangeIndex != invalidRange && ranges[nextRangeIndex].isFree)
+	{
+		removeFreeRange(nextRangeIndex);
+		mergeWithNextRange(rangeIndex);
+	}
+	const uint32_t previousRangeIndex{ ranges[rangeIndex].previousPhysical };
+	if (previousRangeIndex != invalidRange && ranges[previousRangeIndex].isFree)
+	{
+		removeFreeRange(previousRangeIndex);
+		mergeWithNextRange(previousRangeIndex);
+		rangeIndex = previousRangeIndex;
+	}
+	insertFreeRange(rangeIndex);
+}
+
+void TlsfAllocator::mapping(const uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const
+{
+	if (size < secondLevelCount)
+	{
+		firstLevel = 0;
+		secondLevel = static_cast<uint32_t>(size);
+		return;
+	}
+	const uint32_t mostSignificantBit{ static_cast<uint32_t>(63 - std::countl_zero(size)) };
+	firstLevel = mostSignificantBit - secondLevelCountLog2 + 1;
+	secondLevel = static_cast<uint32_t>(size >> (mostSignificantBit - secondLevelCountLog2)) ^ secondLevelCount;
+}
+
+const uint32_t TlsfAllocator::findFreeRange(const uint64_t size, const uint64_t alignment) const
+{
+	uint32_t firstLevel, secondLevel;
+	mapping(size, firstLevel, secondLevel);
+	const uint32_t fittingRangeIndex{ findFittingRangeInFreeList(firstLevel, secondLevel, size, alignment) };
+	if (fittingRangeIndex != invalidRange)
+	{
+		return fittingRangeIndex;
+	}
+	uint32_t paddedFirstLevel, paddedSecondLevel;
+	mapping(size + alignment - minimumAlignment, paddedFirstLevel, paddedSecondLevel);
+	if (paddedFirstLevel != firstLevel || paddedSecondLevel != secondLevel)
+	{
+		const uint32_t paddedFittingRangeIndex{ findFittingRangeInFreeList(paddedFirstLevel, paddedSecondLevel, size, alignment) };
+		if (paddedFittingRangeIndex != invalidRange)
+		{
+			return paddedFittingRangeIndex;
+		}
+	}
+	uint32_t secondLevelBitmap{ paddedSecondLevel + 1 < secondLevelCount ? secondLevelBitmaps[paddedFirstLevel] & (~0u << (paddedSecondLevel + 1)) : 0 };
+	if (secondLevelBitmap == 0)
+	{
+		const uint64_t firstLevelBitmapAbove{ paddedFirstLevel + 1 < firstLevelCount ? firstLevelBitmap & (~0ull << (paddedFirstLevel + 1)) : 0 };
+		if (firstLevelBitmapAbove == 0)
+		{
+			return invalidRange;
+		}
+		paddedFirstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelBitmapAbove));
+		secondLevelBitmap = secondLevelBitmaps[paddedFirstLevel];
+	}
+	return freeLists[paddedFirstLevel][std::countr_zero(secondLevelBitmap)];
+}
+
+const uint32_t TlsfAllocator::findFittingRangeInFreeList(const uint32_t firstLevel, const uint32_t secondLevel, const uint64_t size, const uint64_t alignment) const
+{
+	for (uint32_t rangeIndex = freeLists[firstLevel][secondLevel]; rangeIndex != invalidRange; rangeIndex = ranges[rangeIndex].nextFree)
+	{
+		const uint64_t alignedOffset{ (ranges[rangeIndex].offset + alignment - 1) & ~(alignment - 1) };
+		if (alignedOffset + size <= ranges[rangeIndex].offset + ranges[rangeIndex].size)
+		{
+			return rangeIndex;
+		}
+	}
+	return invalidRange;
+}
+
+void TlsfAllocator::insertFreeRange(const uint32_t rangeIndex)
+{
+	uint32_t firstLevel, secondLevel;
+	mapping(ranges[rangeIndex].size, firstLevel, secondLevel);
+	const uint32_t headRangeIndex{ freeLists[firstLevel][secondLevel] };
+	ranges[rangeIndex].previousFree = invalidRange;
+	ranges[rangeIndex].nextFree = headRangeIndex;
+	if (headRangeIndex != invalidRange)
+	{
+		ranges[headRangeIndex].previousFree = rangeIndex;
+	}
+	freeLists[firstLevel][secondLevel] = rangeIndex;
+	secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+	firstLevelBitmap |= 1ull << firstLevel;
+}
+
+void TlsfAllocator::removeFreeRange(const uint32_t rangeIndex)
+{
+	const Range& range{ ranges[rangeIndex] };
+	if (range.previousFree != invalidRange)
+	{
+		ranges[range.previousFree].nextFree = range.nextFree;
+	}
+	if (range.nextFree != invalidRange)
+	{
+		ranges[range.nextFree].previousFree = range.previousFree;
+	}
+	uint32_t firstLevel, secondLevel;
+	mapping(range.size, firstLevel, secondLevel);
+	if (freeLists[firstLevel][secondLevel] == rangeIndex)
+	{
+		freeLists[firstLevel][secondLevel] = range.nextFree;
+		if (range.nextFree == invalidRange)
+		{
+			secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+			if (secondLevelBitmaps[firstLevel] == 0)
+			{
+				firstLevelBitmap &= ~(1ull << firstLevel);
+			}
+		}
+	}
+}
+
+const uint32_t TlsfAllocator::splitRange(const uint32_t rangeIndex, const uint64_t size)
+{
+	const uint32_t splitRangeIndex{ createRange(Range{
+		.offset = ranges[rangeIndex].offset + size,
+		.size = ranges[rangeIndex].size - size,
+		.previousPhysical = rangeIndex,
+		.nextPhysical = ranges[rangeIndex].nextPhysical,
+		.previousFree = invalidRange,
+		.nextFree = invalidRange,
+		.isFree = true
+	}) };
+	if (ranges[splitRangeIndex].nextPhysical != invalidRange)
+	{
+		ranges[ranges[splitRangeIndex].nextPhysical].previousPhysical = splitRangeIndex;
+	}
+	ranges[rangeIndex].size = size;
+	ranges[rangeIndex].nextPhysical = splitRangeIndex;
+	return splitRangeIndex;
+}
+
+void TlsfAllocator::mergeWithNextRange(const uint32_t rangeIndex)
+{
+	const uint32_t nextRangeIndex{ ranges[rangeIndex].nextPhysical };
+	ranges[rangeIndex].size += ranges[nextRangeIndex].size;
+	ranges[rangeIndex].nextPhysical = ranges[nextRangeIndex].nextPhysical;
+	if (ranges[rangeIndex].nextPhysical != invalidRange)
+	{
+		ranges[ranges[rangeIndex].nextPhysical].previousPhysical = rangeIndex;
+	}
+	destroyRange(nextRangeIndex);
+}
+
+const uint32_t TlsfAllocator::createRange(const Range& range)
+{
+	if (unusedRanges.empty())
+	{
+		ranges.push_back(range);
+		return static_cast<uint32_t>(ranges.size() - 1);
+	}
+	const uint32_t rangeIndex{ unusedRanges.back() };
+	unusedRanges.pop_back();
+	ranges[rangeIndex] = range;
+	return rangeIndex;
+}
+
+void TlsfAllocator::destroyRange(const uint32_t rangeIndex)
+{
+	ranges[rangeIndex].isFree = true;
+	ranges[rangeIndex].size = 0;
+	unusedRanges.push_back(rangeIndex);
+}
+
+const uint64_t TlsfAllocator::getSize() const
+{
+	return size;
+}
+
+const uint64_t TlsfAllocator::getUsedSize() const
+{
+	return usedSize;
+}
+
+const uint64_t TlsfAllocator::getLargestFreeRange() const
+{
+	if (firstLevelBitmap == 0)
+	{
+		return 0;
+	}
+	const uint32_t firstLevel{ static_cast<uint32_t>(63 - std::countl_zero(firstLevelBitmap)) };
+	const uint32_t secondLevel{ static_cast<uint32_t>(31 - std::countl_zero(secondLevelBitmaps[firstLevel])) };
+	uint64_t largestFreeRange{ 0 };
+	for (uint32_t rangeIndex = freeLists[firstLevel][secondLevel]; rangeIndex != invalidRange; rangeIndex = ranges[rangeIndex].nextFree)
+	{
+		largestFreeRange = std::max(largestFreeRange, ranges[rangeIndex].size);
+	}
+	return largestFreeRange;
+}
+
+const uint32_t TlsfAllocator::getAllocationCount() const
+{
+	return allocationCount;
+}
+
+const bool TlsfAllocator::isEmpty() const
+{
+	return allocationCount == 0;
+}
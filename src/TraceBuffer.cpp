@@ -0,0 +1,38 @@
+#include "TraceBuffer.h"
+
+TraceBuffer::TraceBuffer(const uint32_t threadIndex, const size_t capacity) : threadIndex(threadIndex), traceEvents(capacity)
+{
+}
+
+void TraceBuffer::push(const TraceEvent& traceEvent)
+{
+	const uint64_t currentWriteIndex{ writeIndex.load(std::memory_order_relaxed) };
+	if (currentWriteIndex - readIndex.load(std::memory_order_acquire) >= traceEvents.size())
+	{
+		droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	traceEvents[currentWriteIndex % traceEvents.size()] = traceEvent;
+	writeIndex.store(currentWriteIndex + 1, std::memory_order_release);
+}
+
+void TraceBuffer::drain(std::vector<TraceEvent>& drainedTraceEvents)
+{
+	const uint64_t currentReadIndex{ readIndex.load(std::memory_order_relaxed) };
+	const uint64_t currentWriteIndex{ writeIndex.load(std::memory_order_acquire) };
+	for (uint64_t eventIndex = currentReadIndex; eventIndex < currentWriteIndex; ++eventIndex)
+	{
+		drainedTraceEvents.push_back(traceEvents[eventIndex % traceEvents.size()]);
+	}
+	readIndex.store(currentWriteIndex, std::memory_order_release);
+}
+
+const uint32_t TraceBuffer::getThreadIndex() const
+{
+	return threadIndex;
+}
+
+const uint64_t TraceBuffer::getDroppedEventCount() const
+{
+	return droppedEventCount.load(std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#include "TraceZone.h"
+
+TraceZone::TraceZone(const char* name) : name(name), startNanoseconds(Tracer::getInstance().getNanoseconds())
+{
+}
+
+TraceZone::~TraceZone()
+{
+	Tracer& tracer{ Tracer::getInstance() };
+	tracer.addZone(name, startNanoseconds, tracer.getNanoseconds());
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "Tracer.h"
+
+Tracer& Tracer::getInstance()
+{
+	static Tracer tracer;
+	return tracer;
+}
+
+const int64_t Tracer::getNanoseconds() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+TraceBuffer& Tracer::getThreadBuffer()
+{
+	thread_local TraceBuffer* threadBuffer{ nullptr };
+	if (!threadBuffer)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		threadBuffers.push_back(std::make_shared<TraceBuffer>(static_cast<uint32_t>(threadBuffers.size()), threadBufferCapacity));
+		threadBuffer = threadBuffers.back().get();
+	}
+	return *threadBuffer;
+}
+
+void Tracer::addZone(const char* name, const int64_t startNanoseconds, const int64_t endNanoseconds)
+{
+	getThreadBuffer().push(TraceEvent{
+		.name = name,
+		.startNanoseconds = startNanoseconds,
+		.endNanoseconds = endNanoseconds
+	});
+}
+
+void Tracer::addGpuZone(const GpuTraceEvent& gpuTraceEvent)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (gpuTraceEvents.size() >= maximumGpuEventCount)
+	{
+		++droppedGpuEventCount;
+		return;
+	}
+	gpuTraceEvents.push_back(gpuTraceEvent);
+}
+
+void Tracer::calibrateGpuClock(const int64_t cpuNanoseconds, const int64_t gpuNanoseconds)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	gpuClockOffsetNanoseconds = std::min(gpuClockOffsetNanoseconds, gpuNanoseconds - cpuNanoseconds);
+}
+
+void Tracer::drainThreadBuffers()
+{
+	for (const auto& threadBuffer : threadBuffers)
+	{
+		if (threadTraceEvents.size() <= threadBuffer->getThreadIndex())
+		{
+			threadTraceEvents.resize(threadBuffer->getThreadIndex() + 1);
+		}
+		ThreadTraceEvents& drainedThreadTraceEvents{ threadTraceEvents[threadBuffer->getThreadIndex()] };
+		drainedThreadTraceEvents.threadIndex = threadBuffer->getThreadIndex();
+		std::vector<TraceEvent> traceEvents;
+		threadBuffer->drain(traceEvents);
+		const size_t keptEventCount{ std::min(traceEvents.size(), maximumThreadEventCount - std::min(drainedThreadTraceEvents.traceEvents.size(), maximumThreadEventCount)) };
+		drainedThreadTraceEvents.traceEvents.insert(drainedThreadTraceEvents.traceEvents.end(), traceEvents.begin(), traceEvents.begin() + keptEventCount);
+		droppedThreadEventCount += traceEvents.size() - keptEventCount;
+	}
+}
+
+void Tracer::writeChromeTrace(const std::filesystem::path& filePath)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	drainThreadBuffers();
+	std::ofstream file(filePath, std::ios::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Error in Tracer! " + filePath.string() + " could not be written");
+	}
+	bool isFirstEvent{ true };
+	file << "{ \"traceEvents\": [" << std::endl;
+	writeCpuEvents(file, isFirstEvent);
+	writeGpuEvents(file, isFirstEvent);
+	file << std::endl << "], \"otherData\": { \"droppedEventCount\": " << getDroppedEventCount() << " } }" << std::endl;
+}
+
+const uint64_t Tracer::getDroppedEventCount() const
+{
+	uint64_t droppedEventCount{ droppedThreadEventCount + droppedGpuEventCount };
+	for (const auto& threadBuffer : threadBuffers)
+	{
+		droppedEventCount += threadBuffer->getDroppedEventCount();
+	}
+	return droppedEventCount;
+}
+
+void Tracer::writeCpuEvents(std::ofstream& file, bool& isFirstEvent) const
+{
+	for (const auto& drainedThreadTraceEvents : threadTraceEvents)
+	{
+		for (const auto& traceEvent : drainedThreadTraceEvents.traceEvents)
+		{
+			writeEvent(file, isFirstEvent, traceEvent.name, 0, drainedThreadTraceEvents.threadIndex, traceEvent.startNanoseconds, traceEvent.endNanoseconds);
+		}
+	}
+	for (const auto& drainedThreadTraceEvents : threadTraceEvents)
+	{
+		file << (isFirstEvent ? "" : ",\n") << "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << drainedThreadTraceEvents.threadIndex
+			<< ", \"args\": { \"name\": \"" << (drainedThreadTraceEvents.threadIndex == 0 ? "Main thread" : "Thread " + std::to_string(drainedThreadTraceEvents.threadIndex)) << "\" } }";
+		isFirstEvent = false;
+	}
+}
+
+void Tracer::writeGpuEvents(std::ofstream& file, bool& isFirstEvent) const
+{
+	std::vector<std::string> lanes;
+	for (const auto& gpuTraceEvent : gpuTraceEvents)
+	{
+		if (std::find(lanes.begin(), lanes.end(), gpuTraceEvent.lane) == lanes.end())
+		{
+			lanes.push_back(gpuTraceEvent.lane);
+		}
+		const uint32_t laneIndex{ static_cast<uint32_t>(std::distance(lanes.begin(), std::find(lanes.begin(), lanes.end(), gpuTraceEvent.lane))) };
+		writeEvent(file, isFirstEvent, gpuTraceEvent.name, 1, laneIndex, gpuTraceEvent.startNanoseconds - gpuClockOffsetNanoseconds, gpuTraceEvent.endNanoseconds - gpuClockOffsetNanoseconds);
+	}
+	for (uint32_t laneIndex = 0; laneIndex < lanes.size(); ++laneIndex)
+	{
+		file << "," << std::endl << "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << laneIndex << ", \"args\": { \"name\": \"GPU " << lanes[laneIndex] << " queue\" } }";
+	}
+}
+
+void Tracer::writeEvent(std::ofstream& file, bool& isFirstEvent, const std::string& name, const uint32_t processIndex, const uint32_t threadIndex, const int64_t startNanoseconds, const int64_t endNanoseconds) const
+{
+	file << (isFirstEvent ? "" : ",\n") << "{ \"name\": \"" << name << "\", \"ph\": \"X\", \"pid\": " << processIndex << ", \"tid\": " << threadIndex
+		<< ", \"ts\": " << startNanoseconds / 1000.0 << ", \"dur\": " << (endNanoseconds - startNanoseconds) / 1000.0 << " }";
+	isFirstEvent = false;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "TransferQueue.h"
+
+TransferQueue::TransferQueue(const vk::Device& vulkanLogicalDevice, const std::optional<uint32_t>& queueFamilyIndex) : Queue(vulkanLogicalDevice, queueFamilyIndex)
+{
+}
+
+void TransferQueue::submit(const vk::CommandBuffer& vulkanCommandBuffer, const vk::Semaphore& timelineSemaphore, const uint64_t signalValue)
+{
+	const vk::TimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{
+		.signalSemaphoreValueCount = 1,
+		.pSignalSemaphoreValues = &signalValue
+	};
+	const vk::SubmitInfo submitInfo{
+		.pNext = &timelineSemaphoreSubmitInfo,
+		.commandBufferCount = 1,
+		.pCommandBuffers = &vulkanCommandBuffer,
+		.signalSemaphoreCount = 1,
+		.pSignalSemaphores = &timelineSemaphore
+	};
+	vulkanQueue.submit(submitInfo);
+}
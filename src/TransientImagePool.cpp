@@ -0,0 +1,95 @@
+#include "TransientImagePool.h"
+
+TransientImagePool::TransientImagePool(const std::shared_ptr<DeviceMemoryAllocator>& deviceMemoryAllocator) : deviceMemoryAllocator(deviceMemoryAllocator)
+{
+}
+
+TransientImagePool::~TransientImagePool()
+{
+	images.clear();
+	for (const auto& memoryAllocation : memoryAllocations)
+	{
+		deviceMemoryAllocator->free(memoryAllocation);
+	}
+}
+
+const uint32_t TransientImagePool::addImage(const TransientImageDescription& transientImageDescription)
+{
+	if (!memoryAllocations.empty())
+	{
+		throw std::runtime_error("Error in TransientImagePool! Images cannot be added after memory has been allocated");
+	}
+	images.push_back(std::make_unique<Image>(transientImageDescription.imageCreateInfo));
+	transientImageDescriptions.push_back(transientImageDescription);
+	return static_cast<uint32_t>(images.size() - 1);
+}
+
+void TransientImagePool::allocate()
+{
+	allocateAliasedMemory(true);
+	allocateAliasedMemory(false);
+	transientMemoryStatistics.imageCount = static_cast<uint32_t>(images.size());
+}
+
+void TransientImagePool::allocateAliasedMemory(const bool isTransient)
+{
+	std::vector<uint32_t> imageIndices;
+	std::vector<TransientResourceRequest> transientResourceRequests;
+	vk::MemoryRequirements aliasedMemoryRequirements{
+		.size = 0,
+		.alignment = 1,
+		.memoryTypeBits = ~0u
+	};
+	for (uint32_t imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+	{
+		if (images[imageIndex]->isTransient() != isTransient)
+		{
+			continue;
+		}
+		const vk::MemoryRequirements memoryRequirements{ images[imageIndex]->getMemoryRequirements() };
+		imageIndices.push_back(imageIndex);
+		transientResourceRequests.push_back(TransientResourceRequest{
+			.size = memoryRequirements.size,
+			.alignment = memoryRequirements.alignment,
+			.firstPass = transientImageDescriptions[imageIndex].firstPass,
+			.lastPass = transientImageDescriptions[imageIndex].lastPass,
+			.isAliasable = transientImageDescriptions[imageIndex].isAliasable
+		});
+		aliasedMemoryRequirements.alignment = std::max(aliasedMemoryRequirements.alignment, memoryRequirements.alignment);
+		aliasedMemoryRequirements.memoryTypeBits &= memoryRequirements.memoryTypeBits;
+	}
+	if (imageIndices.empty())
+	{
+		return;
+	}
+	if (aliasedMemoryRequirements.memoryTypeBits == 0)
+	{
+		throw std::runtime_error("Error in TransientImagePool! Aliased images do not share a memory type");
+	}
+	const TransientMemoryPlan transientMemoryPlan{ TransientMemoryPlanner::plan(transientResourceRequests) };
+	aliasedMemoryRequirements.size = transientMemoryPlan.size;
+	const vk::MemoryPropertyFlags preferredMemoryPropertyFlags{ isTransient ? vk::MemoryPropertyFlagBits::eLazilyAllocated : vk::MemoryPropertyFlags{} };
+	const MemoryAllocation memoryAllocation{ deviceMemoryAllocator->allocate(aliasedMemoryRequirements, vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryResourceType::eImage, preferredMemoryPropertyFlags) };
+	memoryAllocations.push_back(memoryAllocation);
+	for (uint32_t requestIndex = 0; requestIndex < imageIndices.size(); ++requestIndex)
+	{
+		images[imageIndices[requestIndex]]->bindMemory(memoryAllocation.vulkanDeviceMemory, memoryAllocation.offset + transientMemoryPlan.offsets[requestIndex]);
+	}
+	transientMemoryStatistics.unaliasedBytes += transientMemoryPlan.unaliasedSize;
+	transientMemoryStatistics.allocatedBytes += transientMemoryPlan.size;
+	if (deviceMemoryAllocator->getMemoryPropertyFlags(memoryAllocation.memoryTypeIndex) & vk::MemoryPropertyFlagBits::eLazilyAllocated)
+	{
+		transientMemoryStatistics.lazilyAllocatedBytes += transientMemoryPlan.size;
+	}
+}
+
+const Image& TransientImagePool::getImage(const uint32_t imageIndex) const
+{
+	ExceptionChecker::throwExceptionIfIndexIsOutOfBounds(imageIndex, images.size(), "Error in TransientImagePool! Image index is out of bounds");
+	return *images[imageIndex];
+}
+
+const TransientMemoryStatistics TransientImagePool::getStatistics() const
+{
+	return transientMemoryStatistics;
+}
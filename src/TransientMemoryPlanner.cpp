@@ -0,0 +1,70 @@
+#include "TransientMemoryPlanner.h"
+
+const TransientMemoryPlan TransientMemoryPlanner::plan(const std::vector<TransientResourceRequest>& transientResourceRequests)
+{
+	TransientMemoryPlan transientMemoryPlan{
+		.offsets = std::vector<uint64_t>(transientResourceRequests.size(), 0),
+		.size = 0,
+		.unaliasedSize = 0
+	};
+	std::vector<uint32_t> requestOrder(transientResourceRequests.size());
+	std::iota(requestOrder.begin(), requestOrder.end(), 0);
+	std::stable_sort(requestOrder.begin(), requestOrder.end(), [&](const uint32_t firstRequestIndex, const uint32_t secondRequestIndex)
+	{
+		return transientResourceRequests[firstRequestIndex].size > transientResourceRequests[secondRequestIndex].size;
+	});
+	std::vector<uint32_t> placedRequests;
+	for (const uint32_t requestIndex : requestOrder)
+	{
+		const TransientResourceRequest& transientResourceRequest{ transientResourceRequests[requestIndex] };
+		const uint64_t offset{ findOffset(transientResourceRequests, transientMemoryPlan.offsets, placedRequests, requestIndex) };
+		transientMemoryPlan.offsets[requestIndex] = offset;
+		transientMemoryPlan.size = std::max(transientMemoryPlan.size, offset + transientResourceRequest.size);
+		transientMemoryPlan.unaliasedSize = alignUp(transientMemoryPlan.unaliasedSize, transientResourceRequest.alignment) + transientResourceRequest.size;
+		placedRequests.push_back(requestIndex);
+	}
+	return transientMemoryPlan;
+}
+
+const uint64_t TransientMemoryPlanner::findOffset(const std::vector<TransientResourceRequest>& transientResourceRequests, const std::vector<uint64_t>& offsets, const std::vector<uint32_t>& placedRequests, const uint32_t requestIndex)
+{
+	const TransientResourceRequest& transientResourceRequest{ transientResourceRequests[requestIndex] };
+	std::vector<uint32_t> conflictingRequests;
+	for (const uint32_t placedRequestIndex : placedRequests)
+	{
+		if (!canAlias(transientResourceRequest, transientResourceRequests[placedRequestIndex]))
+		{
+			conflictingRequests.push_back(placedRequestIndex);
+		}
+	}
+	std::sort(conflictingRequests.begin(), conflictingRequests.end(), [&](const uint32_t firstRequestIndex, const uint32_t secondRequestIndex)
+	{
+		return offsets[firstRequestIndex] < offsets[secondRequestIndex];
+	});
+	uint64_t candidateOffset{ 0 };
+	for (const uint32_t conflictingRequestIndex : conflictingRequests)
+	{
+		const uint64_t alignedOffset{ alignUp(candidateOffset, transientResourceRequest.alignment) };
+		if (alignedOffset + transientResourceRequest.size <= offsets[conflictingRequestIndex])
+		{
+			return alignedOffset;
+		}
+		candidateOffset = std::max(candidateOffset, offsets[conflictingRequestIndex] + transientResourceRequests[conflictingRequestIndex].size);
+	}
+	return alignUp(candidateOffset, transientResourceRequest.alignment);
+}
+
+const bool TransientMemoryPlanner::canAlias(const TransientResourceRequest& firstRequest, const TransientResourceRequest& secondRequest)
+{
+	return firstRequest.isAliasable && secondRequest.isAliasable && !lifetimesOverlap(firstRequest, secondRequest);
+}
+
+const bool TransientMemoryPlanner::lifetimesOverlap(const TransientResourceRequest& firstRequest, const TransientResourceRequest& secondRequest)
+{
+	return firstRequest.firstPass <= secondRequest.lastPass && secondRequest.firstPass <= firstRequest.lastPass;
+}
+
+const uint64_t TransientMemoryPlanner::alignUp(const uint64_t offset, const uint64_t alignment)
+{
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
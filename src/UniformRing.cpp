@@ -0,0 +1,75 @@
+#include "UniformRing.h"
+
+UniformRing::UniformRing(const UniformRingCreateInfo& uniformRingCreateInfo) : vulkanLogicalDevice(uniformRingCreateInfo.deviceMemoryAllocator->getVulkanLogicalDevice()),
+	uniformSize(uniformRingCreateInfo.uniformSize), uniformAlignment(std::max<vk::DeviceSize>(uniformRingCreateInfo.minUniformBufferOffsetAlignment, 16))
+{
+	LinearMemoryPoolCreateInfo linearMemoryPoolCreateInfo;
+	linearMemoryPoolCreateInfo.deviceMemoryAllocator = uniformRingCreateInfo.deviceMemoryAllocator;
+	linearMemoryPoolCreateInfo.frameSize = (uniformSize + uniformAlignment - 1) / uniformAlignment * uniformAlignment * uniformRingCreateInfo.uniformsPerFrame;
+	linearMemoryPoolCreateInfo.frameCount = uniformRingCreateInfo.frameCount;
+	linearMemoryPoolCreateInfo.bufferUsage = vk::BufferUsageFlagBits::eUniformBuffer;
+	linearMemoryPoolCreateInfo.sharingQueueFamilyIndices = uniformRingCreateInfo.sharingQueueFamilyIndices;
+	linearMemoryPool = std::make_unique<LinearMemoryPool>(linearMemoryPoolCreateInfo);
+	createDescriptorSetLayout(uniformRingCreateInfo.shaderStages);
+	createDescriptorPool();
+	vulkanDescriptorSet = descriptorPool->allocate(descriptorSetLayout->getVulkanDescriptorSetLayout());
+	writeDescriptorSet();
+}
+
+void UniformRing::createDescriptorSetLayout(const vk::ShaderStageFlags& shaderStages)
+{
+	const std::vector<vk::DescriptorSetLayoutBinding> descriptorSetLayoutBindings{
+		vk::DescriptorSetLayoutBinding{
+			.binding = 0,
+			.descriptorType = vk::DescriptorType::eUniformBufferDynamic,
+			.descriptorCount = 1,
+			.stageFlags = shaderStages
+		}
+	};
+	descriptorSetLayout = std::make_unique<DescriptorSetLayout>(vulkanLogicalDevice, descriptorSetLayoutBindings);
+}
+
+void UniformRing::createDescriptorPool()
+{
+	const std::vector<vk::DescriptorPoolSize> descriptorPoolSizes{
+		vk::DescriptorPoolSize{
+			.type = vk::DescriptorType::eUniformBufferDynamic,
+			.descriptorCount = 1
+		}
+	};
+	const uint32_t maxSets{ 1 };
+	descriptorPool = std::make_unique<DescriptorPool>(vulkanLogicalDevice, descriptorPoolSizes, maxSets);
+}
+
+void UniformRing::writeDescriptorSet() const
+{
+	const vk::DescriptorBufferInfo descriptorBufferInfo{
+		.buffer = linearMemoryPool->getVulkanBuffer(),
+		.offset = 0,
+		.range = uniformSize
+	};
+	const vk::WriteDescriptorSet writeDescriptorSet{
+		.dstSet = vulkanDescriptorSet,
+		.dstBinding = 0,
+		.dstArrayElement = 0,
+		.descriptorCount = 1,
+		.descriptorType = vk::DescriptorType::eUniformBufferDynamic,
+		.pBufferInfo = &descriptorBufferInfo
+	};
+	vulkanLogicalDevice.updateDescriptorSets(writeDescriptorSet, nullptr);
+}
+
+void UniformRing::beginFrame(const uint32_t frameIndex)
+{
+	linearMemoryPool->beginFrame(frameIndex);
+}
+
+const vk::DescriptorSetLayout UniformRing::getVulkanDescriptorSetLayout() const
+{
+	return descriptorSetLayout->getVulkanDescriptorSetLayout();
+}
+
+const vk::DescriptorSet UniformRing::getVulkanDescriptorSet() const
+{
+	return vulkanDescriptorSet;
+}
\ No newline at end of file
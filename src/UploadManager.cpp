@@ -0,0 +1,217 @@
+#include "UploadManager.h"
+
+UploadManager::UploadManager(const UploadManagerCreateInfo& uploadManagerCreateInfo) : deviceMemoryAllocator(uploadManagerCreateInfo.deviceMemoryAllocator),
+	transferQueue(uploadManagerCreateInfo.transferQueue), vulkanLogicalDevice(uploadManagerCreateInfo.deviceMemoryAllocator->getVulkanLogicalDevice()),
+	sharingQueueFamilyIndices(uploadManagerCreateInfo.sharingQueueFamilyIndices), ringAllocator(uploadManagerCreateInfo.stagingSize)
+{
+	commandPool = std::make_unique<CommandPool>(vulkanLogicalDevice, uploadManagerCreateInfo.transferFamilyIndex);
+	commandBuffers = std::make_unique<CommandBuffer>(vulkanLogicalDevice, commandPool->getVulkanCommandPool(), uploadManagerCreateInfo.batchCount);
+	timelineSemaphore = std::make_unique<TimelineSemaphore>(vulkanLogicalDevice);
+	vulkanStagingBuffer = vulkanLogicalDevice.createBuffer(buildStagingBufferCreateInfo(uploadManagerCreateInfo.stagingSize));
+	const vk::MemoryPropertyFlags stagingMemoryPropertyFlags{ vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent };
+	stagingMemoryAllocation = deviceMemoryAllocator->allocateBufferMemory(vulkanStagingBuffer, stagingMemoryPropertyFlags);
+	for (uint32_t batchIndex = 0; batchIndex < uploadManagerCreateInfo.batchCount; ++batchIndex)
+	{
+		uploadBatches.push_back(UploadBatch{
+			.vulkanCommandBuffer = commandBuffers->getVulkanCommandBuffer(batchIndex),
+			.timelineValue = 0,
+			.ringMarker = RingMarker{}
+		});
+		freeBatchIndices.push_back(batchIndex);
+	}
+}
+
+UploadManager::~UploadManager()
+{
+	waitForUploads();
+	timelineSemaphore.reset();
+	commandBuffers.reset();
+	commandPool.reset();
+	vulkanLogicalDevice.destroyBuffer(vulkanStagingBuffer);
+	deviceMemoryAllocator->free(stagingMemoryAllocation);
+}
+
+const vk::BufferCreateInfo UploadManager::buildStagingBufferCreateInfo(const vk::DeviceSize stagingSize) const
+{
+	return vk::BufferCreateInfo{
+		.size = stagingSize,
+		.usage = vk::BufferUsageFlagBits::eTransferSrc,
+		.sharingMode = vk::SharingMode::eExclusive
+	};
+}
+
+const uint64_t UploadManager::upload(const vk::Buffer& vulkanDstBuffer, const MemoryAllocation& dstMemoryAllocation, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size)
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	const auto start{ std::chrono::steady_clock::now() };
+	if (isZeroCopyDestination(dstMemoryAllocation))
+	{
+		write(dstMemoryAllocation, dstOffset, data, size);
+		uploadStatistics.zeroCopyMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return 0;
+	}
+	collectCompletedBatches();
+	stage(vulkanDstBuffer, dstOffset, data, size);
+	uploadStatistics.stagedMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return recordingBatchIndex ? uploadBatches[recordingBatchIndex.value()].timelineValue : nextTimelineValue - 1;
+}
+
+const uint64_t UploadManager::copy(const vk::Buffer& vulkanSrcBuffer, const vk::Buffer& vulkanDstBuffer, const std::vector<vk::BufferCopy>& bufferCopyRegions)
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	const vk::CommandBuffer vulkanCommandBuffer{ getRecordingBatch().vulkanCommandBuffer };
+	const vk::MemoryBarrier memoryBarrier{
+		.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+		.dstAccessMask = vk::AccessFlagBits::eTransferRead
+	};
+	vulkanCommandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags{}, memoryBarrier, nullptr, nullptr);
+	vulkanCommandBuffer.copyBuffer(vulkanSrcBuffer, vulkanDstBuffer, bufferCopyRegions);
+	return uploadBatches[recordingBatchIndex.value()].timelineValue;
+}
+
+const bool UploadManager::isZeroCopyDestination(const MemoryAllocation& dstMemoryAllocation) const
+{
+	const vk::MemoryPropertyFlags memoryPropertyFlags{ deviceMemoryAllocator->getMemoryPropertyFlags(dstMemoryAllocation.memoryTypeIndex) };
+	return dstMemoryAllocation.mappedData && (memoryPropertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+}
+
+void UploadManager::write(const MemoryAllocation& dstMemoryAllocation, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size)
+{
+	std::memcpy(static_cast<char*>(dstMemoryAllocation.mappedData) + dstOffset, data, static_cast<size_t>(size));
+	++uploadStatistics.zeroCopyUploadCount;
+	uploadStatistics.zeroCopyBytes += size;
+}
+
+void UploadManager::stage(const vk::Buffer& vulkanDstBuffer, const vk::DeviceSize dstOffset, const void* data, const vk::DeviceSize size)
+{
+	vk::DeviceSize uploadedSize{ 0 };
+	while (uploadedSize < size)
+	{
+		const vk::DeviceSize chunkSize{ std::min(size - uploadedSize, ringAllocator.getSize()) };
+		const vk::DeviceSize stagingOffset{ reserveStagingMemory(chunkSize) };
+		std::memcpy(static_cast<char*>(stagingMemoryAllocation.mappedData) + stagingOffset, static_cast<const char*>(data) + uploadedSize, static_cast<size_t>(chunkSize));
+		const vk::BufferCopy bufferCopyRegion{
+			.srcOffset = stagingOffset,
+			.dstOffset = dstOffset + uploadedSize,
+			.size = chunkSize
+		};
+		getRecordingBatch().vulkanCommandBuffer.copyBuffer(vulkanStagingBuffer, vulkanDstBuffer, 1, &bufferCopyRegion);
+		uploadedSize += chunkSize;
+	}
+	++uploadStatistics.stagedUploadCount;
+	uploadStatistics.stagedBytes += size;
+}
+
+const vk::DeviceSize UploadManager::reserveStagingMemory(const vk::DeviceSize size)
+{
+	std::optional<uint64_t> stagingOffset{ ringAllocator.allocate(size, stagingAlignment) };
+	while (!stagingOffset)
+	{
+		if (submittedBatchIndices.empty())
+		{
+			submitRecordingBatch();
+		}
+		waitForOldestBatch();
+		stagingOffset = ringAllocator.allocate(size, stagingAlignment);
+	}
+	return stagingOffset.value();
+}
+
+UploadBatch& UploadManager::getRecordingBatch()
+{
+	if (!recordingBatchIndex)
+	{
+		if (freeBatchIndices.empty())
+		{
+			waitForOldestBatch();
+		}
+		recordingBatchIndex = freeBatchIndices.back();
+		freeBatchIndices.pop_back();
+		uploadBatches[recordingBatchIndex.value()].timelineValue = nextTimelineValue++;
+		const vk::CommandBufferBeginInfo commandBufferBeginInfo{ .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit };
+		uploadBatches[recordingBatchIndex.value()].vulkanCommandBuffer.begin(commandBufferBeginInfo);
+	}
+	return uploadBatches[recordingBatchIndex.value()];
+}
+
+void UploadManager::submitRecordingBatch()
+{
+	if (!recordingBatchIndex)
+	{
+		return;
+	}
+	UploadBatch& uploadBatch{ uploadBatches[recordingBatchIndex.value()] };
+	uploadBatch.vulkanCommandBuffer.end();
+	uploadBatch.ringMarker = ringAllocator.createMarker();
+	transferQueue->submit(uploadBatch.vulkanCommandBuffer, timelineSemaphore->getVulkanSemaphore(), uploadBatch.timelineValue);
+	submittedBatchIndices.push_back(recordingBatchIndex.value());
+	recordingBatchIndex.reset();
+}
+
+void UploadManager::collectCompletedBatches()
+{
+	const uint64_t completedTimelineValue{ timelineSemaphore->getCompletedValue() };
+	while (!submittedBatchIndices.empty() && uploadBatches[submittedBatchIndices.front()].timelineValue <= completedTimelineValue)
+	{
+		releaseOldestBatch();
+	}
+}
+
+void UploadManager::waitForOldestBatch()
+{
+	timelineSemaphore->wait(uploadBatches[submittedBatchIndices.front()].timelineValue);
+	releaseOldestBatch();
+}
+
+void UploadManager::releaseOldestBatch()
+{
+	const uint32_t batchIndex{ submittedBatchIndices.front() };
+	submittedBatchIndices.pop_front();
+	UploadBatch& uploadBatch{ uploadBatches[batchIndex] };
+	ringAllocator.release(uploadBatch.ringMarker);
+	uploadBatch.vulkanCommandBuffer.reset();
+	freeBatchIndices.push_back(batchIndex);
+}
+
+void UploadManager::flush()
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	submitRecordingBatch();
+}
+
+void UploadManager::collectCompletedUploads()
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	collectCompletedBatches();
+}
+
+void UploadManager::waitForUploads()
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	submitRecordingBatch();
+	while (!submittedBatchIndices.empty())
+	{
+		waitForOldestBatch();
+	}
+}
+
+const vk::Semaphore UploadManager::getVulkanTimelineSemaphore() const
+{
+	return timelineSemaphore->getVulkanSemaphore();
+}
+
+const uint64_t UploadManager::getCompletedTimelineValue() const
+{
+	return timelineSemaphore->getCompletedValue();
+}
+
+const std::vector<uint32_t>& UploadManager::getSharingQueueFamilyIndices() const
+{
+	return sharingQueueFamilyIndices;
+}
+
+const UploadStatistics UploadManager::getStatistics()
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	return uploadStatistics;
+}
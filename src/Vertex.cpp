@@ -9,11 +9,12 @@ const vk::VertexInputBindingDescription Vertex::getBindingDescription()
 	};
 }
 
-const std::array<vk::VertexInputAttributeDescription, 2> Vertex::getAttributeDescriptions()
+const std::array<vk::VertexInputAttributeDescription, 3> Vertex::getAttributeDescriptions()
 {
-	std::array<vk::VertexInputAttributeDescription, 2> attributeDescriptions{};
+	std::array<vk::VertexInputAttributeDescription, 3> attributeDescriptions{};
 	attributeDescriptions[0] = getPositionAttributeDescription();
 	attributeDescriptions[1] = getColorAttributeDescription();
+	attributeDescriptions[2] = getNormalAttributeDescription();
 	return attributeDescriptions;
 }
 
@@ -22,7 +23,7 @@ const vk::VertexInputAttributeDescription Vertex::getPositionAttributeDescriptio
 	return vk::VertexInputAttributeDescription{
 		.location = 0,
 		.binding = 0,
-		.format = vk::Format::eR32G32Sfloat,
+		.format = vk::Format::eR32G32B32Sfloat,
 		.offset = offsetof(Vertex, position)
 	};
 }
@@ -35,4 +36,14 @@ const vk::VertexInputAttributeDescription Vertex::getColorAttributeDescription()
 		.format = vk::Format::eR32G32B32Sfloat,
 		.offset = offsetof(Vertex, color)
 	};
+}
+
+const vk::VertexInputAttributeDescription Vertex::getNormalAttributeDescription()
+{
+	return vk::VertexInputAttributeDescription{
+		.location = 2,
+		.binding = 0,
+		.format = vk::Format::eR32G32B32Sfloat,
+		.offset = offsetof(Vertex, normal)
+	};
 }
\ No newline at end of file
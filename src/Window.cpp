@@ -1,6 +1,6 @@
 #include "Window.h"
 
-Window::Window(const int width, const int height, const std::string& title) : width(width), height(height), title(title)
+Window::Window(const int width, const int height, const std::string& title, const bool isVisible) : width(width), height(height), title(title), isVisible(isVisible)
 {
 	glfwInit();
 	setGlfwWindowHints();
@@ -16,7 +16,8 @@ Window::~Window()
 void Window::setGlfwWindowHints() const
 {
 	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-	glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+	glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
+	glfwWindowHint(GLFW_VISIBLE, isVisible ? GLFW_TRUE : GLFW_FALSE);
 }
 
 void Window::createGlfwWindow()
@@ -41,13 +42,28 @@ void Window::waitEvents() const
 	glfwWaitEvents();
 }
 
-void Window::open(std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame)
+void Window::pollEvents() const
+{
+	glfwPollEvents();
+}
+
+const bool Window::isKeyPressed(const int key) const
+{
+	return glfwGetKey(glfwWindow, key) == GLFW_PRESS;
+}
+
+void Window::open(std::function<void(std::function<WindowSize()>, std::function<void()>)> drawFrame, std::function<void()> waitForNextFrame)
 {
 	std::function<WindowSize()> getFramebufferSize = std::bind(&Window::getFramebufferSize, this);
 	std::function<void()> waitEvents = std::bind(&Window::waitEvents, this);
 	while(!glfwWindowShouldClose(glfwWindow)) 
 	{
-		glfwPollEvents();
+		TRACE_ZONE("Frame");
+		waitForNextFrame();
+		{
+			TRACE_ZONE("PollEvents");
+			glfwPollEvents();
+		}
 		drawFrame(getFramebufferSize, waitEvents);
 	}
 }
\ No newline at end of file